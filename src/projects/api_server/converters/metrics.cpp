@@ -35,6 +35,20 @@ namespace api
 			return std::move(value);
 		}
 
+		Json::Value JsonFromApplicationMetrics(const std::shared_ptr<const mon::ApplicationMetrics> &metrics)
+		{
+			Json::Value value = JsonFromMetrics(metrics);
+
+			if (value.isNull())
+			{
+				return std::move(value);
+			}
+
+			SetInt64(value, "segmentBytes", metrics->GetSegmentBytes());
+
+			return std::move(value);
+		}
+
 		Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
 		{
 			Json::Value value = JsonFromMetrics(metrics);
@@ -46,6 +60,22 @@ namespace api
 
 			SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginRequestTimeMSec());
 			SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginResponseTimeMSec());
+			SetInt64(value, "segmentBytes", metrics->GetSegmentBytes());
+			SetInt64(value, "transcoderSharedFrameBytes", metrics->GetTranscoderSharedFrameBytes());
+			SetInt64(value, "transcoderCascadedFrameBytes", metrics->GetTranscoderCascadedFrameBytes());
+
+			Json::Value &sessions = value["webrtcSessions"];
+			sessions = Json::arrayValue;
+
+			for (const auto &item : metrics->GetEstimatedBitrates())
+			{
+				Json::Value session;
+
+				SetInt64(session, "id", item.first);
+				SetInt64(session, "estimatedBitrate", item.second);
+
+				sessions.append(session);
+			}
 
 			return std::move(value);
 		}
@@ -15,6 +15,7 @@ namespace api
 	namespace conv
 	{
 		Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
+		Json::Value JsonFromApplicationMetrics(const std::shared_ptr<const mon::ApplicationMetrics> &metrics);
 		Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	}  // namespace conv
 };	   // namespace api
\ No newline at end of file
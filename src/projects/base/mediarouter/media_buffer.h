@@ -15,6 +15,9 @@
 #include <base/common_types.h>
 #include "media_type.h"
 
+// Decoded frame of FFmpeg (MediaFrame can hold it without including the headers of FFmpeg)
+struct AVFrame;
+
 enum class MediaPacketFlag : uint8_t
 {
 	Unknown, // Unknown
@@ -258,6 +261,8 @@ public:
 
 	void ClearBuffer(int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr)
@@ -268,6 +273,8 @@ public:
 
 	void SetBuffer(const uint8_t *data, int32_t data_size, int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr && data_size != 0)
@@ -279,6 +286,8 @@ public:
 
 	void AppendBuffer(const uint8_t *data, int32_t data_size, int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr && data_size != 0)
@@ -301,6 +310,8 @@ public:
 
 	uint8_t *GetWritableBuffer(int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr)
@@ -323,9 +334,24 @@ public:
 		return 0;
 	}
 
+	// Sum of the sizes of all planes
+	size_t GetTotalBufferSize() const
+	{
+		size_t size = 0;
+
+		for (auto &item : _data_buffer)
+		{
+			size += item.second->GetLength();
+		}
+
+		return size;
+	}
+
 	// 메모리만 미리 할당함
 	void Reserve(uint32_t capacity, int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr)
@@ -338,6 +364,8 @@ public:
 	// Append Buffer의 성능문제로 Resize를 선작업한다음 GetBuffer로 포인터를 얻어와 데이터를 설정함.
 	void Resize(uint32_t capacity, int32_t plane = 0)
 	{
+		DetachAVFrame();
+
 		auto plane_data = AllocPlainData(plane);
 
 		if (plane_data != nullptr)
@@ -346,6 +374,31 @@ public:
 		}
 	}
 
+	// Refer to the plane of av_frame without copying.
+	// The memory is kept alive by the AVFrame until the frame (and all clones of it) are released,
+	// and is copied when the plane is modified (SetBuffer(), GetWritableBuffer(), ...)
+	void SetAVFrame(std::shared_ptr<AVFrame> av_frame, const uint8_t *const planes[], const int32_t plane_sizes[], int32_t plane_count)
+	{
+		_data_buffer.clear();
+
+		for (int32_t plane = 0; plane < plane_count; plane++)
+		{
+			if ((planes[plane] != nullptr) && (plane_sizes[plane] > 0))
+			{
+				// reference_only
+				_data_buffer[plane] = std::make_shared<ov::Data>(planes[plane], plane_sizes[plane], true);
+			}
+		}
+
+		_av_frame = std::move(av_frame);
+	}
+
+	// Returns nullptr if the planes are not owned by an AVFrame
+	const std::shared_ptr<AVFrame> &GetAVFrame() const
+	{
+		return _av_frame;
+	}
+
 	void SetMediaType(cmn::MediaType media_type)
 	{
 		_media_type = media_type;
@@ -562,6 +615,9 @@ public:
 				frame->SetStride(GetStride(i), i);
 				frame->SetPlainData(GetPlainData(i)->Clone(), i);
 			}
+
+			// The clone refers to the same planes
+			frame->_av_frame = _av_frame;
 		}
 		else if (_media_type == cmn::MediaType::Audio)
 		{
@@ -588,6 +644,22 @@ public:
 	}
 
 private:
+	// Copy the planes that refer to the AVFrame before modifying them
+	void DetachAVFrame()
+	{
+		if (_av_frame == nullptr)
+		{
+			return;
+		}
+
+		for (auto &item : _data_buffer)
+		{
+			item.second = std::make_shared<ov::Data>(item.second->GetData(), item.second->GetLength());
+		}
+
+		_av_frame = nullptr;
+	}
+
 	std::shared_ptr<const ov::Data> GetPlainData(int32_t plane) const
 	{
 		auto item = _data_buffer.find(plane);
@@ -623,6 +695,8 @@ private:
 
 	// Data plane, Data
 	std::map<int32_t, std::shared_ptr<ov::Data>> _data_buffer;
+	// If not nullptr, the planes of _data_buffer refer to the memory of this frame
+	std::shared_ptr<AVFrame> _av_frame;
 	cmn::MediaType _media_type = cmn::MediaType::Unknown;
 	int32_t _track_id = 0;
 	int64_t _pts = 0LL;
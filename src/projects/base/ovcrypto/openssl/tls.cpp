@@ -10,6 +10,26 @@
 
 #include <utility>
 
+#if defined(__linux__) && __has_include(<linux/tls.h>)
+#	include <linux/tls.h>
+#	include <netinet/tcp.h>
+#	if defined(TLS_1_3_VERSION) && (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+#		define OV_KERNEL_TLS_SUPPORTED 1
+#		include <openssl/kdf.h>
+#	endif
+#endif
+#if !defined(OV_KERNEL_TLS_SUPPORTED)
+#	define OV_KERNEL_TLS_SUPPORTED 0
+#endif
+#if OV_KERNEL_TLS_SUPPORTED
+#	ifndef SOL_TLS
+#		define SOL_TLS 282
+#	endif
+#	ifndef TCP_ULP
+#		define TCP_ULP 31
+#	endif
+#endif
+
 #include "./openssl_manager.h"
 
 #define OV_LOG_TAG "OpenSSL"
@@ -77,7 +97,7 @@ namespace ov
 		// Create BIO
 		result = result && PrepareBio();
 		// Create SSL
-		result = result && PrepareSsl(nullptr);
+		result = result && PrepareSsl(this);
 
 		if (result == false)
 		{
@@ -197,6 +217,37 @@ namespace ov
 		return result ? 1 : 0;
 	}
 
+	void Tls::TlsKeyLog(const SSL *ssl, const char *line)
+	{
+		auto tls = static_cast<Tls *>(SSL_get_app_data(ssl));
+
+		if (tls == nullptr)
+		{
+			return;
+		}
+
+		// <label> <client random> <secret> (NSS key log format)
+		auto tokens = ov::String(line).Split(" ");
+
+		if ((tokens.size() != 3) || (tokens[0] != "SERVER_TRAFFIC_SECRET_0"))
+		{
+			return;
+		}
+
+		long length = 0;
+		auto secret = ::OPENSSL_hexstr2buf(tokens[2].CStr(), &length);
+
+		if (secret == nullptr)
+		{
+			return;
+		}
+
+		tls->_server_traffic_secret = std::make_shared<ov::Data>(secret, length);
+
+		::OPENSSL_cleanse(secret, length);
+		::OPENSSL_free(secret);
+	}
+
 	int Tls::TlsCreate(BIO *b)
 	{
 		::BIO_set_shutdown(b, 0);
@@ -622,4 +673,162 @@ namespace ov
 
 		return true;
 	}
+
+#if OV_KERNEL_TLS_SUPPORTED
+	// RFC8446 - 7.1.  Key Schedule
+	// HKDF-Expand-Label(Secret, Label, "", Length)
+	static bool HkdfExpandLabel(const EVP_MD *md, const std::shared_ptr<const ov::Data> &secret, const char *label, uint8_t *output, size_t length)
+	{
+		ov::String full_label = "tls13 ";
+		full_label.Append(label);
+
+		// struct {
+		//     uint16 length = Length;
+		//     opaque label<7..255> = "tls13 " + Label;
+		//     opaque context<0..255> = Context;
+		// } HkdfLabel;
+		ov::Data hkdf_label;
+		ov::ByteStream stream(&hkdf_label);
+
+		stream.WriteBE16(static_cast<uint16_t>(length));
+		stream.Write8(static_cast<uint8_t>(full_label.GetLength()));
+		stream.Write(full_label.CStr(), full_label.GetLength());
+		stream.Write8(0);
+
+		TlsUniquePtr<EVP_PKEY_CTX, void, ::EVP_PKEY_CTX_free> context(::EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr));
+
+		return (context != nullptr) &&
+			   (::EVP_PKEY_derive_init(context) == 1) &&
+			   (::EVP_PKEY_CTX_hkdf_mode(context, EVP_PKEY_HKDEF_MODE_EXPAND_ONLY) == 1) &&
+			   (::EVP_PKEY_CTX_set_hkdf_md(context, md) == 1) &&
+			   (::EVP_PKEY_CTX_set1_hkdf_key(context, secret->GetDataAs<uint8_t>(), secret->GetLength()) == 1) &&
+			   (::EVP_PKEY_CTX_add1_hkdf_info(context, hkdf_label.GetDataAs<uint8_t>(), hkdf_label.GetLength()) == 1) &&
+			   (::EVP_PKEY_derive(context, output, &length) == 1);
+	}
+
+	template <typename Tcrypto_info>
+	static bool SetKernelTlsTxInfo(int socket_fd, Tcrypto_info *crypto_info)
+	{
+		if (::setsockopt(socket_fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0)
+		{
+			logtd("Could not attach TLS ULP to the socket #%d: %s", socket_fd, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			return false;
+		}
+
+		if (::setsockopt(socket_fd, SOL_TLS, TLS_TX, crypto_info, sizeof(*crypto_info)) != 0)
+		{
+			logtd("Could not set TLS_TX to the socket #%d: %s", socket_fd, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			return false;
+		}
+
+		return true;
+	}
+
+	template <typename Tcrypto_info>
+	static bool InstallKernelTlsTx(int socket_fd, uint16_t cipher_type, const EVP_MD *md, const std::shared_ptr<const ov::Data> &secret)
+	{
+		Tcrypto_info crypto_info = {};
+		// The nonce of TLS 1.3 is (salt + iv) XOR sequence number
+		uint8_t iv[sizeof(crypto_info.salt) + sizeof(crypto_info.iv)];
+
+		crypto_info.info.version = TLS_1_3_VERSION;
+		crypto_info.info.cipher_type = cipher_type;
+
+		bool result =
+			HkdfExpandLabel(md, secret, "key", crypto_info.key, sizeof(crypto_info.key)) &&
+			HkdfExpandLabel(md, secret, "iv", iv, sizeof(iv));
+
+		if (result)
+		{
+			::memcpy(crypto_info.salt, iv, sizeof(crypto_info.salt));
+			::memcpy(crypto_info.iv, iv + sizeof(crypto_info.salt), sizeof(crypto_info.iv));
+
+			// No record is sent with the application traffic key before (session tickets are disabled)
+			::memset(crypto_info.rec_seq, 0, sizeof(crypto_info.rec_seq));
+
+			result = SetKernelTlsTxInfo(socket_fd, &crypto_info);
+		}
+
+		::OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+		::OPENSSL_cleanse(iv, sizeof(iv));
+
+		return result;
+	}
+#endif	// OV_KERNEL_TLS_SUPPORTED
+
+	bool Tls::PrepareKernelTls()
+	{
+#if OV_KERNEL_TLS_SUPPORTED
+		OV_ASSERT2(_ssl != nullptr);
+
+		if (_ssl == nullptr)
+		{
+			return false;
+		}
+
+		::SSL_CTX_set_keylog_callback(_ssl_ctx, TlsKeyLog);
+
+		// Session tickets are sent with the application traffic key after the handshake,
+		// so the kernel could not know the sequence number of the next record
+		::SSL_set_num_tickets(_ssl, 0);
+
+		return true;
+#else	// OV_KERNEL_TLS_SUPPORTED
+		return false;
+#endif	// OV_KERNEL_TLS_SUPPORTED
+	}
+
+	bool Tls::EnableKernelTlsTx(int socket_fd)
+	{
+#if OV_KERNEL_TLS_SUPPORTED
+		OV_ASSERT2(_ssl != nullptr);
+
+		if ((_ssl == nullptr) || (::SSL_version(_ssl) != TLS1_3_VERSION) || (_server_traffic_secret == nullptr))
+		{
+			logtd("Kernel TLS is not available: only TLS 1.3 is supported");
+			return false;
+		}
+
+		auto cipher = ::SSL_get_current_cipher(_ssl);
+		bool result = false;
+
+		// The lower 16 bits of the id is the cipher suite of TLS 1.3
+		switch ((cipher != nullptr) ? (::SSL_CIPHER_get_id(cipher) & 0xFFFF) : 0)
+		{
+			case 0x1301:
+				// TLS_AES_128_GCM_SHA256
+				result = InstallKernelTlsTx<tls12_crypto_info_aes_gcm_128>(socket_fd, TLS_CIPHER_AES_GCM_128, ::EVP_sha256(), _server_traffic_secret);
+				break;
+
+			case 0x1302:
+				// TLS_AES_256_GCM_SHA384
+				result = InstallKernelTlsTx<tls12_crypto_info_aes_gcm_256>(socket_fd, TLS_CIPHER_AES_GCM_256, ::EVP_sha384(), _server_traffic_secret);
+				break;
+
+#	if defined(TLS_CIPHER_CHACHA20_POLY1305)
+			case 0x1303:
+				// TLS_CHACHA20_POLY1305_SHA256
+				result = InstallKernelTlsTx<tls12_crypto_info_chacha20_poly1305>(socket_fd, TLS_CIPHER_CHACHA20_POLY1305, ::EVP_sha256(), _server_traffic_secret);
+				break;
+#	endif	// defined(TLS_CIPHER_CHACHA20_POLY1305)
+
+			default:
+				logtd("Kernel TLS is not available: the cipher is not supported (%s)", (cipher != nullptr) ? ::SSL_CIPHER_get_name(cipher) : "(null)");
+				break;
+		}
+
+		// The secret is not needed any more
+		_server_traffic_secret = nullptr;
+
+		if (result)
+		{
+			// close_notify must not be encrypted by OpenSSL since the kernel has the sequence number now
+			::SSL_set_quiet_shutdown(_ssl, 1);
+		}
+
+		return result;
+#else	// OV_KERNEL_TLS_SUPPORTED
+		return false;
+#endif	// OV_KERNEL_TLS_SUPPORTED
+	}
 };	// namespace ov
@@ -153,6 +153,14 @@ namespace ov
 
 		bool GetKeySaltLen(unsigned long crypto_suite, size_t *key_len, size_t *salt_len) const;
 
+		// APIs related to kernel TLS (Linux only, TLS 1.3 only)
+		//
+		// PrepareKernelTls() must be called before the handshake to keep the traffic secret of the server.
+		// After the handshake, EnableKernelTlsTx() installs the transmit keys into the socket,
+		// and the kernel encrypts the data sent by send()/sendfile() from then on.
+		bool PrepareKernelTls();
+		bool EnableKernelTlsTx(int socket_fd);
+
 	protected:
 		static BIO_METHOD *PrepareBioMethod();
 
@@ -183,6 +191,7 @@ namespace ov
 		}
 
 		static int TlsVerify(X509_STORE_CTX *store, void *arg);
+		static void TlsKeyLog(const SSL *ssl, const char *line);
 
 		static int TlsCreate(BIO *b);
 		static long TlsCtrl(BIO *b, int cmd, long num, void *ptr);
@@ -197,5 +206,8 @@ namespace ov
 		TlsUniquePtr<BIO, int, ::BIO_free> _bio = nullptr;
 
 		TlsCallback _callback;
+
+		// SERVER_TRAFFIC_SECRET_0 of TLS 1.3 (Used for kernel TLS)
+		std::shared_ptr<ov::Data> _server_traffic_secret;
 	};
 }  // namespace ov
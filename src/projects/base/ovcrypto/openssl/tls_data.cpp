@@ -103,6 +103,9 @@ namespace ov
 				case SSL_ERROR_NONE:
 					logtd("Accepted");
 					_state = State::Accepted;
+
+					// Must be enabled before any application data is sent
+					EnableKernelTlsIfRequested();
 					break;
 
 				case SSL_ERROR_WANT_READ:
@@ -140,6 +143,13 @@ namespace ov
 			return false;
 		}
 
+		if (_kernel_tls_enabled)
+		{
+			// The kernel encrypts the data
+			*cipher_data = plain_data;
+			return true;
+		}
+
 		logtd("Trying to encrypt the data for TLS\n%s", plain_data->Dump(32).CStr());
 
 		size_t written_bytes = 0;
@@ -154,6 +164,46 @@ namespace ov
 		return false;
 	}
 
+	void TlsData::RequestKernelTls(int socket_fd, KernelTlsCallback kernel_tls_callback)
+	{
+		if (_state != State::WaitingForAccept)
+		{
+			// Too late - the handshake is already started or failed
+			return;
+		}
+
+		if (_tls.PrepareKernelTls())
+		{
+			_kernel_tls_socket = socket_fd;
+			_kernel_tls_callback = std::move(kernel_tls_callback);
+		}
+	}
+
+	void TlsData::EnableKernelTlsIfRequested()
+	{
+		if (_kernel_tls_socket < 0)
+		{
+			return;
+		}
+
+		if ((_kernel_tls_callback != nullptr) && (_kernel_tls_callback() == false))
+		{
+			logtd("Kernel TLS cannot be enabled for the socket #%d, TLS is processed by OpenSSL", _kernel_tls_socket);
+		}
+		else if (_tls.EnableKernelTlsTx(_kernel_tls_socket))
+		{
+			logtd("Kernel TLS is enabled for the socket #%d", _kernel_tls_socket);
+			_kernel_tls_enabled = true;
+		}
+		else
+		{
+			logtd("Could not enable kernel TLS for the socket #%d, TLS is processed by OpenSSL", _kernel_tls_socket);
+		}
+
+		_kernel_tls_socket = -1;
+		_kernel_tls_callback = nullptr;
+	}
+
 	ssize_t TlsData::OnTlsRead(ov::Tls *tls, void *buffer, size_t length)
 	{
 		if (_cipher_data == nullptr)
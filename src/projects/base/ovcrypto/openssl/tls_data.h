@@ -16,6 +16,8 @@ namespace ov
 	{
 	public:
 		using WriteCallback = std::function<ssize_t(const void *data, int64_t length)>;
+		// Returns false if the socket cannot be switched to kernel TLS (e.g. the handshake data is not sent yet)
+		using KernelTlsCallback = std::function<bool()>;
 
 		enum class Method
 		{
@@ -51,6 +53,17 @@ namespace ov
 		// cipher_data can be null even if successful (It indicates accepting a new client)
 		bool Encrypt(const std::shared_ptr<const Data> &plain_data, std::shared_ptr<const Data> *cipher_data);
 
+		// Requests kernel TLS offload (Linux only)
+		//
+		// The transmit keys are installed into the socket right after the handshake,
+		// then Encrypt() returns the plain data as is because the kernel encrypts the data.
+		// If the kernel or the cipher is not supported, the data is encrypted by OpenSSL as before.
+		void RequestKernelTls(int socket_fd, KernelTlsCallback kernel_tls_callback);
+		bool IsKernelTlsEnabled() const
+		{
+			return _kernel_tls_enabled;
+		}
+
 		size_t GetDataLength() const;
 		std::shared_ptr<const Data> GetData() const;
 
@@ -63,6 +76,8 @@ namespace ov
 		// Tls::Write() -> SSL_write() -> Tls::TlsWrite() -> BIO_get_data()::write_callback -> TlsData::OnTlsWrite()
 		ssize_t OnTlsWrite(Tls *tls, const void *data, size_t length);
 
+		void EnableKernelTlsIfRequested();
+
 		State _state = State::Invalid;
 
 		Tls _tls;
@@ -70,5 +85,9 @@ namespace ov
 		WriteCallback _write_callback;
 		std::shared_ptr<Data> _cipher_data;
 		std::shared_ptr<Data> _plain_data;
+
+		int _kernel_tls_socket = -1;
+		KernelTlsCallback _kernel_tls_callback;
+		std::atomic<bool> _kernel_tls_enabled{false};
 	};
 }  // namespace ov
\ No newline at end of file
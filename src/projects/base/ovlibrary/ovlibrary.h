@@ -30,9 +30,11 @@
 #include "./queue.h"
 #include "./random.h"
 #include "./regex.h"
+#include "./ring_queue.h"
 #include "./semaphore.h"
 #include "./singleton.h"
 #include "./stack_trace.h"
 #include "./stop_watch.h"
 #include "./string.h"
+#include "./timing_wheel.h"
 #include "./url.h"
\ No newline at end of file
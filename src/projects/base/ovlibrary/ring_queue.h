@@ -0,0 +1,363 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+
+#include "./dump_utilities.h"
+#include "./log.h"
+#include "./ovdata_structure.h"
+#include "./string.h"
+
+namespace ov
+{
+	enum class RingQueueType
+	{
+		// Only one thread calls Enqueue()
+		SingleProducer,
+		// Several threads may call Enqueue() at the same time
+		MultiProducer
+	};
+
+	// A bounded lock-free queue which is used to hand off items to one consumer thread.
+	//
+	// It has the same interface as ov::Queue, but:
+	//  - Enqueue() never takes a lock unless the consumer is waiting in Dequeue()
+	//  - The capacity is fixed. If the queue is full, Enqueue() drops the item and returns false
+	//  - Only one thread may call Dequeue()/Clear()
+	template <typename T, RingQueueType type = RingQueueType::MultiProducer>
+	class RingQueue
+	{
+	public:
+		static constexpr size_t DefaultCapacity = 1024;
+
+		RingQueue()
+			: RingQueue(nullptr)
+		{
+		}
+
+		RingQueue(const char *alias, size_t threshold = 0, int log_interval_in_msec = 5000, size_t capacity = DefaultCapacity)
+			: _threshold(threshold),
+			  _log_interval(log_interval_in_msec)
+		{
+			// Round up to the power of 2 to use a mask instead of modulo
+			size_t cell_count = 2;
+
+			while (cell_count < capacity)
+			{
+				cell_count <<= 1;
+			}
+
+			_mask = cell_count - 1;
+			_cells = std::make_unique<Cell[]>(cell_count);
+
+			for (size_t index = 0; index < cell_count; index++)
+			{
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+
+			SetAlias(alias);
+
+			auto shared_lock = std::shared_lock(_name_mutex);
+			logd("ov.RingQueue", "[%p] %s is created with capacity: %zu, threshold: %zu, interval: %d", this, _queue_name.CStr(), cell_count, threshold, log_interval_in_msec);
+		}
+
+		~RingQueue()
+		{
+			auto shared_lock = std::shared_lock(_name_mutex);
+			logd("ov.RingQueue", "[%p] %s is destroyed", this, _queue_name.CStr());
+		}
+
+		String GetAlias() const
+		{
+			auto shared_lock = std::shared_lock(_name_mutex);
+			return _queue_name;
+		}
+
+		void SetAlias(const char *alias)
+		{
+			auto lock_guard = std::lock_guard(_name_mutex);
+
+			if ((alias != nullptr) && (alias[0] != '\0'))
+			{
+				_queue_name = alias;
+			}
+			else
+			{
+				_queue_name.Format("RingQueue<%s>", Demangle(typeid(T).name()).CStr());
+			}
+
+			logd("ov.RingQueue", "[%p] The alias is changed to %s", this, _queue_name.CStr());
+		}
+
+		void SetThreshold(size_t threshold)
+		{
+			_threshold = threshold;
+			logd("ov.RingQueue", "[%p] The threshold is changed to %zu", this, threshold);
+		}
+
+		size_t GetCapacity() const
+		{
+			return _mask + 1;
+		}
+
+		bool Enqueue(const T &item)
+		{
+			return EnqueueInternal(item);
+		}
+
+		bool Enqueue(T &&item)
+		{
+			return EnqueueInternal(std::move(item));
+		}
+
+		// Timeout in milliseconds
+		std::optional<T> Dequeue(int timeout = Infinite)
+		{
+			if (_stop)
+			{
+				// Stop is requested
+				return {};
+			}
+
+			auto item = TryDequeue();
+
+			if (item.has_value() || (timeout == 0))
+			{
+				return item;
+			}
+
+			std::chrono::steady_clock::time_point expire =
+				(timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+			// Producers wake the consumer up only while it is waiting
+			_waiting_count++;
+
+			{
+				auto unique_lock = std::unique_lock(_wait_mutex);
+
+				_condition.wait_until(unique_lock, expire, [&]() -> bool {
+					if (_stop)
+					{
+						return true;
+					}
+
+					auto result = TryDequeue();
+					if (result.has_value())
+					{
+						// T may not be assignable
+						item.emplace(std::move(result.value()));
+						return true;
+					}
+
+					return false;
+				});
+			}
+
+			_waiting_count--;
+
+			return item;
+		}
+
+		bool IsEmpty() const
+		{
+			return Size() == 0;
+		}
+
+		// Consumer only
+		void Clear()
+		{
+			while (TryDequeue().has_value())
+			{
+			}
+		}
+
+		size_t Size() const
+		{
+			auto head = _head.load(std::memory_order_acquire);
+			auto tail = _tail.load(std::memory_order_acquire);
+
+			return (tail > head) ? (tail - head) : 0;
+		}
+
+		bool IsStopped() const
+		{
+			return _stop;
+		}
+
+		void Stop()
+		{
+			_stop = true;
+
+			auto lock_guard = std::lock_guard(_wait_mutex);
+			_condition.notify_all();
+		}
+
+	protected:
+		struct Cell
+		{
+			// If sequence == position, the cell is empty and can be written by the producer of the position
+			// If sequence == position + 1, the cell is filled and can be read by the consumer
+			std::atomic<size_t> sequence;
+			std::optional<T> value;
+		};
+
+		template <typename U>
+		bool EnqueueInternal(U &&item)
+		{
+			size_t position = _tail.load(std::memory_order_relaxed);
+			Cell *cell = nullptr;
+
+			while (true)
+			{
+				cell = &(_cells[position & _mask]);
+
+				auto sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if constexpr (type == RingQueueType::SingleProducer)
+					{
+						_tail.store(position + 1, std::memory_order_relaxed);
+						break;
+					}
+					else
+					{
+						if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+				}
+				else if (diff < 0)
+				{
+					// The consumer has not read the cell yet
+					OnFull();
+					return false;
+				}
+				else
+				{
+					// Another producer took the position
+					position = _tail.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->value.emplace(std::forward<U>(item));
+			cell->sequence.store(position + 1, std::memory_order_release);
+
+			CheckThreshold();
+
+			// The item must be visible before checking whether the consumer is waiting
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (_waiting_count > 0)
+			{
+				auto lock_guard = std::lock_guard(_wait_mutex);
+				_condition.notify_one();
+			}
+
+			return true;
+		}
+
+		std::optional<T> TryDequeue()
+		{
+			size_t position = _head.load(std::memory_order_relaxed);
+			Cell &cell = _cells[position & _mask];
+
+			auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+			if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1) < 0)
+			{
+				// Empty (or the producer is still writing the cell)
+				return {};
+			}
+
+			std::optional<T> value = std::move(cell.value);
+			cell.value.reset();
+
+			// Make the cell available to the producer of the next round
+			cell.sequence.store(position + _mask + 1, std::memory_order_release);
+			_head.store(position + 1, std::memory_order_release);
+
+			return value;
+		}
+
+		inline void CheckThreshold()
+		{
+			auto size = Size();
+			auto peak = _peak.load(std::memory_order_relaxed);
+
+			while ((peak < size) && (_peak.compare_exchange_weak(peak, size, std::memory_order_relaxed) == false))
+			{
+			}
+
+			auto threshold = _threshold.load(std::memory_order_relaxed);
+
+			if ((threshold > 0) && (size >= threshold) && CanLog())
+			{
+				auto shared_lock = std::shared_lock(_name_mutex);
+				logw("ov.RingQueue", "[%p] %s size has exceeded the threshold: queue: %zu, threshold: %zu, peak: %zu", this, _queue_name.CStr(), size, threshold, _peak.load());
+			}
+		}
+
+		inline void OnFull()
+		{
+			_drop_count++;
+
+			if (CanLog())
+			{
+				auto shared_lock = std::shared_lock(_name_mutex);
+				loge("ov.RingQueue", "[%p] %s is full, the item is dropped: capacity: %zu, dropped: %zu", this, _queue_name.CStr(), GetCapacity(), _drop_count.load());
+			}
+		}
+
+		// Only one producer logs in a log interval
+		inline bool CanLog()
+		{
+			auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			auto last_log_time = _last_log_time.load(std::memory_order_relaxed);
+
+			return ((now - last_log_time) >= _log_interval) &&
+				   _last_log_time.compare_exchange_strong(last_log_time, now, std::memory_order_relaxed);
+		}
+
+	private:
+		std::unique_ptr<Cell[]> _cells;
+		size_t _mask = 0;
+
+		// Keep the positions written by producers and consumer on different cache lines
+		alignas(64) std::atomic<size_t> _tail{0};
+		alignas(64) std::atomic<size_t> _head{0};
+
+		alignas(64) std::atomic<int> _waiting_count{0};
+		std::mutex _wait_mutex;
+		std::condition_variable _condition;
+		std::atomic<bool> _stop{false};
+
+		mutable std::shared_mutex _name_mutex;
+		String _queue_name;
+
+		std::atomic<size_t> _threshold{0};
+		std::atomic<size_t> _peak{0};
+		std::atomic<size_t> _drop_count{0};
+		std::atomic<int64_t> _last_log_time{0};
+		int _log_interval = 0;
+	};
+
+	template <typename T>
+	using SpscQueue = RingQueue<T, RingQueueType::SingleProducer>;
+
+	template <typename T>
+	using MpscQueue = RingQueue<T, RingQueueType::MultiProducer>;
+}  // namespace ov
@@ -0,0 +1,260 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "./assert.h"
+
+namespace ov
+{
+	// A hierarchical timing wheel to expire a lot of items (sessions, bindings, ...) which are refreshed frequently
+	//
+	// - Schedule()/Cancel() are O(1) regardless of the number of the items, and do not allocate memory when an item is rescheduled
+	// - The items are expired in the unit of a tick, so an item may expire up to 1 tick later than requested
+	// - Advance() returns the expired items in small batches, so the caller does not hold its locks for a long time
+	//
+	// Level 0 has SlotCount slots of 1 tick, level 1 has SlotCount slots of SlotCount ticks, and so on.
+	// When level 0 goes around, the items in the next slot of level 1 are moved to the lower level (cascade).
+	template <typename Tkey, typename Thash = std::hash<Tkey>>
+	class TimingWheel
+	{
+	public:
+		static constexpr int SlotBits = 6;
+		static constexpr size_t SlotCount = (1 << SlotBits);
+		static constexpr size_t LevelCount = 4;
+
+		// tick_in_ms: Resolution of the wheel
+		//             (With 100 ms, items up to 100 ms * 64^4 (about 19 days) later can be scheduled)
+		explicit TimingWheel(int64_t tick_in_ms = 100)
+			: _tick_in_ms(std::max(tick_in_ms, static_cast<int64_t>(1))),
+			  _start_time(std::chrono::steady_clock::now())
+		{
+		}
+
+		// Adds the key, or reschedules it if it is already scheduled
+		void Schedule(const Tkey &key, int64_t after_in_ms)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			auto &entry = _entry_map[key];
+
+			if (entry.key == nullptr)
+			{
+				// New entry (The address of the key in the map is not changed until it is erased)
+				entry.key = &(_entry_map.find(key)->first);
+			}
+			else
+			{
+				Unlink(&entry);
+			}
+
+			// Round up to the next tick to not expire early
+			uint64_t after_ticks = (std::max(after_in_ms, static_cast<int64_t>(0)) + _tick_in_ms - 1) / _tick_in_ms;
+			entry.expire_tick = GetTick(std::chrono::steady_clock::now()) + after_ticks;
+
+			Link(&entry);
+		}
+
+		bool Cancel(const Tkey &key)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			auto item = _entry_map.find(key);
+
+			if (item == _entry_map.end())
+			{
+				return false;
+			}
+
+			Unlink(&(item->second));
+			_entry_map.erase(item);
+
+			return true;
+		}
+
+		bool IsScheduled(const Tkey &key) const
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			return _entry_map.find(key) != _entry_map.end();
+		}
+
+		size_t GetCount() const
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			return _entry_map.size();
+		}
+
+		// Advances the wheel to now, and appends the expired keys to expired_list (up to max_count).
+		// If there are more expired keys, they are returned by the next call.
+		//
+		// Returns the number of the expired keys appended
+		size_t Advance(std::vector<Tkey> &expired_list, size_t max_count = SIZE_MAX)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			uint64_t target_tick = GetTick(std::chrono::steady_clock::now());
+			size_t count = 0;
+
+			while (true)
+			{
+				// Collect the expired entries of the current slot
+				auto &slot = _slots[0][_current_tick & (SlotCount - 1)];
+
+				while ((slot != nullptr) && (count < max_count))
+				{
+					auto entry = slot;
+					Unlink(entry);
+
+					OV_ASSERT2(entry->expire_tick <= _current_tick);
+
+					Tkey key = *(entry->key);
+					_entry_map.erase(key);
+
+					expired_list.push_back(std::move(key));
+					count++;
+				}
+
+				if ((count >= max_count) || (_current_tick >= target_tick))
+				{
+					break;
+				}
+
+				_current_tick++;
+				Cascade();
+			}
+
+			return count;
+		}
+
+	protected:
+		struct Entry
+		{
+			// Points to the key of _entry_map
+			const Tkey *key = nullptr;
+			uint64_t expire_tick = 0;
+
+			Entry **slot = nullptr;
+			Entry *prev = nullptr;
+			Entry *next = nullptr;
+		};
+
+		uint64_t GetTick(const std::chrono::steady_clock::time_point &time_point) const
+		{
+			auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(time_point - _start_time).count();
+
+			return static_cast<uint64_t>(std::max(elapsed, static_cast<decltype(elapsed)>(0))) / _tick_in_ms;
+		}
+
+		Entry **FindSlot(uint64_t expire_tick)
+		{
+			if (expire_tick <= _current_tick)
+			{
+				// Already expired - Expire it from the current slot
+				return &(_slots[0][_current_tick & (SlotCount - 1)]);
+			}
+
+			uint64_t delta = expire_tick - _current_tick;
+
+			for (size_t level = 0; level < LevelCount; level++)
+			{
+				if (delta < (static_cast<uint64_t>(1) << (SlotBits * (level + 1))))
+				{
+					return &(_slots[level][(expire_tick >> (SlotBits * level)) & (SlotCount - 1)]);
+				}
+			}
+
+			// Too far - Put it in the farthest slot, and it will be moved again when the slot is cascaded
+			size_t level = LevelCount - 1;
+			return &(_slots[level][((_current_tick >> (SlotBits * level)) - 1) & (SlotCount - 1)]);
+		}
+
+		void Link(Entry *entry)
+		{
+			auto slot = FindSlot(entry->expire_tick);
+
+			entry->slot = slot;
+			entry->prev = nullptr;
+			entry->next = *slot;
+
+			if (*slot != nullptr)
+			{
+				(*slot)->prev = entry;
+			}
+
+			*slot = entry;
+		}
+
+		void Unlink(Entry *entry)
+		{
+			if (entry->prev != nullptr)
+			{
+				entry->prev->next = entry->next;
+			}
+			else
+			{
+				*(entry->slot) = entry->next;
+			}
+
+			if (entry->next != nullptr)
+			{
+				entry->next->prev = entry->prev;
+			}
+
+			entry->slot = nullptr;
+			entry->prev = nullptr;
+			entry->next = nullptr;
+		}
+
+		// Moves the entries of the upper levels to the lower levels when the lower level goes around
+		void Cascade()
+		{
+			for (size_t level = 1; level < LevelCount; level++)
+			{
+				uint64_t lower_ticks = _current_tick >> (SlotBits * (level - 1));
+
+				if ((lower_ticks & (SlotCount - 1)) != 0)
+				{
+					// The lower level did not go around
+					break;
+				}
+
+				auto &slot = _slots[level][(_current_tick >> (SlotBits * level)) & (SlotCount - 1)];
+				auto entry = slot;
+				slot = nullptr;
+
+				while (entry != nullptr)
+				{
+					auto next = entry->next;
+
+					Link(entry);
+
+					entry = next;
+				}
+			}
+		}
+
+		const int64_t _tick_in_ms;
+		const std::chrono::steady_clock::time_point _start_time;
+
+		mutable std::mutex _mutex;
+
+		uint64_t _current_tick = 0;
+		std::array<std::array<Entry *, SlotCount>, LevelCount> _slots{};
+
+		std::unordered_map<Tkey, Entry, Thash> _entry_map;
+	};
+}  // namespace ov
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "client_socket.h"
 
+#include <numeric>
+
 #include "server_socket.h"
 #include "socket_private.h"
 
@@ -25,29 +27,18 @@ namespace ov
 
 		_local_address = (server_socket != nullptr) ? server_socket->GetLocalAddress() : nullptr;
 
-		// TODO(dimiden): (ClientSocketBlocking) Currently, 1 thread is created per socket, so blocking mode is used until implementing code that handles EAGAIN
-		// MakeNonBlocking();
-
-		ov::String queue_name;
-
-		queue_name.Format("ClientSocket #%d %s", socket.GetSocket(), remote_address.ToString().CStr());
-
-		if (server_socket != nullptr)
+#if !defined(__APPLE__)
+		// Data that cannot be sent immediately is queued and flushed when EPOLLOUT is raised.
+		// (The epoll wrapper for macOS does not support EPOLL_CTL_MOD, so blocking mode is used there)
+		if (GetType() == SocketType::Tcp)
 		{
-			queue_name.AppendFormat(" (of #%d)", server_socket->GetSocket().GetSocket());
+			MakeNonBlocking();
 		}
-
-		_dispatch_queue.SetAlias(queue_name);
+#endif	// !defined(__APPLE__)
 	}
 
 	ClientSocket::~ClientSocket()
 	{
-		OV_ASSERT(_is_thread_running, "The thread must not be running");
-
-		if (_is_thread_running)
-		{
-			StopDispatchThread(true);
-		}
 	}
 
 	bool ClientSocket::PrepareSocketOptions()
@@ -68,155 +59,452 @@ namespace ov
 			SetSockOpt<int>(SOL_TCP, TCP_KEEPCNT, 3);
 	}
 
-	bool ClientSocket::StartDispatchThread()
+	void ClientSocket::SetSendQueueSize(size_t high_water_mark)
 	{
-		if (_is_thread_running)
-		{
-			// Thread is already running
-			OV_ASSERT2(_is_thread_running == false);
-			return false;
-		}
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
 
-		_is_thread_running = true;
-		_force_stop = false;
+		_send_queue_high_water_mark = high_water_mark;
+	}
 
-		// To keep the shared_ptr from being released while DispatchThread() is called
-		auto that = GetSharedPtrAs<ClientSocket>();
-		_send_thread = std::thread(std::bind(&ClientSocket::DispatchThread, that));
-		pthread_setname_np(_send_thread.native_handle(), "ClientSocket");
-		_send_thread.detach();
+	size_t ClientSocket::GetSendQueueBytes() const
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
 
-		return true;
+		return _send_queue_bytes;
 	}
 
-	bool ClientSocket::StopDispatchThread(bool stop_immediately)
+	void ClientSocket::UpdateEpollEvents(bool want_write)
 	{
-		if (_is_thread_running == false)
+		// _send_queue_mutex must be locked by the caller
+		if (_server_socket->ModifyEpoll(this, static_cast<void *>(this), (_close_requested == false), want_write) == false)
 		{
-			// Thread is not running
-			OV_ASSERT2(_is_thread_running);
-			return false;
+			logtw("[%p] [#%d] Could not update epoll events (write: %s)", this, _socket.GetSocket(), want_write ? "true" : "false");
 		}
+	}
 
-		// Enqueue close command
-		_dispatch_queue.Enqueue(DispatchCommand::Type::Close);
+	ssize_t ClientSocket::SendOrEnqueue(const std::vector<std::shared_ptr<const Data>> &data_list, bool copy_on_enqueue)
+	{
+		std::shared_ptr<Error> error;
 
-		if (stop_immediately)
+		size_t iov_count = 0;
+		struct iovec iov_list[SOCKET_MAX_IOV_COUNT];
+		size_t length = 0;
+
+		for (const auto &data : data_list)
 		{
-			// Signal stop command
-			_force_stop = true;
-			_dispatch_queue.Stop();
+			length += data->GetLength();
 		}
 
-		return true;
-	}
+		{
+			std::lock_guard<std::mutex> lock(_send_queue_mutex);
 
-	bool ClientSocket::SendAsync(const ClientSocket::DispatchCommand &send_item)
-	{
-		// An item is dequeued successfully
-		auto data = send_item.data->GetDataAs<uint8_t>();
-		auto remained = send_item.data->GetLength();
-		size_t total_sent_bytes = 0ULL;
+			if (_close_requested || (GetState() != SocketState::Connected))
+			{
+				logtd("[%p] [#%d] Could not send data: the socket is closing", this, _socket.GetSocket());
+				return -1;
+			}
 
-		while (_force_stop == false)
-		{
-			// Wait for transmission up to CLIENT_SOCKET_SEND_TIMEOUT
-			// TODO(dimiden): (ClientSocketBlocking) Temporarily comment while processing as blocking
-			// if (send_item.IsExpired(CLIENT_SOCKET_SEND_TIMEOUT))
-			// {
-			// 	logtw("[%p] [#%d] Expired (%zu bytes sent)", this, _socket.GetSocket(), total_sent_bytes);
-			// 	return false;
-			// }
+			size_t offset = 0;
+
+			if (_send_queue.empty())
+			{
+				// Nothing is pending, so the data can be sent directly without copying
+				for (size_t index = 0; index < data_list.size();)
+				{
+					for (iov_count = 0; (iov_count < SOCKET_MAX_IOV_COUNT) && (index < data_list.size()); index++)
+					{
+						auto &data = data_list[index];
+
+						if (data->GetLength() > 0)
+						{
+							iov_list[iov_count].iov_base = const_cast<void *>(data->GetData());
+							iov_list[iov_count].iov_len = data->GetLength();
+							iov_count++;
+						}
+					}
 
-			auto sent_bytes = SendInternal(data, remained);
+					auto to_send = std::accumulate(iov_list, iov_list + iov_count, static_cast<size_t>(0), [](size_t sum, const struct iovec &iov) { return sum + iov.iov_len; });
+					auto sent_bytes = SendInternal(iov_list, iov_count);
 
-			if (sent_bytes < 0)
+					if (sent_bytes < 0)
+					{
+						return sent_bytes;
+					}
+
+					offset += static_cast<size_t>(sent_bytes);
+
+					if (static_cast<size_t>(sent_bytes) < to_send)
+					{
+						break;
+					}
+				}
+
+				if (offset == length)
+				{
+					return length;
+				}
+
+				if (_is_nonblock == false)
+				{
+					// SRT socket / blocking mode - SendInternal() does not return until all data is sent
+					return offset;
+				}
+
+				_last_send_time = std::chrono::steady_clock::now();
+			}
+			else if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _last_send_time).count() >= CLIENT_SOCKET_SEND_TIMEOUT)
 			{
-				// An error occurred
-				logtw("[%p] [#%d] Could not send data (%zu bytes sent)", this, _socket.GetSocket(), total_sent_bytes);
-				return false;
+				error = Error::CreateError("Socket", "The client did not receive data for %d ms (%zu bytes are queued)", CLIENT_SOCKET_SEND_TIMEOUT, _send_queue_bytes);
 			}
 
-			OV_ASSERT2(static_cast<ssize_t>(remained) >= sent_bytes);
+			if (error == nullptr)
+			{
+				auto remained = length - offset;
 
-			remained -= sent_bytes;
-			data += sent_bytes;
-			total_sent_bytes += sent_bytes;
+				// Partially sent data must be queued anyway to keep the stream consistent.
+				// The data is never dropped instead, since it may be a part of a message (HTTP header, chunk, ...)
+				// and the following data would break the framing of the stream.
+				if ((offset == 0) && ((_send_queue_bytes + remained) > _send_queue_high_water_mark))
+				{
+					error = Error::CreateError("Socket", "The send queue is full (%zu bytes are queued, high-water mark: %zu)", _send_queue_bytes, _send_queue_high_water_mark);
+				}
+				else
+				{
+					bool was_empty = _send_queue.empty();
 
-			if (remained == 0)
-			{
-				// All data are sent
-				break;
+					for (const auto &data : data_list)
+					{
+						auto data_length = data->GetLength();
+
+						if (offset >= data_length)
+						{
+							// Already sent
+							offset -= data_length;
+							continue;
+						}
+
+						if (copy_on_enqueue)
+						{
+							// Copy the remaining data only
+							_send_queue.emplace_back(std::make_shared<const Data>(data->GetDataAs<uint8_t>() + offset, data_length - offset), 0);
+						}
+						else
+						{
+							_send_queue.emplace_back(data, offset);
+						}
+
+						offset = 0;
+					}
+
+					_send_queue_bytes += remained;
+
+					if (was_empty)
+					{
+						// Wait until the socket becomes writable
+						UpdateEpollEvents(true);
+					}
+
+					logtd("[%p] [#%d] %zu bytes are queued (total: %zu bytes)", this, _socket.GetSocket(), remained, _send_queue_bytes);
+				}
 			}
 		}
 
-		return true;
+		if (error != nullptr)
+		{
+			// The client is too slow to receive data
+			logtw("[%p] [#%d] Disconnecting a slow client %s: %s", this, _socket.GetSocket(), ToString().CStr(), error->ToString().CStr());
+			_server_socket->DisconnectClient(GetSharedPtrAs<ClientSocket>(), SocketConnectionState::Error, error);
+			return -1;
+		}
+
+		return length;
 	}
 
-	void ClientSocket::DispatchThread()
+	bool ClientSocket::DispatchSendQueue()
 	{
-		bool stop = false;
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
 
-		while (stop == false)
-		{
-			auto item = _dispatch_queue.Dequeue();
+		_send_source_notified = false;
 
-			if (item.has_value() == false)
+		while (true)
+		{
+			if (_send_queue.empty())
 			{
-				if (_force_stop)
+				// Pull the next data only after the previous data is sent, so a slow client doesn't need a queue
+				std::vector<std::shared_ptr<const Data>> data_list;
+
+				if ((_send_source == nullptr) || _close_requested || (_send_source(data_list) == false) || data_list.empty())
 				{
 					break;
 				}
 
-				// Timed out
+				for (const auto &data : data_list)
+				{
+					if (data->GetLength() > 0)
+					{
+						_send_queue.emplace_back(data, 0);
+						_send_queue_bytes += data->GetLength();
+					}
+				}
+
+				_last_send_time = std::chrono::steady_clock::now();
+
 				continue;
 			}
 
-			auto &send_item = item.value();
+			auto &front = _send_queue.front();
 
-			switch (send_item.type)
+			if (front.file != nullptr)
 			{
-				case DispatchCommand::Type::Unknown:
-					OV_ASSERT2(false);
-					break;
+				auto remained = front.file->GetLength() - front.offset;
+				auto sent_bytes = SendFileInternal(front.file->GetFd(), front.file->GetOffset() + front.offset, remained);
 
-				case DispatchCommand::Type::SendData:
-					if (SendAsync(send_item) == false)
-					{
-						// Item is expired / Could not send data
+				if (sent_bytes < 0)
+				{
+					logtw("[%p] [#%d] Could not send queued file (%zu bytes remained)", this, _socket.GetSocket(), remained);
+					return false;
+				}
 
-						// Disconnect the client
-						stop = true;
-					}
+				if (sent_bytes > 0)
+				{
+					_last_send_time = std::chrono::steady_clock::now();
+				}
 
-					break;
+				if (static_cast<size_t>(sent_bytes) < remained)
+				{
+					front.offset += sent_bytes;
+					return true;
+				}
+
+				_send_queue.pop_front();
+				continue;
+			}
+
+			// Send the queued data at once as far as possible (until the next file)
+			struct iovec iov_list[SOCKET_MAX_IOV_COUNT];
+			size_t iov_count = 0;
+			size_t to_send = 0;
+
+			for (auto item = _send_queue.begin(); (item != _send_queue.end()) && (item->file == nullptr) && (iov_count < SOCKET_MAX_IOV_COUNT); ++item)
+			{
+				auto remained = item->data->GetLength() - item->offset;
+
+				iov_list[iov_count].iov_base = const_cast<uint8_t *>(item->data->GetDataAs<uint8_t>() + item->offset);
+				iov_list[iov_count].iov_len = remained;
+				iov_count++;
+
+				to_send += remained;
+			}
+
+			auto sent_bytes = SendInternal(iov_list, iov_count);
+
+			if (sent_bytes < 0)
+			{
+				logtw("[%p] [#%d] Could not send queued data (%zu bytes are queued)", this, _socket.GetSocket(), _send_queue_bytes);
+				return false;
+			}
+
+			if (sent_bytes > 0)
+			{
+				_last_send_time = std::chrono::steady_clock::now();
+			}
+
+			_send_queue_bytes -= sent_bytes;
+
+			// Remove the items that are sent
+			size_t remained_sent_bytes = sent_bytes;
 
-				case DispatchCommand::Type::Close:
-					logtd("[%p] [#%d] Trying to close the socket", this, _socket.GetSocket());
-					stop = true;
+			while ((_send_queue.empty() == false) && (remained_sent_bytes > 0))
+			{
+				auto &item = _send_queue.front();
+				auto remained = item.GetLength() - item.offset;
+
+				if (remained_sent_bytes < remained)
+				{
+					item.offset += remained_sent_bytes;
 					break;
+				}
+
+				remained_sent_bytes -= remained;
+				_send_queue.pop_front();
 			}
+
+			if (static_cast<size_t>(sent_bytes) < to_send)
+			{
+				// The send buffer is full again - wait for the next EPOLLOUT
+				return true;
+			}
+		}
+
+		logtd("[%p] [#%d] All queued data are sent", this, _socket.GetSocket());
+
+		if (_close_requested == false)
+		{
+			UpdateEpollEvents(false);
+		}
+
+		return true;
+	}
+
+	bool ClientSocket::RequestCloseAfterFlush()
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		if (_send_queue.empty())
+		{
+			return false;
 		}
 
-		[[maybe_unused]] auto sock = _socket.GetSocket();
+		_close_requested = true;
+
+		// Stop receiving data, and wait until the queued data is sent
+		UpdateEpollEvents(true);
+
+		return true;
+	}
 
-		Socket::CloseInternal();
+	bool ClientSocket::HasPendingData() const
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
 
-		logtd("[%p] [#%d] Thread is stopped, queue: %zu", this, sock, _dispatch_queue.Size());
+		return (_send_queue.empty() == false);
+	}
+
+	bool ClientSocket::IsSendQueueExpired() const
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		if (_send_queue.empty())
+		{
+			return false;
+		}
+
+		auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _last_send_time);
+
+		return (delta.count() >= CLIENT_SOCKET_SEND_TIMEOUT);
 	}
 
 	ssize_t ClientSocket::Send(const std::shared_ptr<const Data> &data)
 	{
-		logtd("[%p] [#%d] Trying to enqueue data: %zu...", this, _socket.GetSocket(), data->GetLength());
-		_dispatch_queue.Enqueue(data);
-		logtd("[%p] [#%d] Enqueued", this, _socket.GetSocket());
-		return data->GetLength();
+		return SendOrEnqueue({data}, false);
 	}
 
 	ssize_t ClientSocket::Send(const void *data, size_t length)
 	{
-		// TODO(dimiden): Consider sending a copy and storing it as a deep copy only if it fails to send
-		return Send(std::make_shared<const ov::Data>(data, length));
+		// The data is copied only if it cannot be sent immediately
+		return SendOrEnqueue({std::make_shared<const Data>(data, length, true)}, true);
+	}
+
+	ssize_t ClientSocket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		return SendOrEnqueue(data_list, false);
+	}
+
+	ssize_t ClientSocket::SendFile(const std::shared_ptr<const FileRange> &file)
+	{
+		if (file == nullptr)
+		{
+			OV_ASSERT2(file != nullptr);
+			return -1;
+		}
+
+		auto length = file->GetLength();
+
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		if (_close_requested || (GetState() != SocketState::Connected))
+		{
+			logtd("[%p] [#%d] Could not send a file: the socket is closing", this, _socket.GetSocket());
+			return -1;
+		}
+
+		size_t offset = 0;
+
+		if (_send_queue.empty())
+		{
+			auto sent_bytes = SendFileInternal(file->GetFd(), file->GetOffset(), length);
+
+			if (sent_bytes < 0)
+			{
+				return sent_bytes;
+			}
+
+			offset = static_cast<size_t>(sent_bytes);
+
+			if ((offset == length) || (_is_nonblock == false))
+			{
+				return offset;
+			}
+
+			_last_send_time = std::chrono::steady_clock::now();
+		}
+
+		// The file is already in the page cache or on the disk, so it doesn't need to be limited by the high-water mark
+		bool was_empty = _send_queue.empty();
+
+		_send_queue.emplace_back(file, offset);
+
+		if (was_empty)
+		{
+			UpdateEpollEvents(true);
+		}
+
+		logtd("[%p] [#%d] %zu bytes of a file are queued", this, _socket.GetSocket(), length - offset);
+
+		return length;
+	}
+
+	void ClientSocket::SetSendSource(const SendSource &source)
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		_send_source = source;
+		_send_source_notified = false;
+	}
+
+	SendSource ClientSocket::DetachSendSource()
+	{
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		auto source = std::move(_send_source);
+		_send_source = nullptr;
+
+		return source;
+	}
+
+	void ClientSocket::NotifySendSource()
+	{
+		std::vector<std::shared_ptr<const Data>> data_list;
+
+		{
+			std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+			if ((_send_source == nullptr) || _close_requested || (GetState() != SocketState::Connected))
+			{
+				return;
+			}
+
+			if (_is_nonblock)
+			{
+				if (_send_queue.empty() && (_send_source_notified == false))
+				{
+					// The data will be pulled by DispatchSendQueue()
+					_send_source_notified = true;
+					UpdateEpollEvents(true);
+				}
+
+				// Otherwise, the data will be pulled after the queued data is sent
+				return;
+			}
+
+			// Blocking mode - pull the data and send it in this thread
+			if (_send_source(data_list) == false)
+			{
+				return;
+			}
+		}
+
+		SendOrEnqueue(data_list, false);
 	}
 
 	ssize_t ClientSocket::Send(const ov::String &string, bool include_null_char)
@@ -229,8 +517,7 @@ namespace ov
 		if (GetState() != SocketState::Closed)
 		{
 			// 1) ServerSocket::DisconnectClient();
-			// 2) ClientSocket::CloseInternal();
-			// 3) ClientSocket::StopSendThread();
+			// 2) ClientSocket::CloseInternal() (after the queued data is sent)
 			return _server_socket->DisconnectClient(this->GetSharedPtrAs<ClientSocket>(), SocketConnectionState::Disconnect);
 		}
 
@@ -239,8 +526,20 @@ namespace ov
 
 	bool ClientSocket::CloseInternal()
 	{
-		// Socket::CloseInternal() will be called in SendThread() later
-		return StopDispatchThread(false);
+		std::lock_guard<std::mutex> lock(_send_queue_mutex);
+
+		if (_send_queue.empty() == false)
+		{
+			logtd("[%p] [#%d] %zu bytes in the send queue are discarded", this, _socket.GetSocket(), _send_queue_bytes);
+
+			_send_queue.clear();
+			_send_queue_bytes = 0;
+		}
+
+		_close_requested = true;
+		_send_source = nullptr;
+
+		return Socket::CloseInternal();
 	}
 
 	String ClientSocket::ToString() const
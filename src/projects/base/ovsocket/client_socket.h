@@ -8,6 +8,9 @@
 //==============================================================================
 #pragma once
 
+#include <deque>
+
+#include "file_range.h"
 #include "socket.h"
 
 namespace ov
@@ -29,6 +32,19 @@ namespace ov
 		ssize_t Send(const void *data, size_t length) override;
 
 		ssize_t Send(const ov::String &string, bool include_null_char = false);
+		// Sends the buffers in order with as few system calls as possible (the buffers are not copied)
+		ssize_t Send(const std::vector<std::shared_ptr<const Data>> &data_list);
+		// Sends the file with sendfile() after the data which is sent before (the file is not read into the memory)
+		// The rest of the file is queued if it cannot be sent immediately, and it is not counted in the send queue size
+		ssize_t SendFile(const std::shared_ptr<const FileRange> &file);
+
+		// The data is pulled from the source by the socket thread when the socket becomes writable,
+		// so the thread which makes the data doesn't need to send it to every client
+		void SetSendSource(const SendSource &source);
+		// Returns the source which is removed from the socket, to pull the rest of the data by the caller
+		SendSource DetachSendSource();
+		// Called when the source has new data
+		void NotifySendSource();
 
 		template <typename T>
 		bool Send(const T *data)
@@ -51,57 +67,68 @@ namespace ov
 
 		String ToString() const override;
 
+		// Outgoing queue settings (applied by ServerSocket when the client is accepted)
+		void SetSendQueueSize(size_t high_water_mark);
+		size_t GetSendQueueBytes() const;
+
 	protected:
-		struct DispatchCommand
+		struct SendItem
 		{
-			enum class Type
-			{
-				Unknown,
-				SendData,
-				Close
-			};
-
-			DispatchCommand(const std::shared_ptr<const ov::Data> &data)
-				: type(Type::SendData),
-				  data(data),
-				  enqueued_time(std::chrono::system_clock::now())
+			SendItem(const std::shared_ptr<const ov::Data> &data, size_t offset)
+				: data(data),
+				  offset(offset)
 			{
 			}
 
-			DispatchCommand(Type type)
-				: type(type),
-				  enqueued_time(std::chrono::system_clock::now())
+			SendItem(const std::shared_ptr<const FileRange> &file, size_t offset)
+				: file(file),
+				  offset(offset)
 			{
 			}
 
-			bool IsExpired(int millisecond_time) const
+			size_t GetLength() const
 			{
-				auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - enqueued_time);
-
-				return (delta.count() >= millisecond_time);
+				return (file != nullptr) ? file->GetLength() : data->GetLength();
 			}
 
-			Type type = Type::Unknown;
+			// One of data or file is used
 			std::shared_ptr<const ov::Data> data;
-			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
+			std::shared_ptr<const FileRange> file;
+			// Number of bytes already sent
+			size_t offset = 0;
 		};
 
-		bool StartDispatchThread();
-		bool StopDispatchThread(bool stop_immediately);
+		// Send data immediately if the queue is empty, and append the rest to the queue
+		// (If copy_on_enqueue is true, the rest of data is copied before queueing because the data is referenced only)
+		ssize_t SendOrEnqueue(const std::vector<std::shared_ptr<const Data>> &data_list, bool copy_on_enqueue);
+
+		// Called from ServerSocket when EPOLLOUT is raised
+		// Returns false if an error occurred while sending data
+		bool DispatchSendQueue();
+
+		// Returns true if there is data to send, and the socket will be closed after the data is flushed
+		bool RequestCloseAfterFlush();
+		bool HasPendingData() const;
+		// Returns true if the queued data has not been sent for CLIENT_SOCKET_SEND_TIMEOUT
+		bool IsSendQueueExpired() const;
 
-		bool SendAsync(const ClientSocket::DispatchCommand &send_item);
-		void DispatchThread();
+		void UpdateEpollEvents(bool want_write);
 
 		bool CloseInternal() override;
 
 		ServerSocket *_server_socket = nullptr;
 
-		// TODO(dimiden): If the receiver does not read the data, EAGAIN may occur continuously.
-		//                At this time, it can be blocked, so it creates a thread and processes it.
-		//                I know it's inefficient to use one thread per Socket, and I'll create a send pool later.
-		std::thread _send_thread;
-		ov::Queue<DispatchCommand> _dispatch_queue{nullptr, 100};
-		bool _is_thread_running = false;
+		mutable std::mutex _send_queue_mutex;
+		std::deque<SendItem> _send_queue;
+		size_t _send_queue_bytes = 0;
+		size_t _send_queue_high_water_mark = DefaultSendQueueSize;
+		// The last time the data in the queue was sent (used to detect stalled clients)
+		std::chrono::time_point<std::chrono::steady_clock> _last_send_time;
+		bool _close_requested = false;
+
+		SendSource _send_source;
+		// EPOLLOUT is requested to pull the data from _send_source
+		bool _send_source_notified = false;
 
 		std::shared_ptr<ClientSocket> _instance;
 	};
@@ -11,6 +11,10 @@
 #include "client_socket.h"
 #include "socket_private.h"
 
+#if !defined(__APPLE__)
+#	include <netinet/udp.h>
+#endif
+
 namespace ov
 {
 	bool DatagramSocket::Prepare(int port)
@@ -77,31 +81,42 @@ namespace ov
 				{
 					logtd("Trying to read UDP packets...");
 
-					while(true)
+					if(_recv_batch_size > 1)
 					{
-						std::shared_ptr<Data> data = std::make_shared<ov::Data>(UdpBufferSize);
-
-						// socket에서 이벤트 발생
-						std::shared_ptr<SocketAddress> remote;
-						std::shared_ptr<ov::Error> error = RecvFrom(data, &remote);
-
-						if(data->GetLength() > 0L)
-						{
-							data_callback(this->GetSharedPtrAs<DatagramSocket>(), *(remote.get()), data);
-						}
-
-						if(error != nullptr)
+						if(DispatchRecvBatch(data_callback) == false)
 						{
-							logtw("[#%d] An error occurred: %s", GetSocket(), error->ToString().CStr());
-							break;
+							_last_epoll_event_count = 0;
+							return false;
 						}
-						else
+					}
+					else
+					{
+						while(true)
 						{
-							if(data->GetLength() == 0L)
+							std::shared_ptr<Data> data = std::make_shared<ov::Data>(UdpBufferSize);
+
+							// socket에서 이벤트 발생
+							std::shared_ptr<SocketAddress> remote;
+							std::shared_ptr<ov::Error> error = RecvFrom(data, &remote);
+
+							if(data->GetLength() > 0L)
+							{
+								data_callback(this->GetSharedPtrAs<DatagramSocket>(), *(remote.get()), data);
+							}
+
+							if(error != nullptr)
 							{
-								// 다음 데이터를 기다려야 함
+								logtw("[#%d] An error occurred: %s", GetSocket(), error->ToString().CStr());
 								break;
 							}
+							else
+							{
+								if(data->GetLength() == 0L)
+								{
+									// 다음 데이터를 기다려야 함
+									break;
+								}
+							}
 						}
 					}
 
@@ -128,6 +143,393 @@ namespace ov
 		return true;
 	}
 
+	bool DatagramSocket::SetRecvBatch(int batch_size)
+	{
+#if defined(__APPLE__)
+		if(batch_size > 1)
+		{
+			logtw("[#%d] recvmmsg() is not supported on this platform. Datagrams will be received one by one", GetId());
+		}
+
+		_recv_batch_size = 0;
+
+		return (batch_size <= 1);
+#else   // defined(__APPLE__)
+		_recv_batch_size = std::min(batch_size, MaxRecvBatchSize);
+
+		logtd("[#%d] Receive batch size: %d", GetId(), _recv_batch_size.load());
+
+		return true;
+#endif  // defined(__APPLE__)
+	}
+
+	bool DatagramSocket::DispatchRecvBatch(const DatagramCallback &data_callback)
+	{
+#if defined(__APPLE__)
+		OV_ASSERT2(false);
+		return false;
+#else   // defined(__APPLE__)
+		int batch_size = _recv_batch_size;
+
+		if(static_cast<int>(_recv_buffers.size()) != batch_size)
+		{
+			_recv_buffers.resize(batch_size);
+			_recv_addresses.resize(batch_size);
+		}
+
+		struct mmsghdr messages[MaxRecvBatchSize];
+		struct iovec iovecs[MaxRecvBatchSize];
+
+		auto socket = this->GetSharedPtrAs<DatagramSocket>();
+
+		while(_force_stop == false)
+		{
+			for(int index = 0; index < batch_size; index++)
+			{
+				auto &buffer = _recv_buffers[index];
+
+				// If the callback kept the previous data, the buffer cannot be reused
+				if((buffer == nullptr) || (buffer.use_count() > 1))
+				{
+					buffer = std::make_shared<ov::Data>(UdpBufferSize);
+				}
+
+				buffer->SetLength(UdpBufferSize);
+
+				iovecs[index].iov_base = buffer->GetWritableData();
+				iovecs[index].iov_len = buffer->GetLength();
+
+				auto &message = messages[index];
+				::memset(&message, 0, sizeof(message));
+
+				message.msg_hdr.msg_name = &(_recv_addresses[index]);
+				message.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+				message.msg_hdr.msg_iov = &(iovecs[index]);
+				message.msg_hdr.msg_iovlen = 1;
+			}
+
+			int count = ::recvmmsg(_socket.GetSocket(), messages, batch_size, MSG_DONTWAIT, nullptr);
+
+			if(count < 0)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				if(error->GetCode() == EAGAIN)
+				{
+					// All datagrams are read
+					break;
+				}
+
+				logte("[#%d] An error occurred while read data: %s", GetId(), error->ToString().CStr());
+				SetState(SocketState::Error);
+				return false;
+			}
+
+			for(int index = 0; index < count; index++)
+			{
+				auto &buffer = _recv_buffers[index];
+
+				// Shrinking does not reallocate the buffer
+				buffer->SetLength(messages[index].msg_len);
+
+				if(messages[index].msg_len > 0)
+				{
+					data_callback(socket, SocketAddress(_recv_addresses[index]), buffer);
+				}
+			}
+
+			if(count < batch_size)
+			{
+				// Wait for the next event
+				break;
+			}
+		}
+
+		return true;
+#endif  // defined(__APPLE__)
+	}
+
+	bool DatagramSocket::SetSendBatch(int batch_size, bool use_gso)
+	{
+		std::lock_guard<std::mutex> lock_guard(_send_batch_mutex);
+
+		// Sends datagrams that queued with the previous setting
+		FlushSendBatchInternal();
+
+#if defined(__APPLE__)
+		if(batch_size > 1)
+		{
+			logtw("[#%d] sendmmsg() is not supported on this platform. Datagrams will be sent one by one", GetId());
+		}
+
+		_send_batch_size = 0;
+		_use_gso = false;
+
+		return (batch_size <= 1);
+#else   // defined(__APPLE__)
+		_send_batch_size = std::min(batch_size, MaxSendBatchSize);
+		_send_batch_count = 0;
+		_send_batch.resize(std::max(_send_batch_size.load(), 0));
+
+#	if defined(UDP_SEGMENT)
+		_use_gso = use_gso;
+#	else   // defined(UDP_SEGMENT)
+		if(use_gso)
+		{
+			logtw("[#%d] UDP GSO is not supported on this platform", GetId());
+		}
+		_use_gso = false;
+#	endif  // defined(UDP_SEGMENT)
+
+		logtd("[#%d] Send batch size: %d, GSO: %s", GetId(), _send_batch_size.load(), _use_gso ? "enabled" : "disabled");
+
+		return true;
+#endif  // defined(__APPLE__)
+	}
+
+	ssize_t DatagramSocket::SendTo(const ov::SocketAddress &address, const void *data, size_t length)
+	{
+		if(IsSendBatchEnabled() == false)
+		{
+			return Socket::SendTo(address, data, length);
+		}
+
+		std::unique_lock<std::mutex> lock_guard(_send_batch_mutex);
+
+		if((_send_batch_size <= 1) || (length > UdpBufferSize))
+		{
+			// Keep the order of datagrams
+			FlushSendBatchInternal();
+			lock_guard.unlock();
+
+			return Socket::SendTo(address, data, length);
+		}
+
+		if(_send_batch_count == 0)
+		{
+			_send_batch_first_queued_time = std::chrono::steady_clock::now();
+		}
+
+		auto &item = _send_batch[_send_batch_count];
+
+		::memcpy(&(item.address), address.Address(), address.AddressLength());
+		item.address_length = address.AddressLength();
+		::memcpy(item.data, data, length);
+		item.length = length;
+
+		_send_batch_count++;
+
+		if(_send_batch_count >= _send_batch_size)
+		{
+			FlushSendBatchInternal();
+		}
+
+		return static_cast<ssize_t>(length);
+	}
+
+	bool DatagramSocket::FlushSendBatch()
+	{
+		std::lock_guard<std::mutex> lock_guard(_send_batch_mutex);
+
+		return FlushSendBatchInternal();
+	}
+
+	bool DatagramSocket::FlushSendBatchInternal()
+	{
+		if(_send_batch_count == 0)
+		{
+			return true;
+		}
+
+#if defined(__APPLE__)
+		OV_ASSERT2(false);
+		_send_batch_count = 0;
+		return false;
+#else   // defined(__APPLE__)
+		struct mmsghdr messages[MaxSendBatchSize];
+		struct iovec iovecs[MaxSendBatchSize];
+#	if defined(UDP_SEGMENT)
+		// Control messages for UDP_SEGMENT
+		uint8_t controls[MaxSendBatchSize][CMSG_SPACE(sizeof(uint16_t))];
+#	endif  // defined(UDP_SEGMENT)
+
+		int message_count = 0;
+		int index = 0;
+
+		while(index < _send_batch_count)
+		{
+			auto &item = _send_batch[index];
+			auto &message = messages[message_count];
+
+			::memset(&message, 0, sizeof(message));
+
+			message.msg_hdr.msg_name = &(item.address);
+			message.msg_hdr.msg_namelen = item.address_length;
+			message.msg_hdr.msg_iov = &(iovecs[index]);
+
+			iovecs[index].iov_base = item.data;
+			iovecs[index].iov_len = item.length;
+
+			int segment_count = 1;
+			int next_index = index + 1;
+
+#	if defined(UDP_SEGMENT)
+			if(_use_gso)
+			{
+				// Consecutive datagrams to the same peer can be sent as one message,
+				// when all of them have the same size except the last one.
+				size_t total_length = item.length;
+
+				while((next_index < _send_batch_count) && (segment_count < MaxGsoSegmentCount))
+				{
+					auto &next_item = _send_batch[next_index];
+
+					if((next_item.length > item.length) ||
+						((total_length + next_item.length) > UINT16_MAX) ||
+						(next_item.address_length != item.address_length) ||
+						(::memcmp(&(next_item.address), &(item.address), item.address_length) != 0))
+					{
+						break;
+					}
+
+					iovecs[next_index].iov_base = next_item.data;
+					iovecs[next_index].iov_len = next_item.length;
+
+					total_length += next_item.length;
+					segment_count++;
+					next_index++;
+
+					if(next_item.length < item.length)
+					{
+						// Only the last segment can be smaller than the others
+						break;
+					}
+				}
+
+				if(segment_count > 1)
+				{
+					message.msg_hdr.msg_control = controls[message_count];
+					message.msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+					struct cmsghdr *control_message = CMSG_FIRSTHDR(&(message.msg_hdr));
+					control_message->cmsg_level = SOL_UDP;
+					control_message->cmsg_type = UDP_SEGMENT;
+					control_message->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+					*(reinterpret_cast<uint16_t *>(CMSG_DATA(control_message))) = static_cast<uint16_t>(item.length);
+
+					_send_batch_stats.gso_message_count++;
+				}
+			}
+#	endif  // defined(UDP_SEGMENT)
+
+			message.msg_hdr.msg_iovlen = segment_count;
+
+			message_count++;
+			index = next_index;
+		}
+
+		int sent_count = 0;
+
+		while((sent_count < message_count) && (_force_stop == false))
+		{
+			int result = ::sendmmsg(_socket.GetSocket(), messages + sent_count, message_count - sent_count, MSG_NOSIGNAL | (_is_nonblock ? MSG_DONTWAIT : 0));
+
+			_send_batch_stats.syscall_count++;
+
+			if(result > 0)
+			{
+				sent_count += result;
+				continue;
+			}
+
+			if(errno == EAGAIN)
+			{
+				// Same as Socket::SendTo()
+				continue;
+			}
+
+			auto &message = messages[sent_count];
+
+			if(message.msg_hdr.msg_controllen > 0)
+			{
+				// Kernel or NIC does not support UDP GSO (EIO/EINVAL)
+				logtw("[#%d] Could not send datagrams using UDP GSO (%s), GSO is disabled", GetId(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+				_use_gso = false;
+			}
+
+			// The message which caused the error is sent one by one, and then the rest are sent using sendmmsg() again
+			SendMessageInternal(message);
+			sent_count++;
+		}
+
+		auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _send_batch_first_queued_time).count();
+
+		_send_batch_stats.flush_count++;
+		_send_batch_stats.datagram_count += _send_batch_count;
+		_send_batch_stats.total_flush_latency_us += latency;
+		_send_batch_stats.max_flush_latency_us = std::max(_send_batch_stats.max_flush_latency_us, static_cast<uint64_t>(latency));
+
+		_send_batch_count = 0;
+
+		return (sent_count == message_count);
+#endif  // defined(__APPLE__)
+	}
+
+#if !defined(__APPLE__)
+	void DatagramSocket::SendMessageInternal(const struct mmsghdr &message)
+	{
+		for(size_t index = 0; index < message.msg_hdr.msg_iovlen; index++)
+		{
+			auto &iov = message.msg_hdr.msg_iov[index];
+
+			if(::sendto(_socket.GetSocket(), iov.iov_base, iov.iov_len, MSG_NOSIGNAL | (_is_nonblock ? MSG_DONTWAIT : 0),
+						 static_cast<const sockaddr *>(message.msg_hdr.msg_name), message.msg_hdr.msg_namelen) < 0)
+			{
+				logtd("[#%d] Could not send datagram: %s", GetId(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			}
+		}
+	}
+#endif  // !defined(__APPLE__)
+
+	SendBatchStats DatagramSocket::GetSendBatchStats() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_send_batch_mutex);
+
+		return _send_batch_stats;
+	}
+
+	bool DatagramSocket::Close()
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard(_send_batch_mutex);
+
+			// Queued datagrams are discarded
+			_send_batch_count = 0;
+			_send_batch_size = 0;
+		}
+
+		return Socket::Close();
+	}
+
+	String DatagramSocket::GetStat() const
+	{
+		auto stat = Socket::GetStat();
+
+		if(IsSendBatchEnabled())
+		{
+			auto stats = GetSendBatchStats();
+
+			stat.AppendFormat(
+				", Batch: %d (GSO: %s), Flushed: %" PRIu64 ", Datagrams: %" PRIu64 ", Syscalls: %" PRIu64 ", GSO messages: %" PRIu64
+				", Flush latency: %" PRIu64 "us (avg), %" PRIu64 "us (max)",
+				_send_batch_size.load(), _use_gso ? "Y" : "N",
+				stats.flush_count, stats.datagram_count, stats.syscall_count, stats.gso_message_count,
+				(stats.flush_count > 0) ? (stats.total_flush_latency_us / stats.flush_count) : static_cast<uint64_t>(0), stats.max_flush_latency_us);
+		}
+
+		return stat;
+	}
+
 	String DatagramSocket::ToString() const
 	{
 		return Socket::ToString("DatagramSocket");
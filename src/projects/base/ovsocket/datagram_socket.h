@@ -13,6 +13,29 @@
 
 namespace ov
 {
+	// The maximum number of datagrams sent with one sendmmsg() call
+	constexpr const int MaxSendBatchSize = 256;
+	// The maximum number of datagrams received with one recvmmsg() call
+	constexpr const int MaxRecvBatchSize = 256;
+	// The maximum number of segments that can be sent with one UDP GSO message (UDP_MAX_SEGMENTS of the kernel)
+	constexpr const int MaxGsoSegmentCount = 64;
+
+	struct SendBatchStats
+	{
+		// Number of batches sent
+		uint64_t flush_count = 0;
+		// Number of datagrams sent through the batch
+		uint64_t datagram_count = 0;
+		// Number of sendmmsg() calls
+		uint64_t syscall_count = 0;
+		// Number of messages sent using UDP GSO
+		uint64_t gso_message_count = 0;
+
+		// Time between the first datagram is queued and the batch is sent
+		uint64_t total_flush_latency_us = 0;
+		uint64_t max_flush_latency_us = 0;
+	};
+
 	class DatagramSocket : public Socket
 	{
 	public:
@@ -26,6 +49,35 @@ namespace ov
 
 		bool DispatchEvent(const DatagramCallback& data_callback, int timeout = Infinite);
 
+		/// Reads up to batch_size datagrams with one recvmmsg() call in DispatchEvent()
+		///
+		/// @param batch_size The number of datagrams to be received at once (batching is disabled if it is less than 2)
+		///
+		/// @return Whether batching is available on this platform
+		///
+		/// @remarks Datagrams are read into a ring of preallocated buffers. A buffer is reused only if the callback did not keep it,
+		///          so the callback can keep the data without copying it.
+		bool SetRecvBatch(int batch_size);
+
+		/// Queues outgoing datagrams and sends them with one sendmmsg() call
+		///
+		/// @param batch_size The number of datagrams to be sent at once (batching is disabled if it is less than 2)
+		/// @param use_gso Whether to merge consecutive datagrams to the same peer using UDP GSO (UDP_SEGMENT)
+		///
+		/// @return Whether batching is available on this platform
+		///
+		/// @remarks Queued datagrams are sent when the batch is full or FlushSendBatch() is called
+		bool SetSendBatch(int batch_size, bool use_gso);
+		bool IsSendBatchEnabled() const
+		{
+			return _send_batch_size > 1;
+		}
+
+		/// Sends queued datagrams
+		bool FlushSendBatch();
+
+		SendBatchStats GetSendBatchStats() const;
+
 		using Socket::Connect;
 		using Socket::GetState;
 		using Socket::Recv;
@@ -34,8 +86,45 @@ namespace ov
 		using Socket::SendTo;
 		using Socket::Close;
 
+		// If batching is enabled, data is copied to the batch and the length of data is returned
+		ssize_t SendTo(const ov::SocketAddress &address, const void *data, size_t length) override;
+
+		bool Close() override;
+
+		String GetStat() const override;
 		String ToString() const override;
 
 	protected:
+		// Returns false if an error occurred
+		bool DispatchRecvBatch(const DatagramCallback &data_callback);
+
+		struct SendBatchItem
+		{
+			sockaddr_storage address;
+			socklen_t address_length;
+
+			size_t length;
+			uint8_t data[UdpBufferSize];
+		};
+
+		bool FlushSendBatchInternal();
+#if !defined(__APPLE__)
+		// Sends the segments of the message one by one when sendmmsg() fails
+		void SendMessageInternal(const struct mmsghdr &message);
+#endif  // !defined(__APPLE__)
+
+		mutable std::mutex _send_batch_mutex;
+		std::vector<SendBatchItem> _send_batch;
+		std::atomic<int> _send_batch_size { 0 };
+		int _send_batch_count = 0;
+		bool _use_gso = false;
+		std::chrono::steady_clock::time_point _send_batch_first_queued_time;
+
+		SendBatchStats _send_batch_stats;
+
+		// Requested by SetRecvBatch(), and applied in DispatchEvent() because it may be called from another thread
+		std::atomic<int> _recv_batch_size { 0 };
+		std::vector<std::shared_ptr<Data>> _recv_buffers;
+		std::vector<sockaddr_storage> _recv_addresses;
 	};
 }
@@ -0,0 +1,101 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_range.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "socket_private.h"
+
+namespace ov
+{
+	FileRange::FileRange(int fd, off_t offset, size_t length)
+		: _fd(fd),
+		  _offset(offset),
+		  _length(length)
+	{
+	}
+
+	FileRange::FileRange(const std::shared_ptr<const FileRange> &file, off_t offset, size_t length)
+		: _file(file),
+		  _fd(file->GetFd()),
+		  _offset(offset),
+		  _length(length)
+	{
+	}
+
+	FileRange::~FileRange()
+	{
+		if ((_file == nullptr) && (_fd >= 0))
+		{
+			::close(_fd);
+		}
+	}
+
+	std::shared_ptr<FileRange> FileRange::Open(const ov::String &file_name)
+	{
+		int fd = ::open(file_name.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			logtw("Could not open %s: %s", file_name.CStr(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if (::fstat(fd, &file_stat) != 0)
+		{
+			logtw("Could not get the size of %s: %s", file_name.CStr(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			::close(fd);
+			return nullptr;
+		}
+
+		return std::make_shared<FileRange>(fd, 0, static_cast<size_t>(file_stat.st_size));
+	}
+
+	std::shared_ptr<ov::Data> FileRange::Read() const
+	{
+		auto data = std::make_shared<ov::Data>(_length);
+
+		if (data->SetLength(_length) == false)
+		{
+			return nullptr;
+		}
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t total_read = 0;
+
+		while (total_read < _length)
+		{
+			auto read_bytes = ::pread(_fd, buffer + total_read, _length - total_read, _offset + total_read);
+
+			if (read_bytes < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logtw("[#%d] Could not read the file: %s", _fd, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+				return nullptr;
+			}
+
+			if (read_bytes == 0)
+			{
+				logtw("[#%d] The file is shorter than expected: %zu bytes (expected: %zu bytes)", _fd, total_read, _length);
+				return nullptr;
+			}
+
+			total_read += read_bytes;
+		}
+
+		return data;
+	}
+}  // namespace ov
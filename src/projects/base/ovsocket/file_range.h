@@ -0,0 +1,57 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <sys/types.h>
+
+namespace ov
+{
+	// A range of a file which can be sent to a TCP socket without copying the data into the user space (using sendfile())
+	//
+	// The file descriptor is owned by the FileRange and closed when the last reference is released,
+	// so the data can be sent even if the file is unlinked in the meantime.
+	class FileRange
+	{
+	public:
+		// Takes the ownership of fd
+		FileRange(int fd, off_t offset, size_t length);
+		// Refers to a part of the file of another range (the file is kept open while this range is alive)
+		FileRange(const std::shared_ptr<const FileRange> &file, off_t offset, size_t length);
+		~FileRange();
+
+		// Opens the whole file
+		static std::shared_ptr<FileRange> Open(const ov::String &file_name);
+
+		int GetFd() const
+		{
+			return _fd;
+		}
+
+		off_t GetOffset() const
+		{
+			return _offset;
+		}
+
+		size_t GetLength() const
+		{
+			return _length;
+		}
+
+		// Reads the range into the memory (for the sockets that cannot use sendfile(), such as a TLS connection)
+		std::shared_ptr<ov::Data> Read() const;
+
+	protected:
+		// Owner of _fd if this range refers to a part of another range
+		std::shared_ptr<const FileRange> _file;
+
+		int _fd = -1;
+		off_t _offset = 0;
+		size_t _length = 0;
+	};
+}  // namespace ov
@@ -15,6 +15,7 @@
 // TCP socket
 #include "server_socket.h"
 #include "client_socket.h"
+#include "file_range.h"
 
 // UDP socket
 #include "datagram_socket.h"
\ No newline at end of file
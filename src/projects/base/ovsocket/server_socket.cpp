@@ -91,6 +91,27 @@ namespace ov
 			}
 		}
 
+		// Close the clients that could not send the queued data in time
+		std::vector<std::shared_ptr<ClientSocket>> expired_client_list;
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_client_list_mutex);
+
+			for (const auto &item : _closing_client_list)
+			{
+				if (item.second->IsSendQueueExpired())
+				{
+					expired_client_list.push_back(item.second);
+				}
+			}
+		}
+
+		for (const auto &client : expired_client_list)
+		{
+			logtw("[%p] [#%d] Could not send the queued data to client %s in time", this, _socket.GetSocket(), client->ToString().CStr());
+			CloseClosingClient(client);
+		}
+
 		// Garbage collection
 		{
 			std::lock_guard<std::shared_mutex> lock(_client_list_mutex);
@@ -118,7 +139,7 @@ namespace ov
 
 			if (client->PrepareSocketOptions())
 			{
-				client->StartDispatchThread();
+				client->SetSendQueueSize(_send_queue_high_water_mark);
 
 				_client_list_mutex.lock();
 				_client_list[client.get()] = client;
@@ -185,22 +206,39 @@ namespace ov
 	{
 		std::shared_ptr<ClientSocket> client = nullptr;
 		uint32_t epoll_events = event->events;
+		bool is_closing = false;
 
 		{
 			std::shared_lock<std::shared_mutex> lock(_client_list_mutex);
 			auto item = _client_list.find(key);
 
-			if (item == _client_list.end())
+			if (item != _client_list.end())
 			{
-				// If the client deleted from another thread as soon as the event occurs at epoll(), it enters here
-				logtd("[%p] [#%d] Could not find a client: %p", this, _socket.GetSocket(), key);
-				return;
+				client = item->second;
 			}
+			else
+			{
+				auto closing_item = _closing_client_list.find(key);
 
-			client = item->second;
+				if (closing_item == _closing_client_list.end())
+				{
+					// If the client deleted from another thread as soon as the event occurs at epoll(), it enters here
+					logtd("[%p] [#%d] Could not find a client: %p", this, _socket.GetSocket(), key);
+					return;
+				}
+
+				client = closing_item->second;
+				is_closing = true;
+			}
 		}
 
-		if (OV_CHECK_FLAG(epoll_events, EPOLLERR) || (!OV_CHECK_FLAG(epoll_events, EPOLLIN)))
+		if (is_closing)
+		{
+			DispatchClosingClient(client, event);
+			return;
+		}
+
+		if (OV_CHECK_FLAG(epoll_events, EPOLLERR) || ((epoll_events & (EPOLLIN | EPOLLOUT)) == 0))
 		{
 			// An error occurred while communiting with the client
 			auto error = Error::CreateError("Epoll", "%s", StringFromEpollEvent(event).CStr());
@@ -216,6 +254,24 @@ namespace ov
 		}
 		else
 		{
+			if (OV_CHECK_FLAG(epoll_events, EPOLLOUT))
+			{
+				// The socket is writable - send the queued data
+				if (client->DispatchSendQueue() == false)
+				{
+					auto error = Error::CreateError("Socket", "Could not send the queued data to client #%d", client->GetSocket().GetSocket());
+					logtd("[%p] [#%d] %s", this, _socket.GetSocket(), error->ToString().CStr());
+					DisconnectClient(client, SocketConnectionState::Error, error);
+					return;
+				}
+			}
+
+			if (OV_CHECK_FLAG(epoll_events, EPOLLIN) == false)
+			{
+				// Only EPOLLOUT is raised
+				return;
+			}
+
 			// Data is available that sent by the client
 			auto data = std::make_shared<Data>(TcpBufferSize);
 
@@ -282,6 +338,59 @@ namespace ov
 		}
 	}
 
+	void ServerSocket::DispatchClosingClient(const std::shared_ptr<ClientSocket> &client, const epoll_event *event)
+	{
+		uint32_t epoll_events = event->events;
+
+		if (OV_CHECK_FLAG(epoll_events, EPOLLERR) || OV_CHECK_FLAG(epoll_events, EPOLLHUP) || OV_CHECK_FLAG(epoll_events, EPOLLRDHUP))
+		{
+			logtd("[%p] [#%d] Client #%d is disconnected while sending the queued data: %s", this, _socket.GetSocket(), client->GetSocket().GetSocket(), StringFromEpollEvent(event).CStr());
+		}
+		else if (OV_CHECK_FLAG(epoll_events, EPOLLOUT))
+		{
+			if (client->DispatchSendQueue() && client->HasPendingData())
+			{
+				// Wait for the next EPOLLOUT
+				return;
+			}
+		}
+		else
+		{
+			// Only EPOLLOUT is requested for the closing client
+			return;
+		}
+
+		CloseClosingClient(client);
+	}
+
+	void ServerSocket::CloseClosingClient(const std::shared_ptr<ClientSocket> &client)
+	{
+		{
+			std::lock_guard<std::shared_mutex> lock(_client_list_mutex);
+
+			auto item = _closing_client_list.find(client.get());
+
+			if (item == _closing_client_list.end())
+			{
+				// Already closed
+				return;
+			}
+
+			// To keep ClientSocket pointer while DispatchEvent() is running
+			_disconnected_client_list[item->first] = item->second;
+			_closing_client_list.erase(item);
+		}
+
+		logtd("[%p] [#%d] Closing the client %s", this, _socket.GetSocket(), client->ToString().CStr());
+
+		RemoveFromEpoll(client.get());
+
+		if (client->GetState() != SocketState::Closed)
+		{
+			client->CloseInternal();
+		}
+	}
+
 	bool ServerSocket::Close()
 	{
 		_client_list_mutex.lock();
@@ -293,6 +402,15 @@ namespace ov
 			client.second->Close();
 		}
 
+		_client_list_mutex.lock();
+		auto closing_client_list = _closing_client_list;
+		_client_list_mutex.unlock();
+
+		for (const auto &client : closing_client_list)
+		{
+			CloseClosingClient(client.second);
+		}
+
 		return Socket::Close();
 	}
 
@@ -337,6 +455,17 @@ namespace ov
 				_connection_callback(client_socket->GetSharedPtrAs<ClientSocket>(), state, error);
 			}
 
+			if ((state == SocketConnectionState::Disconnect) && client_socket->RequestCloseAfterFlush())
+			{
+				// The socket will be closed after the queued data is sent (or CLIENT_SOCKET_SEND_TIMEOUT is expired)
+				logtd("[%p] [#%d] Waiting for the queued data to be sent to %s before closing...", this, _socket.GetSocket(), client_socket->ToString().CStr());
+
+				std::lock_guard<std::shared_mutex> lock(_client_list_mutex);
+				_closing_client_list[client_socket.get()] = client_socket;
+
+				return true;
+			}
+
 			if (RemoveFromEpoll(client_socket.get()))
 			{
 				if (client_socket->GetState() != SocketState::Closed)
@@ -364,6 +493,11 @@ namespace ov
 		return false;
 	}
 
+	void ServerSocket::SetSendQueueSize(size_t high_water_mark)
+	{
+		_send_queue_high_water_mark = high_water_mark;
+	}
+
 	bool ServerSocket::SetSocketOptions(SocketType type, int send_buffer_size, int recv_buffer_size)
 	{
 		// SRT socket is already non-block mode
@@ -11,6 +11,7 @@
 #include "socket.h"
 #include "socket_address.h"
 #include "socket_datastructure.h"
+#include <atomic>
 #include <shared_mutex>
 
 namespace ov
@@ -50,17 +51,28 @@ namespace ov
 		virtual bool DisconnectClient(std::shared_ptr<ClientSocket> client_socket, SocketConnectionState state, const std::shared_ptr<Error> &error = nullptr);
 		virtual bool DisconnectClient(ClientSocket *client_socket, SocketConnectionState state, const std::shared_ptr<Error> &error = nullptr);
 
+		// Limits the number of bytes queued for each client (applied to the clients accepted after calling this)
+		void SetSendQueueSize(size_t high_water_mark);
+
 	protected:
 		virtual bool SetSocketOptions(SocketType type, int send_buffer_size, int recv_buffer_size);
 
 		void DispatchAccept();
 		void DispatchEvents(const void *key, const epoll_event *event);
+		// Flush the queued data of the client that is waiting to be closed
+		void DispatchClosingClient(const std::shared_ptr<ClientSocket> &client, const epoll_event *event);
+		void CloseClosingClient(const std::shared_ptr<ClientSocket> &client);
 
 		std::shared_mutex _client_list_mutex;
 		std::map<const void *, std::shared_ptr<ClientSocket>> _client_list;
 		// To keep ClientSocket pointer while DispatchEvent() is running
 		// (In DispatchEvent(), the client_socket is not referenced as shared_ptr)
 		std::map<const void *, std::shared_ptr<ClientSocket>> _disconnected_client_list;
+		// Clients disconnected by the server, but still have data to send
+		std::map<const void *, std::shared_ptr<ClientSocket>> _closing_client_list;
+
+		// Can be changed while the clients are being accepted
+		std::atomic<size_t> _send_queue_high_water_mark{DefaultSendQueueSize};
 
 		ClientConnectionCallback _connection_callback = nullptr;
 		ClientDataCallback _data_callback = nullptr;
@@ -23,6 +23,7 @@
 /// 임시 코드
 #if !defined(__APPLE__)
 #	include <linux/sockios.h>
+#	include <sys/sendfile.h>
 #endif
 #include <sys/ioctl.h>
 
@@ -1099,6 +1100,53 @@ namespace ov
 		return true;
 	}
 
+	bool Socket::ModifyEpoll(Socket *socket, void *parameter, bool want_read, bool want_write)
+	{
+		CHECK_STATE(== SocketState::Listening, false);
+
+		switch (GetType())
+		{
+			case SocketType::Udp:
+			case SocketType::Tcp:
+			{
+#if defined(__APPLE__)
+				// The epoll wrapper for macOS does not support EPOLL_CTL_MOD
+				logte("[%p] [#%d] Modifying epoll events is not supported on this platform", this, _socket.GetSocket());
+				return false;
+#else	// defined(__APPLE__)
+				if (_epoll == InvalidSocket)
+				{
+					logte("[%p] [#%d] Invalid epoll descriptor: %d", this, _socket.GetSocket(), _epoll);
+					OV_ASSERT2(_epoll != InvalidSocket);
+					return false;
+				}
+
+				epoll_event event{};
+
+				event.data.ptr = parameter;
+				event.events = EPOLLERR | EPOLLHUP | EPOLLRDHUP;
+				event.events |= want_read ? EPOLLIN : 0;
+				event.events |= want_write ? EPOLLOUT : 0;
+
+				int result = ::epoll_ctl(_epoll, EPOLL_CTL_MOD, socket->_socket.GetSocket(), &event);
+
+				if (result == -1)
+				{
+					logte("[%p] [#%d] Could not modify epoll events for descriptor %d (result: %s)", this, _socket.GetSocket(), socket->_socket.GetSocket(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+					return false;
+				}
+
+				return true;
+#endif	// defined(__APPLE__)
+			}
+
+			default:
+				break;
+		}
+
+		return false;
+	}
+
 	std::shared_ptr<ov::SocketAddress> Socket::GetLocalAddress() const
 	{
 		return _local_address;
@@ -1209,10 +1257,10 @@ namespace ov
 
 					if (sent < 0L)
 					{
-						if (errno == EAGAIN)
+						if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
 						{
-							// Suppress 'Resource temporarily available' error
-							::usleep(100);
+							// The send buffer of the kernel is full - the caller is responsible for sending the rest later
+							// (ClientSocket queues the rest and waits for EPOLLOUT)
 							return total_sent;
 						}
 						else if (errno == EBADF)
@@ -1293,6 +1341,177 @@ namespace ov
 		return total_sent;
 	}
 
+	ssize_t Socket::SendInternal(struct iovec *iov_list, size_t iov_count)
+	{
+		size_t total_sent = 0;
+
+		if ((GetType() != SocketType::Tcp) || (iov_count == 1))
+		{
+			// SRT sends data in messages, so send the buffers one by one
+			for (size_t index = 0; index < iov_count; index++)
+			{
+				auto sent = SendInternal(iov_list[index].iov_base, iov_list[index].iov_len);
+
+				if (sent < 0L)
+				{
+					return sent;
+				}
+
+				total_sent += sent;
+
+				if (static_cast<size_t>(sent) < iov_list[index].iov_len)
+				{
+					break;
+				}
+			}
+
+			return total_sent;
+		}
+
+		logtd("[%p] [#%d] Trying to send %zu buffers...", this, _socket.GetSocket(), iov_count);
+
+		size_t index = 0;
+
+		while ((index < iov_count) && (_force_stop == false))
+		{
+			struct msghdr message = {};
+
+			message.msg_iov = iov_list + index;
+			message.msg_iovlen = std::min(iov_count - index, static_cast<size_t>(SOCKET_MAX_IOV_COUNT));
+
+			int sock = _socket.GetSocket();
+			ssize_t sent = ::sendmsg(sock, &message, MSG_NOSIGNAL | (_is_nonblock ? MSG_DONTWAIT : 0));
+
+			if (sent < 0L)
+			{
+				if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+				{
+					// The caller is responsible for sending the rest later
+					return total_sent;
+				}
+				else if ((errno != EBADF) && (errno != EPIPE))
+				{
+					logtw("[%p] [#%d] Could not send data: %zd (%s)", this, sock, sent, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+				}
+
+				return sent;
+			}
+
+			total_sent += sent;
+
+			// Skip the buffers that are sent
+			size_t remained = sent;
+
+			while ((remained > 0) && (index < iov_count))
+			{
+				auto &iov = iov_list[index];
+
+				if (remained >= iov.iov_len)
+				{
+					remained -= iov.iov_len;
+					index++;
+				}
+				else
+				{
+					iov.iov_base = static_cast<uint8_t *>(iov.iov_base) + remained;
+					iov.iov_len -= remained;
+					remained = 0;
+				}
+			}
+
+			// Skip empty buffers
+			while ((index < iov_count) && (iov_list[index].iov_len == 0))
+			{
+				index++;
+			}
+		}
+
+		logtd("[%p] [#%d] %zu bytes sent", this, _socket.GetSocket(), total_sent);
+
+		return total_sent;
+	}
+
+	ssize_t Socket::SendFileInternal(int fd, off_t offset, size_t length)
+	{
+		if (GetType() != SocketType::Tcp)
+		{
+			logtw("[%p] [#%d] sendfile() is supported for TCP sockets only", this, _socket.GetSocket());
+			return -1L;
+		}
+
+		logtd("[%p] [#%d] Trying to send file #%d (offset: %jd, length: %zu)...", this, _socket.GetSocket(), fd, static_cast<intmax_t>(offset), length);
+
+		size_t total_sent = 0;
+		int sock = _socket.GetSocket();
+
+		while ((total_sent < length) && (_force_stop == false))
+		{
+#if defined(__APPLE__)
+			off_t sent = static_cast<off_t>(length - total_sent);
+
+			if (::sendfile(fd, sock, offset, &sent, nullptr, 0) != 0)
+			{
+				if (((errno == EAGAIN) || (errno == EINTR)) && (sent > 0))
+				{
+					// Some bytes are sent before the error
+					errno = 0;
+				}
+				else
+				{
+					sent = -1L;
+				}
+			}
+			else if (sent == 0)
+			{
+				// The file is shorter than expected
+				errno = EINVAL;
+				sent = -1L;
+			}
+
+			if (sent > 0)
+			{
+				offset += sent;
+			}
+#else	// defined(__APPLE__)
+			// offset is updated by sendfile()
+			ssize_t sent = ::sendfile(sock, fd, &offset, length - total_sent);
+
+			if (sent == 0)
+			{
+				// The file is shorter than expected
+				errno = EINVAL;
+				sent = -1L;
+			}
+#endif	// defined(__APPLE__)
+
+			if (sent < 0L)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+				{
+					// The caller is responsible for sending the rest later
+					return total_sent;
+				}
+				else if ((errno != EBADF) && (errno != EPIPE))
+				{
+					logtw("[%p] [#%d] Could not send file #%d: %s", this, sock, fd, ov::Error::CreateErrorFromErrno()->ToString().CStr());
+				}
+
+				return -1L;
+			}
+
+			total_sent += sent;
+		}
+
+		logtd("[%p] [#%d] %zu bytes of file #%d sent", this, sock, total_sent, fd);
+
+		return total_sent;
+	}
+
 	ssize_t Socket::Send(const void *data, size_t length)
 	{
 		return SendInternal(data, length);
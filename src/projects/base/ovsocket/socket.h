@@ -61,6 +61,7 @@ int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout)
 #include <sys/epoll.h>
 #endif
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 #include <functional>
 #include <map>
@@ -72,6 +73,9 @@ int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout)
 #include <base/ovlibrary/semaphore.h>
 #include <srt/srt.h>
 
+// Maximum number of buffers passed to a sendmsg() call
+#define SOCKET_MAX_IOV_COUNT 64
+
 namespace ov
 {
 	// socket type
@@ -262,6 +266,8 @@ namespace ov
 		virtual int EpollWait(int timeout = Infinite);
 		virtual const epoll_event *EpollEvents(int index);
 		virtual bool RemoveFromEpoll(Socket *socket);
+		// Change the events of the socket that was added by AddToEpoll() (TCP/UDP only)
+		virtual bool ModifyEpoll(Socket *socket, void *parameter, bool want_read, bool want_write);
 
 		std::shared_ptr<SocketAddress> GetLocalAddress() const;
 		std::shared_ptr<SocketAddress> GetRemoteAddress() const;
@@ -346,6 +352,11 @@ namespace ov
 		static String StringFromEpollEvent(const epoll_event &event);
 
 		ssize_t SendInternal(const void *data, size_t length);
+		// Sends the buffers with a system call as far as possible (using sendmsg() for TCP)
+		// iov_list is modified while sending, and the return value is the same as SendInternal(data, length)
+		ssize_t SendInternal(struct iovec *iov_list, size_t iov_count);
+		// Sends a range of the file with sendfile() (TCP only), and the return value is the same as SendInternal(data, length)
+		ssize_t SendFileInternal(int fd, off_t offset, size_t length);
 		std::shared_ptr<ov::Error> RecvInternal(void *data, size_t length, size_t *received_length);
 		
 		virtual String ToString(const char *class_name) const;
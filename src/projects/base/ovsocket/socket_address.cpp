@@ -223,6 +223,44 @@ namespace ov
 		return (operator !=(socket)) && (operator <(socket) == false);
 	}
 
+	size_t SocketAddress::Hash() const noexcept
+	{
+		const uint8_t *address = nullptr;
+		size_t length = 0;
+		uint16_t port = 0;
+
+		switch(_address_storage.ss_family)
+		{
+			case AF_INET:
+				address = reinterpret_cast<const uint8_t *>(&(_address_ipv4->sin_addr));
+				length = sizeof(_address_ipv4->sin_addr);
+				port = _address_ipv4->sin_port;
+				break;
+
+			case AF_INET6:
+				address = reinterpret_cast<const uint8_t *>(&(_address_ipv6->sin6_addr));
+				length = sizeof(_address_ipv6->sin6_addr);
+				port = _address_ipv6->sin6_port;
+				break;
+
+			default:
+				return 0;
+		}
+
+		// FNV-1a (64 bits)
+		uint64_t hash = 14695981039346656037ULL;
+
+		for(size_t index = 0; index < length; index++)
+		{
+			hash = (hash ^ address[index]) * 1099511628211ULL;
+		}
+
+		hash = (hash ^ (port & 0xFF)) * 1099511628211ULL;
+		hash = (hash ^ (port >> 8)) * 1099511628211ULL;
+
+		return static_cast<size_t>(hash);
+	}
+
 	bool SocketAddress::SetHostname(const char *hostname)
 	{
 		// 문자열로 부터 IP를 계산함
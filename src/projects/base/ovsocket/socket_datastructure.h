@@ -43,6 +43,9 @@ namespace ov
 
 	typedef std::function<SocketConnectionState(const std::shared_ptr<ov::ClientSocket> &client, SocketConnectionState state, const std::shared_ptr<ov::Error> &error)> ClientConnectionCallback;
 	typedef std::function<SocketConnectionState(const std::shared_ptr<ov::ClientSocket> &client, const std::shared_ptr<Data> &data)> ClientDataCallback;
+	// Appends the data to send to data_list when the socket is writable
+	// Returns false if there is no data to send for now
+	typedef std::function<bool(std::vector<std::shared_ptr<const Data>> &data_list)> SendSource;
 
 	// for UDP socket
 	class DatagramSocket;
@@ -52,4 +55,7 @@ namespace ov
 
 	const ssize_t TcpBufferSize = 4096;
 	const ssize_t UdpBufferSize = 4096;
+
+	// Maximum number of bytes that can be queued per TCP client before the client is disconnected
+	const size_t DefaultSendQueueSize = 16 * 1024 * 1024;
 }  // namespace ov
@@ -340,6 +340,26 @@ namespace pub
 		return application_worker->PushNetworkPacket(std::static_pointer_cast<Session>(session_info), data);
 	}
 
+	std::shared_ptr<StreamExecutor> Application::GetStreamExecutor()
+	{
+		if (_publisher == nullptr)
+		{
+			return nullptr;
+		}
+
+		return _publisher->GetStreamExecutor();
+	}
+
+	PublisherType Application::GetPublisherType() const
+	{
+		if (_publisher == nullptr)
+		{
+			return PublisherType::Unknown;
+		}
+
+		return _publisher->GetPublisherType();
+	}
+
 	uint32_t Application::GetStreamCount()
 	{
 		return _streams.size();
@@ -105,6 +105,12 @@ namespace pub
 		std::shared_ptr<Stream> GetStream(uint32_t stream_id);
 		std::shared_ptr<Stream> GetStream(ov::String stream_name);
 
+		// Returns the executor shared by the streams of the publisher
+		std::shared_ptr<StreamExecutor> GetStreamExecutor();
+
+		// Returns the type of the publisher which the application belongs to
+		PublisherType GetPublisherType() const;
+
 		virtual bool Start();
 		virtual bool Stop();
 
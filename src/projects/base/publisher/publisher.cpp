@@ -34,10 +34,39 @@ namespace pub
 			it = _applications.erase(it);
 		}
 
+		lock.unlock();
+
+		std::lock_guard<std::mutex> executor_lock(_stream_executor_mutex);
+		if (_stream_executor != nullptr)
+		{
+			_stream_executor->Stop();
+			_stream_executor = nullptr;
+		}
+
 		logti("%s has been stopped.", GetPublisherName());
 		return true;
 	}
 
+	std::shared_ptr<StreamExecutor> Publisher::GetStreamExecutor()
+	{
+		std::lock_guard<std::mutex> lock(_stream_executor_mutex);
+
+		// Created when the first stream is created, since some publishers never have a stream
+		if (_stream_executor == nullptr)
+		{
+			auto executor = std::make_shared<StreamExecutor>(GetPublisherName());
+
+			if (executor->Start() == false)
+			{
+				return nullptr;
+			}
+
+			_stream_executor = executor;
+		}
+
+		return _stream_executor;
+	}
+
 	const cfg::Server &Publisher::GetServerConfig() const
 	{
 		return _server_config;
@@ -110,6 +110,9 @@ namespace pub
 			return std::static_pointer_cast<T>(GetStream(vhost_app_name, stream_name));
 		}
 
+		// The StreamWorkers of all streams of this publisher are run by this executor
+		std::shared_ptr<StreamExecutor> GetStreamExecutor();
+
 		uint32_t GetApplicationCount();
 		std::shared_ptr<Application> GetApplicationById(info::application_id_t application_id);
 		std::shared_ptr<Stream> GetStream(info::application_id_t application_id, uint32_t stream_id);
@@ -148,5 +151,9 @@ namespace pub
 
 		const cfg::Server _server_config;
 		std::shared_ptr<MediaRouteInterface> _router;
+
+	private:
+		std::mutex _stream_executor_mutex;
+		std::shared_ptr<StreamExecutor> _stream_executor;
 	};
 }  // namespace pub
\ No newline at end of file
@@ -4,10 +4,11 @@
 
 namespace pub
 {
-	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
+	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream, const std::shared_ptr<StreamExecutor> &executor)
 		: _packet_queue(nullptr, 500)
 	{
 		_stop_thread_flag = true;
+		_executor = executor;
 		_parent = parent_stream;
 	}
 
@@ -27,10 +28,8 @@ namespace pub
 
 		queue_name.Format("%s/%s/%s StreamWorker Queue", _parent->GetApplicationTypeName(), _parent->GetApplicationName(), _parent->GetName().CStr());
 		_packet_queue.SetAlias(queue_name.CStr());
-		
+
 		_stop_thread_flag = false;
-		_worker_thread = std::thread(&StreamWorker::WorkerThread, this);
-		pthread_setname_np(_worker_thread.native_handle(), "StreamWorker");
 
 		return true;
 	}
@@ -43,12 +42,11 @@ namespace pub
 		}
 
 		_stop_thread_flag = true;
-		// Generate Event
 		_packet_queue.Stop();
-		_queue_event.Notify();
-		if(_worker_thread.joinable())
+
 		{
-			_worker_thread.join();
+			// Wait for the executor to finish running this worker
+			std::lock_guard<std::mutex> run_lock(_run_mutex);
 		}
 
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
@@ -59,6 +57,9 @@ namespace pub
 		}
 		_sessions.clear();
 
+		// The subscribers are managed by the streams they belong to
+		_subscribers.clear();
+
 		return true;
 	}
 
@@ -100,6 +101,26 @@ namespace pub
 		return true;
 	}
 
+	bool StreamWorker::AddSubscriber(std::shared_ptr<Session> session)
+	{
+		if (_stop_thread_flag)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+		_subscribers[session->GetId()] = session;
+
+		return true;
+	}
+
+	bool StreamWorker::RemoveSubscriber(session_id_t id)
+	{
+		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+
+		return _subscribers.erase(id) > 0;
+	}
+
 	std::shared_ptr<Session> StreamWorker::GetSession(session_id_t id)
 	{
 		std::shared_lock<std::shared_mutex> lock(_session_map_mutex);
@@ -114,47 +135,58 @@ namespace pub
 
 	void StreamWorker::SendPacket(const std::any &packet)
 	{
+		if (_stop_thread_flag)
+		{
+			return;
+		}
+
 		_packet_queue.Enqueue(packet);
-		_queue_event.Notify();
+
+		Schedule();
 	}
 
-	std::any StreamWorker::PopStreamPacket()
+	void StreamWorker::Schedule()
 	{
-		if (_packet_queue.IsEmpty())
-		{
-			return nullptr;
-		}
-
-		auto data = _packet_queue.Dequeue();
-		if(data.has_value())
+		if (_scheduled.exchange(true) == false)
 		{
-			return data.value();
+			_executor->Post(GetSharedPtr());
 		}
-
-		return nullptr;
 	}
 
-	void StreamWorker::WorkerThread()
+	void StreamWorker::Run()
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
-
-		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
+			std::lock_guard<std::mutex> run_lock(_run_mutex);
 
-			auto packet = PopStreamPacket();
-			if (!packet.has_value())
+			// Send a limited number of packets at a time, so that the workers of other streams are not starved
+			for (int count = 0; (count < MAX_STREAM_WORKER_PACKETS_PER_RUN) && (_stop_thread_flag == false); count++)
 			{
-				continue;
+				auto packet = _packet_queue.Dequeue(0);
+				if (packet.has_value() == false)
+				{
+					break;
+				}
+
+				std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+				for (auto const &x : _sessions)
+				{
+					auto session = std::static_pointer_cast<Session>(x.second);
+					session->SendOutgoingData(packet.value());
+				}
+
+				for (auto const &x : _subscribers)
+				{
+					x.second->SendOutgoingData(packet.value());
+				}
 			}
-			
-			session_lock.lock();
-			for (auto const &x : _sessions)
-			{
-				auto session = std::static_pointer_cast<Session>(x.second);
-				session->SendOutgoingData(packet);
-			}
-			session_lock.unlock();
+
+			_scheduled = false;
+		}
+
+		// Packets may have been queued after the last Dequeue() without scheduling this worker
+		if ((_stop_thread_flag == false) && (_packet_queue.IsEmpty() == false))
+		{
+			Schedule();
 		}
 	}
 
@@ -200,21 +232,29 @@ namespace pub
 	bool Stream::CreateStreamWorker(uint32_t worker_count)
 	{
 		std::unique_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
-		
+
 		if (worker_count > MAX_STREAM_WORKER_THREAD_COUNT)
 		{
 			worker_count = MAX_STREAM_WORKER_THREAD_COUNT;
 		}
 
+		// The workers are run by the threads shared by all streams of the publisher
+		auto executor = (GetApplication() != nullptr) ? GetApplication()->GetStreamExecutor() : nullptr;
+		if (executor == nullptr)
+		{
+			logte("Could not get the stream executor of [%s(%u)] stream", GetName().CStr(), GetId());
+			return false;
+		}
+
 		_worker_count = worker_count;
-		// Create WorkerThread
+		// Create StreamWorker
 		for (uint32_t i = 0; i < _worker_count; i++)
 		{
-			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr());
-						
+			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr(), executor);
+
 			if (stream_worker->Start() == false)
 			{
-				logte("Cannot create stream thread (%d)", i);
+				logte("Cannot create stream worker (%d)", i);
 				Stop();
 
 				return false;
@@ -319,6 +359,31 @@ namespace pub
 		return true;
 	}
 
+	bool Stream::AddSubscriber(std::shared_ptr<Session> session)
+	{
+		if ((_state != State::STARTED) || (_worker_count == 0))
+		{
+			return false;
+		}
+
+		auto worker = GetWorkerBySessionID(session->GetId());
+
+		return (worker != nullptr) ? worker->AddSubscriber(session) : false;
+	}
+
+	bool Stream::RemoveSubscriber(session_id_t id)
+	{
+		// The subscribers are removed when the workers are stopped
+		if ((_state != State::STARTED) || (_worker_count == 0))
+		{
+			return false;
+		}
+
+		auto worker = GetWorkerBySessionID(id);
+
+		return (worker != nullptr) ? worker->RemoveSubscriber(id) : false;
+	}
+
 	std::shared_ptr<Session> Stream::GetSession(session_id_t id)
 	{
 		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
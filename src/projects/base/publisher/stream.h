@@ -5,15 +5,21 @@
 #include "base/info/stream.h"
 #include "base/mediarouter/media_buffer.h"
 #include "session.h"
+#include "stream_executor.h"
 
+// Maximum number of session shards of a stream
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
+// Maximum number of packets a StreamWorker sends at a time before yielding the executor thread to other workers
+#define MAX_STREAM_WORKER_PACKETS_PER_RUN 32
 
 namespace pub
 {
-	class StreamWorker
+	// A shard of the sessions of a stream.
+	// It does not have its own thread; it is run by the StreamExecutor of the publisher when packets are queued.
+	class StreamWorker : public ov::EnableSharedFromThis<StreamWorker>
 	{
 	public:
-		StreamWorker(const std::shared_ptr<Stream> &parent_stream);
+		StreamWorker(const std::shared_ptr<Stream> &parent_stream, const std::shared_ptr<StreamExecutor> &executor);
 		~StreamWorker();
 
 		bool Start();
@@ -23,21 +29,34 @@ namespace pub
 		bool RemoveSession(session_id_t id);
 		std::shared_ptr<Session> GetSession(session_id_t id);
 
+		// A subscriber is a session of another stream which also receives the packets of this stream.
+		// Unlike the sessions, the subscribers are not stopped when the worker is stopped.
+		bool AddSubscriber(std::shared_ptr<Session> session);
+		bool RemoveSubscriber(session_id_t id);
+
 		void SendPacket(const std::any &packet);
 
+		// Called by StreamExecutor
+		void Run();
+
 	private:
-		void WorkerThread();
+		// Posts this worker to the executor if it is not already scheduled
+		void Schedule();
 
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
+		std::map<session_id_t, std::shared_ptr<Session>> _subscribers;
 		std::shared_mutex _session_map_mutex;
-		ov::Semaphore _queue_event;
 
-		std::any PopStreamPacket();
 		ov::Queue<std::any> _packet_queue;
 
-		bool _stop_thread_flag;
-		std::thread _worker_thread;
+		// true while the worker is in a run queue of the executor or is running
+		std::atomic<bool> _scheduled{false};
+		// Prevents Stop() from returning while the worker is running
+		std::mutex _run_mutex;
 
+		std::atomic<bool> _stop_thread_flag;
+
+		std::shared_ptr<StreamExecutor> _executor;
 		std::shared_ptr<Stream> _parent;
 	};
 
@@ -62,6 +81,12 @@ namespace pub
 		const std::map<session_id_t, std::shared_ptr<Session>> GetAllSessions();
 		uint32_t GetSessionCount();
 
+		// Lets a session of another stream receive the packets of this stream (e.g. switching renditions of the same source)
+		//
+		// Must not be called in SendOutgoingData() of a session, since it waits for the StreamWorker which is running.
+		bool AddSubscriber(std::shared_ptr<Session> session);
+		bool RemoveSubscriber(session_id_t id);
+
 		// A child call this function to delivery packet to all sessions
 		bool BroadcastPacket(const std::any &packet);
 
@@ -0,0 +1,243 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stream_executor.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "publisher_private.h"
+#include "stream.h"
+
+namespace pub
+{
+	// The executor and the run queue index of the current thread, if the thread belongs to an executor
+	static thread_local StreamExecutor *_current_executor = nullptr;
+	static thread_local uint32_t _current_queue_index = 0;
+
+	StreamExecutor::StreamExecutor(const ov::String &name)
+		: _name(name)
+	{
+	}
+
+	StreamExecutor::~StreamExecutor()
+	{
+		Stop();
+	}
+
+	bool StreamExecutor::Start(uint32_t thread_count)
+	{
+		if (_stop_thread_flag == false)
+		{
+			return true;
+		}
+
+		// The cores which the process is allowed to run on (cpuset of the container, taskset, etc.)
+		std::vector<int> cores;
+
+#if !defined(__APPLE__)
+		cpu_set_t allowed_cpu_set;
+		CPU_ZERO(&allowed_cpu_set);
+
+		if (::sched_getaffinity(0, sizeof(allowed_cpu_set), &allowed_cpu_set) == 0)
+		{
+			for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+			{
+				if (CPU_ISSET(cpu, &allowed_cpu_set))
+				{
+					cores.push_back(cpu);
+				}
+			}
+		}
+		else
+		{
+			logtw("Could not get the CPU affinity of the process, the threads of %s stream executor are not pinned", _name.CStr());
+		}
+#endif	// !defined(__APPLE__)
+
+		uint32_t core_count = cores.empty() ? std::max(std::thread::hardware_concurrency(), 1U) : static_cast<uint32_t>(cores.size());
+
+		if (thread_count == 0)
+		{
+			thread_count = core_count;
+		}
+
+		thread_count = std::min(thread_count, static_cast<uint32_t>(MAX_STREAM_EXECUTOR_THREAD_COUNT));
+
+		_thread_count = thread_count;
+		_stop_thread_flag = false;
+
+		_run_queues.clear();
+		for (uint32_t index = 0; index < _thread_count; index++)
+		{
+			_run_queues.push_back(std::make_unique<RunQueue>());
+		}
+
+		for (uint32_t index = 0; index < _thread_count; index++)
+		{
+			try
+			{
+				_threads.emplace_back(&StreamExecutor::WorkerThread, this, index);
+			}
+			catch (const std::system_error &e)
+			{
+				logte("Could not create a thread of %s stream executor (%u): %s", _name.CStr(), index, e.what());
+				Stop();
+
+				return false;
+			}
+
+			auto &thread = _threads.back();
+
+			pthread_setname_np(thread.native_handle(), "StreamWorker");
+
+#if !defined(__APPLE__)
+			if (cores.empty() == false)
+			{
+				int core = cores[index % cores.size()];
+
+				cpu_set_t cpu_set;
+				CPU_ZERO(&cpu_set);
+				CPU_SET(core, &cpu_set);
+
+				if (::pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) != 0)
+				{
+					logtw("Could not pin the thread of %s stream executor to the core %d", _name.CStr(), core);
+				}
+			}
+#endif	// !defined(__APPLE__)
+		}
+
+		logti("%s stream executor has been started with %u threads", _name.CStr(), _thread_count);
+
+		return true;
+	}
+
+	bool StreamExecutor::Stop()
+	{
+		if (_stop_thread_flag.exchange(true))
+		{
+			return true;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_idle_mutex);
+			_idle_condition.notify_all();
+		}
+
+		for (auto &thread : _threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+
+		_threads.clear();
+
+		// Release the workers left in the run queues
+		for (auto &run_queue : _run_queues)
+		{
+			std::lock_guard<std::mutex> lock(run_queue->mutex);
+			run_queue->workers.clear();
+		}
+		_pending_count = 0;
+
+		logti("%s stream executor has been stopped", _name.CStr());
+
+		return true;
+	}
+
+	void StreamExecutor::Post(const std::shared_ptr<StreamWorker> &worker)
+	{
+		if (_stop_thread_flag)
+		{
+			return;
+		}
+
+		// A worker posted by a thread of the executor stays in the run queue of that thread (it is probably hot in the cache).
+		// The others are distributed to the run queues in turn.
+		uint32_t index = (_current_executor == this) ? _current_queue_index : (_next_queue_index++ % _thread_count);
+
+		{
+			auto &run_queue = _run_queues[index];
+
+			std::lock_guard<std::mutex> lock(run_queue->mutex);
+
+			// Counted before the worker can be popped, so the count never goes below zero
+			_pending_count++;
+			run_queue->workers.push_back(worker);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_idle_mutex);
+		}
+		_idle_condition.notify_one();
+	}
+
+	std::shared_ptr<StreamWorker> StreamExecutor::PopWorker(uint32_t index)
+	{
+		for (uint32_t i = 0; i < _thread_count; i++)
+		{
+			auto &run_queue = _run_queues[(index + i) % _thread_count];
+
+			std::lock_guard<std::mutex> lock(run_queue->mutex);
+
+			if (run_queue->workers.empty())
+			{
+				continue;
+			}
+
+			std::shared_ptr<StreamWorker> worker;
+
+			if (i == 0)
+			{
+				// Own run queue - in order of posting
+				worker = std::move(run_queue->workers.front());
+				run_queue->workers.pop_front();
+			}
+			else
+			{
+				// Steal from the opposite end to avoid contending with the owner
+				worker = std::move(run_queue->workers.back());
+				run_queue->workers.pop_back();
+			}
+
+			_pending_count--;
+
+			return worker;
+		}
+
+		return nullptr;
+	}
+
+	void StreamExecutor::WorkerThread(uint32_t index)
+	{
+		_current_executor = this;
+		_current_queue_index = index;
+
+		while (_stop_thread_flag == false)
+		{
+			auto worker = PopWorker(index);
+
+			if (worker == nullptr)
+			{
+				std::unique_lock<std::mutex> lock(_idle_mutex);
+
+				_idle_condition.wait(lock, [this]() -> bool {
+					return _stop_thread_flag || (_pending_count > 0);
+				});
+
+				continue;
+			}
+
+			worker->Run();
+		}
+
+		_current_executor = nullptr;
+	}
+}  // namespace pub
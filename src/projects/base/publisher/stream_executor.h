@@ -0,0 +1,76 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define MAX_STREAM_EXECUTOR_THREAD_COUNT 72
+
+namespace pub
+{
+	class StreamWorker;
+
+	// Runs the StreamWorkers of all streams of a publisher on a fixed number of threads.
+	//
+	// Each thread is pinned to one of the cores allowed for the process (sched_getaffinity) and has its own run queue.
+	// An idle thread steals StreamWorkers from the run queues of the other threads,
+	// so the shards of a busy stream are spread to the idle cores.
+	class StreamExecutor
+	{
+	public:
+		StreamExecutor(const ov::String &name);
+		~StreamExecutor();
+
+		// If thread_count is 0, as many threads as the number of cores are created
+		bool Start(uint32_t thread_count = 0);
+		bool Stop();
+
+		// Puts the worker in a run queue. It is called only when the worker is not already scheduled.
+		void Post(const std::shared_ptr<StreamWorker> &worker);
+
+		uint32_t GetThreadCount() const
+		{
+			return _thread_count;
+		}
+
+	private:
+		struct RunQueue
+		{
+			std::mutex mutex;
+			std::deque<std::shared_ptr<StreamWorker>> workers;
+		};
+
+		void WorkerThread(uint32_t index);
+
+		// Pops a worker from the run queue of the thread, or steals one from the other threads
+		std::shared_ptr<StreamWorker> PopWorker(uint32_t index);
+
+		ov::String _name;
+
+		uint32_t _thread_count = 0;
+		std::vector<std::unique_ptr<RunQueue>> _run_queues;
+		std::vector<std::thread> _threads;
+
+		// Used to select a run queue when a worker is posted from outside of the executor
+		std::atomic<uint32_t> _next_queue_index{0};
+
+		// Number of workers in all run queues
+		std::atomic<size_t> _pending_count{0};
+		std::mutex _idle_mutex;
+		std::condition_variable _idle_condition;
+
+		std::atomic<bool> _stop_thread_flag{true};
+	};
+}  // namespace pub
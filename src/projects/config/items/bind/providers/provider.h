@@ -20,6 +20,8 @@ namespace cfg
 			protected:
 				Tport _port;
 				Tport _tls_port;
+				// Number of UDP datagrams received at once with recvmmsg() (0 or 1: disabled, UDP only)
+				int _recv_batch_size = 0;
 
 			public:
 				explicit Provider(const char *port)
@@ -35,12 +37,14 @@ namespace cfg
 
 				CFG_DECLARE_REF_GETTER_OF(GetPort, _port);
 				CFG_DECLARE_REF_GETTER_OF(GetTlsPort, _tls_port);
+				CFG_DECLARE_REF_GETTER_OF(GetRecvBatchSize, _recv_batch_size);
 
 			protected:
 				void MakeList() override
 				{
 					Register<Optional>("Port", &_port);
 					Register<Optional>({"TLSPort", "tlsPort"}, &_tls_port);
+					Register<Optional>("RecvBatchSize", &_recv_batch_size);
 				};
 			};
 		}  // namespace pvd
@@ -21,6 +21,11 @@ namespace cfg
 				Tport _port;
 				Tport _tls_port;
 
+				// Maximum number of bytes queued per client (0: ov::DefaultSendQueueSize)
+				int _send_queue_size = 0;
+				// Use kernel TLS for the TLS port if possible
+				bool _kernel_tls = false;
+
 			public:
 				explicit Publisher(const char *port)
 					: _port(port)
@@ -35,12 +40,20 @@ namespace cfg
 
 				CFG_DECLARE_REF_GETTER_OF(GetPort, _port);
 				CFG_DECLARE_REF_GETTER_OF(GetTlsPort, _tls_port);
+				CFG_DECLARE_REF_GETTER_OF(IsKernelTlsEnabled, _kernel_tls);
+
+				size_t GetSendQueueSize() const
+				{
+					return (_send_queue_size > 0) ? static_cast<size_t>(_send_queue_size) : ov::DefaultSendQueueSize;
+				}
 
 			protected:
 				void MakeList() override
 				{
 					Register<Optional>("Port", &_port);
 					Register<Optional>({"TLSPort", "tlsPort"}, &_tls_port);
+					Register<Optional>("SendQueueSize", &_send_queue_size);
+					Register<Optional>("KernelTLS", &_kernel_tls);
 				};
 			};
 		}  // namespace pub
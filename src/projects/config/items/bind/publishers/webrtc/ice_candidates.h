@@ -20,13 +20,30 @@ namespace cfg
 				std::vector<ov::String> _ice_candidate_list{
 					"*:10000-10005/udp"};
 
+				// Number of UDP datagrams sent at once with sendmmsg() (0 or 1: disabled)
+				int _send_batch_size = 0;
+				// Maximum time(ms) that a datagram waits in the batch
+				int _send_flush_interval = 1;
+				// Merge consecutive datagrams to the same peer using UDP GSO
+				bool _udp_gso = false;
+				// Number of UDP datagrams received at once with recvmmsg() (0 or 1: disabled)
+				int _recv_batch_size = 0;
+
 			public:
 				CFG_DECLARE_REF_GETTER_OF(GetIceCandidateList, _ice_candidate_list);
+				CFG_DECLARE_REF_GETTER_OF(GetSendBatchSize, _send_batch_size);
+				CFG_DECLARE_REF_GETTER_OF(GetSendFlushInterval, _send_flush_interval);
+				CFG_DECLARE_REF_GETTER_OF(IsUdpGsoEnabled, _udp_gso);
+				CFG_DECLARE_REF_GETTER_OF(GetRecvBatchSize, _recv_batch_size);
 
 			protected:
 				void MakeList() override
 				{
 					Register<Optional>("IceCandidate", &_ice_candidate_list);
+					Register<Optional>("SendBatchSize", &_send_batch_size);
+					Register<Optional>("SendFlushInterval", &_send_flush_interval);
+					Register<Optional>("UdpGso", &_udp_gso);
+					Register<Optional>("RecvBatchSize", &_recv_batch_size);
 				}
 			};
 		}  // namespace pub
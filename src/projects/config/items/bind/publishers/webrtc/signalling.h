@@ -20,6 +20,8 @@ namespace cfg
 				cmn::SingularPort _port;
 				cmn::SingularPort _tls_port;
 				int _worker = 4;
+				// Use kernel TLS for the TLS port if possible
+				bool _kernel_tls = false;
 
 			public:
 				explicit Signalling(const char *port)
@@ -36,6 +38,7 @@ namespace cfg
 				CFG_DECLARE_REF_GETTER_OF(GetPort, _port);
 				CFG_DECLARE_REF_GETTER_OF(GetTlsPort, _tls_port);
 				CFG_DECLARE_REF_GETTER_OF(GetWorker, _worker);
+				CFG_DECLARE_REF_GETTER_OF(IsKernelTlsEnabled, _kernel_tls);
 
 			protected:
 				void MakeList() override
@@ -43,6 +46,7 @@ namespace cfg
 					Register<Optional>("Port", &_port);
 					Register<Optional>({"TLSPort", "tlsPort"}, &_tls_port);
 					Register<Optional>("Worker", &_worker);
+					Register<Optional>("KernelTLS", &_kernel_tls);
 				}
 			};
 		}  // namespace pub
@@ -22,14 +22,18 @@ namespace cfg
 				{
 				protected:
 					std::vector<OutputProfile> _output_profiles;
+					// Scale the smaller renditions from the output of a larger one (e.g. 1080p -> 720p -> 360p)
+					bool _cascade_scaling = false;
 
 				public:
 					CFG_DECLARE_REF_GETTER_OF(GetOutputProfileList, _output_profiles)
+					CFG_DECLARE_REF_GETTER_OF(IsCascadeScalingEnabled, _cascade_scaling)
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>("OutputProfile", &_output_profiles);
+						Register<Optional>("CascadeScaling", &_cascade_scaling);
 					}
 				};
 			}  // namespace oprf
@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "dvr.h"
 #include "publisher.h"
 
 namespace cfg
@@ -27,6 +28,8 @@ namespace cfg
 
 					CFG_DECLARE_REF_GETTER_OF(GetSegmentCount, _segment_count)
 					CFG_DECLARE_REF_GETTER_OF(GetSegmentDuration, _segment_duration)
+					CFG_DECLARE_REF_GETTER_OF(GetMemoryBudget, _memory_budget)
+					CFG_DECLARE_REF_GETTER_OF(GetDvr, _dvr)
 					CFG_DECLARE_REF_GETTER_OF(GetCrossDomainList, _cross_domains.GetUrls())
 					CFG_DECLARE_REF_GETTER_OF(GetCrossDomains, _cross_domains)
 
@@ -37,11 +40,16 @@ namespace cfg
 
 						Register<Optional>("SegmentCount", &_segment_count);
 						Register<Optional>("SegmentDuration", &_segment_duration);
+						Register<Optional>("MemoryBudget", &_memory_budget);
+						Register<Optional>({"DVR", "dvr"}, &_dvr);
 						Register<Optional>("CrossDomains", &_cross_domains);
 					}
 
 					int _segment_count = 3;
 					int _segment_duration = 5;
+					// Maximum size of the segments of a track in MB (0: unlimited)
+					int _memory_budget = 0;
+					Dvr _dvr;
 					cmn::CrossDomains _cross_domains;
 					int _send_buffer_size = 1024 * 1024 * 20;  // 20M
 					int _recv_buffer_size = 0;
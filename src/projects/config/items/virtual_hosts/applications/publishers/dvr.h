@@ -0,0 +1,42 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// Segments removed from the live window are kept in files for timeshift
+				struct Dvr : public Item
+				{
+					CFG_DECLARE_REF_GETTER_OF(IsEnabled, _enable)
+					CFG_DECLARE_REF_GETTER_OF(GetDirectory, _directory)
+					CFG_DECLARE_REF_GETTER_OF(GetDuration, _duration)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enable);
+						Register<Optional>("Directory", &_directory);
+						Register<Optional>("Duration", &_duration);
+					}
+
+					bool _enable = false;
+					// A local disk or tmpfs (The files are unlinked as soon as they are created)
+					ov::String _directory = "/tmp/ome_dvr";
+					// Maximum duration of the DVR window in seconds
+					int _duration = 7200;
+				};
+			}  // namespace pub
+		}	   // namespace app
+	}		   // namespace vhost
+}  // namespace cfg
@@ -27,6 +27,7 @@ namespace cfg
 
 					// CFG_DECLARE_REF_GETTER_OF(GetSegmentCount, _segment_count)
 					CFG_DECLARE_REF_GETTER_OF(GetSegmentDuration, _segment_duration)
+					CFG_DECLARE_REF_GETTER_OF(GetMemoryBudget, _memory_budget)
 					CFG_DECLARE_REF_GETTER_OF(GetCrossDomainList, _cross_domains.GetUrls())
 					CFG_DECLARE_REF_GETTER_OF(GetCrossDomains, _cross_domains)
 
@@ -37,12 +38,15 @@ namespace cfg
 
 						// Register<Optional>("SegmentCount", &_segment_count);
 						Register<Optional>("SegmentDuration", &_segment_duration);
+						Register<Optional>("MemoryBudget", &_memory_budget);
 						Register<Optional>("CrossDomains", &_cross_domains);
 					}
 
 					// LL-DASH uses time-based segment
 					// int _segment_count = 3;
 					int _segment_duration = 3;
+					// Maximum size of the segments of a track in MB (0: unlimited)
+					int _memory_budget = 0;
 					cmn::CrossDomains _cross_domains;
 				};
 			}  // namespace pub
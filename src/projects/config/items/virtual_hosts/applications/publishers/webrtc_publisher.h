@@ -28,6 +28,7 @@ namespace cfg
 					CFG_DECLARE_REF_GETTER_OF(GetTimeout, _timeout)
 					CFG_DECLARE_REF_GETTER_OF(IsRtxEnabled, _rtx)
 					CFG_DECLARE_REF_GETTER_OF(IsUlpfecEnalbed, _ulpfec)
+					CFG_DECLARE_REF_GETTER_OF(IsAbrEnabled, _abr)
 
 				protected:
 					void MakeList() override
@@ -37,11 +38,14 @@ namespace cfg
 						Register<Optional>("Timeout", &_timeout);
 						Register<Optional>("Rtx", &_rtx);
 						Register<Optional>("Ulpfec", &_ulpfec);
+						Register<Optional>("Abr", &_abr);
 					}
 
 					int _timeout = 30000;
 					bool _rtx = true;
 					bool _ulpfec = true;
+					// Switches the renditions of the same source for each viewer by the estimated bandwidth
+					bool _abr = false;
 				};
 			}  // namespace pub
 		}	   // namespace app
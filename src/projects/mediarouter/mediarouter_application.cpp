@@ -15,6 +15,15 @@
 
 #define MIN_APPLICATION_WORKER_COUNT 1
 #define MAX_APPLICATION_WORKER_COUNT 64
+
+// Maximum number of packets a worker delivers from a stream at a time, so that the other streams of the worker are not starved
+#define MAX_PACKETS_PER_STREAM_TURN 256
+
+// The workers are rebalanced every interval if the load of the busiest worker exceeds the idlest one by the ratio
+#define WORKER_REBALANCE_INTERVAL_MS 5000
+#define WORKER_REBALANCE_THRESHOLD_RATIO 0.25
+// Ignore the differences that are too small to be worth moving a stream (CPU time in the interval)
+#define WORKER_REBALANCE_MIN_GAP_US (50 * 1000)
 using namespace cmn;
 
 std::shared_ptr<MediaRouteApplication> MediaRouteApplication::Create(const info::Application &application_info)
@@ -63,6 +72,8 @@ bool MediaRouteApplication::Start()
 {
 	_kill_flag = false;
 
+	_rebalance_stop_watch.Start();
+
 	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
 	{
 		try
@@ -314,6 +325,8 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateInboundStream(
 	if (!new_stream)
 		return nullptr;
 
+	new_stream->SetWorkerId(stream_info->GetId() % _max_worker_thread_count);
+
 	_inbound_streams.insert(std::make_pair(stream_info->GetId(), new_stream));
 
 	return new_stream;
@@ -328,6 +341,8 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateOutboundStream(
 	if (!new_stream)
 		return nullptr;
 
+	new_stream->SetWorkerId(stream_info->GetId() % _max_worker_thread_count);
+
 	_outbound_streams.insert(std::make_pair(stream_info->GetId(), new_stream));
 
 	return new_stream;
@@ -546,7 +561,7 @@ bool MediaRouteApplication::OnPacketReceived(
 			{
 				return false;
 			}
-			_inbound_stream_indicator[stream_info->GetId() % _max_worker_thread_count]->Enqueue(stream);
+			ScheduleStream(_inbound_stream_indicator, stream);
 		}
 		break;
 
@@ -564,7 +579,7 @@ bool MediaRouteApplication::OnPacketReceived(
 				return false;
 			}
 
-			_outbound_stream_indicator[stream_info->GetId() % _max_worker_thread_count]->Enqueue(stream);
+			ScheduleStream(_outbound_stream_indicator, stream);
 		}
 		break;
 		default: {
@@ -669,32 +684,10 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// Processes all packets in the selected stream.
-		// StreamDeliver media packet to Publiser(observer) of Transcoder(observer)
-		while (auto media_packet = stream->Pop())
-		{
-			// When the inbound stream is finished parsing track information,
-			// Notify the Observer that the stream is parsed
-			if (stream->IsNotifyStreamPrepared() == false && stream->IsParseTrackAll() == true)
-			{
-				NotifyStreamPrepared(stream);
-			}
-
-			std::shared_lock<std::shared_mutex> lock(_observers_lock);
-			for (const auto &observer : _observers)
-			{
-				auto observer_type = observer->GetObserverType();
-
-				if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
-				{
-					// Get Stream Info
-					auto stream_info = stream->GetStream();
+		// StreamDeliver media packet to Transcoder(observer)
+		ProcessStream(_inbound_stream_indicator, stream, MediaRouteApplicationObserver::ObserverType::Transcoder);
 
-					// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-					observer->OnSendFrame(stream_info, media_packet);
-				}
-			}
-		}
+		RebalanceWorkersIfNeeded();
 	}
 
 	logtd("Inbound worker thread #%d has beed stopped", worker_id);
@@ -719,30 +712,158 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// Processes all packets in the selected stream.
-		// StreamDeliver media packet to Publiser(observer) of Transcoder(observer)
-		while (auto media_packet = stream->Pop())
+		// StreamDeliver media packet to Publiser(observer)
+		ProcessStream(_outbound_stream_indicator, stream, MediaRouteApplicationObserver::ObserverType::Publisher);
+
+		RebalanceWorkersIfNeeded();
+	}
+
+	logtd("Outbound worker thread #%d has beed stopped", worker_id);
+}
+
+static int64_t GetThreadCpuTimeUs()
+{
+	struct timespec ts;
+
+	if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+	{
+		return 0;
+	}
+
+	return (static_cast<int64_t>(ts.tv_sec) * 1000000) + (ts.tv_nsec / 1000);
+}
+
+void MediaRouteApplication::ScheduleStream(const StreamIndicator &indicator, const std::shared_ptr<MediaRouteStream> &stream)
+{
+	// The stream is put in the queue only once no matter how many packets are pushed,
+	// and the worker delivers all of them when it wakes up.
+	if (stream->TrySchedule() == false)
+	{
+		return;
+	}
+
+	indicator[stream->GetWorkerId() % _max_worker_thread_count]->Enqueue(stream);
+}
+
+void MediaRouteApplication::ProcessStream(const StreamIndicator &indicator, std::shared_ptr<MediaRouteStream> &stream, MediaRouteApplicationObserver::ObserverType observer_type)
+{
+	auto begin_time = GetThreadCpuTimeUs();
+	auto stream_info = stream->GetStream();
+
+	// Processes the packets in the selected stream.
+	// Pop() returns nullptr for the packets that are stashed or dropped, so check the queue instead of the result.
+	for (int count = 0; (count < MAX_PACKETS_PER_STREAM_TURN) && stream->HasPendingPackets(); count++)
+	{
+		auto media_packet = stream->Pop();
+		if (media_packet == nullptr)
+		{
+			continue;
+		}
+
+		// When the stream is finished parsing track information,
+		// Notify the Observer that the stream is parsed
+		if (stream->IsNotifyStreamPrepared() == false && stream->IsParseTrackAll() == true)
+		{
+			NotifyStreamPrepared(stream);
+		}
+
+		std::shared_lock<std::shared_mutex> lock(_observers_lock);
+		for (const auto &observer : _observers)
 		{
-			if (stream->IsNotifyStreamPrepared() == false && stream->IsParseTrackAll() == true)
+			if (observer->GetObserverType() == observer_type)
 			{
-				NotifyStreamPrepared(stream);
+				observer->OnSendFrame(stream_info, media_packet);
 			}
+		}
+	}
 
-			std::shared_lock<std::shared_mutex> lock(_observers_lock);
-			for (const auto &observer : _observers)
-			{
-				auto observer_type = observer->GetObserverType();
+	stream->AddProcessingTime(GetThreadCpuTimeUs() - begin_time);
 
-				if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
-				{
-					// Get Stream Info
-					auto stream_info = stream->GetStream();
+	stream->ClearScheduled();
 
-					observer->OnSendFrame(stream_info, media_packet);
-				}
-			}
+	// Packets pushed while the stream was being processed did not schedule the stream, or the turn is over
+	if (stream->HasPendingPackets())
+	{
+		ScheduleStream(indicator, stream);
+	}
+}
+
+void MediaRouteApplication::RebalanceWorkersIfNeeded()
+{
+	if (_max_worker_thread_count < 2)
+	{
+		return;
+	}
+
+	// Only one worker does it at a time
+	std::unique_lock<std::mutex> rebalance_lock(_rebalance_mutex, std::try_to_lock);
+	if ((rebalance_lock.owns_lock() == false) || (_rebalance_stop_watch.IsElapsed(WORKER_REBALANCE_INTERVAL_MS) == false))
+	{
+		return;
+	}
+
+	_rebalance_stop_watch.Update();
+
+	std::shared_lock<std::shared_mutex> lock(_streams_lock);
+
+	RebalanceWorkers("inbound", _inbound_streams);
+	RebalanceWorkers("outbound", _outbound_streams);
+}
+
+void MediaRouteApplication::RebalanceWorkers(const char *direction, const std::map<uint32_t, std::shared_ptr<MediaRouteStream>> &streams)
+{
+	std::vector<int64_t> worker_loads(_max_worker_thread_count, 0);
+	std::vector<std::pair<std::shared_ptr<MediaRouteStream>, int64_t>> stream_loads;
+
+	for (const auto &item : streams)
+	{
+		auto &stream = item.second;
+		auto processing_time = stream->TakeProcessingTime();
+
+		worker_loads[stream->GetWorkerId() % _max_worker_thread_count] += processing_time;
+		stream_loads.emplace_back(stream, processing_time);
+	}
+
+	uint32_t busiest_worker_id = std::max_element(worker_loads.begin(), worker_loads.end()) - worker_loads.begin();
+	uint32_t idlest_worker_id = std::min_element(worker_loads.begin(), worker_loads.end()) - worker_loads.begin();
+
+	int64_t gap = worker_loads[busiest_worker_id] - worker_loads[idlest_worker_id];
+	if ((gap < WORKER_REBALANCE_MIN_GAP_US) || (gap < (worker_loads[busiest_worker_id] * WORKER_REBALANCE_THRESHOLD_RATIO)))
+	{
+		return;
+	}
+
+	// Find the stream that makes the loads of the two workers closest.
+	// A stream whose load is greater than the gap only moves the hot spot to the other worker.
+	std::shared_ptr<MediaRouteStream> target_stream = nullptr;
+	int64_t target_load = 0;
+	int64_t remaining_gap = gap;
+
+	for (const auto &[stream, load] : stream_loads)
+	{
+		if ((stream->GetWorkerId() % _max_worker_thread_count) != busiest_worker_id || (load <= 0) || (load >= gap))
+		{
+			continue;
+		}
+
+		auto new_gap = std::abs(gap - (load * 2));
+		if (new_gap < remaining_gap)
+		{
+			target_stream = stream;
+			target_load = load;
+			remaining_gap = new_gap;
 		}
 	}
 
-	logtd("Outbound worker thread #%d has beed stopped", worker_id);
+	if (target_stream == nullptr)
+	{
+		return;
+	}
+
+	// The packets already in the queue of the busiest worker are delivered by it first, so the order is kept
+	target_stream->SetWorkerId(idlest_worker_id);
+
+	logti("Moved %s stream %s/%s from worker #%u (%lldus) to worker #%u (%lldus), stream load: %lldus",
+		  direction, _application_info.GetName().CStr(), target_stream->GetStream()->GetName().CStr(),
+		  busiest_worker_id, worker_loads[busiest_worker_id], idlest_worker_id, worker_loads[idlest_worker_id], target_load);
 }
@@ -128,16 +128,31 @@ private:
 	std::shared_mutex _streams_lock;
 
 private:
+	using StreamIndicator = std::vector<std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>>>;
+
 	void InboundWorkerThread(uint32_t worker_id);
 	void OutboundWorkerThread(uint32_t worker_id);
 
+	// Puts the stream in the queue of its worker, unless the stream is already in the queue or being processed
+	void ScheduleStream(const StreamIndicator &indicator, const std::shared_ptr<MediaRouteStream> &stream);
+
+	// Delivers the pending packets of the stream to the observers of observer_type
+	void ProcessStream(const StreamIndicator &indicator, std::shared_ptr<MediaRouteStream> &stream, MediaRouteApplicationObserver::ObserverType observer_type);
+
+	// Moves a stream of the busiest worker to the idlest worker by the CPU time spent on the streams
+	void RebalanceWorkersIfNeeded();
+	void RebalanceWorkers(const char *direction, const std::map<uint32_t, std::shared_ptr<MediaRouteStream>> &streams);
+
 	volatile bool _kill_flag;
 	std::vector<std::thread> _inbound_threads;
 	std::vector<std::thread> _outbound_threads;
 
 	uint32_t _max_worker_thread_count;
 
+	std::mutex _rebalance_mutex;
+	ov::StopWatch _rebalance_stop_watch;
+
 private:
-	std::vector<std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>>> _inbound_stream_indicator;
-	std::vector<std::shared_ptr<ov::Queue<std::shared_ptr<MediaRouteStream>>>> _outbound_stream_indicator;
+	StreamIndicator _inbound_stream_indicator;
+	StreamIndicator _outbound_stream_indicator;
 };
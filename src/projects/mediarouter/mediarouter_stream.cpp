@@ -43,6 +43,9 @@
 
 #define PTS_CORRECT_THRESHOLD_US 5000
 
+// Contexts of the tracks whose id is less than this are kept in a vector indexed by the track id
+#define MAX_DENSE_TRACK_ID 64
+
 using namespace cmn;
 
 MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream)
@@ -72,18 +75,8 @@ MediaRouteStream::~MediaRouteStream()
 {
 	logti("Delete media route stream name(%s) id(%u)", _stream->GetName().CStr(), _stream->GetId());
 
-	_media_packet_stash.clear();
-
-	_stat_recv_pkt_lpts.clear();
-	_stat_recv_pkt_ldts.clear();
-	_stat_recv_pkt_size.clear();
-	_stat_recv_pkt_count.clear();
-	_stat_first_time_diff.clear();
-
-	_pts_last.clear();
-	_dts_last.clear();
-	_pts_correct.clear();
-	_pts_avg_inc.clear();
+	_track_contexts.clear();
+	_sparse_track_contexts.clear();
 }
 
 std::shared_ptr<info::Stream> MediaRouteStream::GetStream()
@@ -188,6 +181,32 @@ bool MediaRouteStream::ProcessOutboundStream(std::shared_ptr<MediaTrack> &media_
 	return true;
 }
 
+MediaRouteStream::TrackContext &MediaRouteStream::GetTrackContext(MediaTrackId track_id)
+{
+	if ((track_id >= 0) && (track_id < MAX_DENSE_TRACK_ID))
+	{
+		if (static_cast<size_t>(track_id) >= _track_contexts.size())
+		{
+			_track_contexts.resize(track_id + 1);
+		}
+
+		return _track_contexts[track_id];
+	}
+
+	return _sparse_track_contexts[track_id];
+}
+
+const MediaRouteStream::TrackContext *MediaRouteStream::FindTrackContext(MediaTrackId track_id) const
+{
+	if ((track_id >= 0) && (track_id < MAX_DENSE_TRACK_ID))
+	{
+		return (static_cast<size_t>(track_id) < _track_contexts.size()) ? &(_track_contexts[track_id]) : nullptr;
+	}
+
+	auto iter = _sparse_track_contexts.find(track_id);
+	return (iter != _sparse_track_contexts.end()) ? &(iter->second) : nullptr;
+}
+
 void MediaRouteStream::InitParseTrackInfo()
 {
 	for (const auto &iter : _stream->GetTracks())
@@ -200,18 +219,14 @@ void MediaRouteStream::InitParseTrackInfo()
 
 void MediaRouteStream::SetParseTrackInfo(std::shared_ptr<MediaTrack> &media_track)
 {
-	_parse_completed_track_info[media_track->GetId()] = media_track->IsValidity();
+	GetTrackContext(media_track->GetId()).parse_state = media_track->IsValidity() ? TrackContext::ParseState::Completed : TrackContext::ParseState::Parsing;
 }
 
 bool MediaRouteStream::IsParseTrackInfo(std::shared_ptr<MediaTrack> &media_track)
 {
-	auto iter = _parse_completed_track_info.find(media_track->GetId());
-	if (iter != _parse_completed_track_info.end())
-	{
-		return iter->second;
-	}
+	auto track_context = FindTrackContext(media_track->GetId());
 
-	return false;
+	return (track_context != nullptr) && (track_context->parse_state == TrackContext::ParseState::Completed);
 }
 
 // Check whether the information extraction for all tracks has been completed.
@@ -222,9 +237,15 @@ bool MediaRouteStream::IsParseTrackAll()
 		return true;
 	}
 
-	for (const auto &iter : _parse_completed_track_info)
+	for (const auto &track_context : _track_contexts)
+	{
+		if (track_context.parse_state == TrackContext::ParseState::Parsing)
+			return false;
+	}
+
+	for (const auto &iter : _sparse_track_contexts)
 	{
-		if (iter.second == false)
+		if (iter.second.parse_state == TrackContext::ParseState::Parsing)
 			return false;
 	}
 
@@ -740,26 +761,24 @@ bool MediaRouteStream::UpdateDecoderParameterSets(
 	return true;
 }
 
-void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
+void MediaRouteStream::UpdateStatistics(TrackContext &track_context, std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
 {
-	auto track_id = media_track->GetId();
-
-	_stat_recv_pkt_lpts[track_id] = media_packet->GetPts();
+	track_context.stat_recv_pkt_lpts = media_packet->GetPts();
 
-	_stat_recv_pkt_ldts[track_id] = media_packet->GetDts();
+	track_context.stat_recv_pkt_ldts = media_packet->GetDts();
 
-	_stat_recv_pkt_size[track_id] += media_packet->GetData()->GetLength();
+	track_context.stat_recv_pkt_size += media_packet->GetData()->GetLength();
 
-	_stat_recv_pkt_count[track_id]++;
+	track_context.stat_recv_pkt_count++;
 
 	// 	Diffrence time of received first packet with uptime.
-	if (_stat_first_time_diff[track_id] == 0)
+	if (track_context.stat_first_time_diff == 0)
 	{
 		int64_t uptime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - _stat_start_time).count();
 
-		int64_t rescaled_last_pts = _stat_recv_pkt_lpts[track_id] * 1000 / _stream->GetTrack(track_id)->GetTimeBase().GetDen();
+		int64_t rescaled_last_pts = track_context.stat_recv_pkt_lpts * 1000 / media_track->GetTimeBase().GetDen();
 
-		_stat_first_time_diff[track_id] = uptime - rescaled_last_pts;
+		track_context.stat_first_time_diff = uptime - rescaled_last_pts;
 	}
 
 	if (_stop_watch.IsElapsed(5000))
@@ -781,15 +800,21 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 
 			ov::String pts_str = "";
 
-			int64_t rescaled_last_pts = _stat_recv_pkt_lpts[track_id] * 1000 / track->GetTimeBase().GetDen();
+			auto stat_context = FindTrackContext(track_id);
+			if (stat_context == nullptr)
+			{
+				continue;
+			}
+
+			int64_t rescaled_last_pts = stat_context->stat_recv_pkt_lpts * 1000 / track->GetTimeBase().GetDen();
 
-			int64_t first_delay = _stat_first_time_diff[track_id];
+			int64_t first_delay = stat_context->stat_first_time_diff;
 
 			int64_t last_delay = uptime - rescaled_last_pts;
 
-			if (_pts_correct[track_id] != 0)
+			if (stat_context->pts_correct != 0)
 			{
-				int64_t corrected_pts = _pts_correct[track_id] * 1000 / track->GetTimeBase().GetDen();
+				int64_t corrected_pts = stat_context->pts_correct * 1000 / track->GetTimeBase().GetDen();
 
 				pts_str.AppendFormat("pts: %lldms, crt: %lld, delay: %5lldms", rescaled_last_pts, corrected_pts, first_delay - last_delay);
 			}
@@ -807,7 +832,7 @@ void MediaRouteStream::UpdateStatistics(std::shared_ptr<MediaTrack> &media_track
 			min_pts = std::min(min_pts, rescaled_last_pts);
 			max_pts = std::max(max_pts, rescaled_last_pts);
 
-			stat_track_str.AppendFormat("\n\t[%3d] type: %5s(%2d/%4s), %s, pkt_cnt: %6lld, pkt_siz: %sB", track_id, track->GetMediaType() == MediaType::Video ? "video" : "audio", track->GetCodecId(), ::StringFromMediaCodecId(track->GetCodecId()).CStr(), pts_str.CStr(), _stat_recv_pkt_count[track_id], ov::Converter::ToSiString(_stat_recv_pkt_size[track_id], 1).CStr());
+			stat_track_str.AppendFormat("\n\t[%3d] type: %5s(%2d/%4s), %s, pkt_cnt: %6lld, pkt_siz: %sB", track_id, track->GetMediaType() == MediaType::Video ? "video" : "audio", track->GetCodecId(), ::StringFromMediaCodecId(track->GetCodecId()).CStr(), pts_str.CStr(), stat_context->stat_recv_pkt_count, ov::Converter::ToSiString(stat_context->stat_recv_pkt_size, 1).CStr());
 		}
 
 		ov::String stat_stream_str = "";
@@ -955,20 +980,20 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 	//	- 1) If packets stashed, calculate duration compared to the current packet timestamp.
 	//	- 3) and then, the current packet stash.
 
-	auto it = _media_packet_stash.find(media_packet->GetTrackId());
-	if (it == _media_packet_stash.end())
+	auto &track_context = GetTrackContext(media_packet->GetTrackId());
+	if (track_context.stashed_packet == nullptr)
 	{
-		_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
+		track_context.stashed_packet = std::move(media_packet);
 
 		return nullptr;
 	}
 
-	auto pop_media_packet = std::move(it->second);
+	auto pop_media_packet = std::move(track_context.stashed_packet);
 
 	int64_t duration = media_packet->GetDts() - pop_media_packet->GetDts();
 	pop_media_packet->SetDuration(duration);
 
-	_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
+	track_context.stashed_packet = std::move(media_packet);
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Bitstream format converting to stand format. and, parsing track informaion
@@ -1021,7 +1046,7 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 	////////////////////////////////////////////////////////////////////////////////////
 	// PTS Correction for Abnormal increase
 
-	int64_t ts_inc = pop_media_packet->GetPts() - _pts_last[track_id];
+	int64_t ts_inc = pop_media_packet->GetPts() - track_context.pts_last;
 
 	int den = media_track->GetTimeBase().GetDen();
 	if (den == 0)
@@ -1034,33 +1059,68 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 		if (!(media_track->GetCodecId() == cmn::MediaCodecId::Png || media_track->GetCodecId() == cmn::MediaCodecId::Jpeg))
 		{
 			// TODO(soulk): I think all tracks should calibrate the PTS with the same value.
-			_pts_correct[track_id] = pop_media_packet->GetPts() - _pts_last[track_id] - _pts_avg_inc[track_id];
+			track_context.pts_correct = pop_media_packet->GetPts() - track_context.pts_last - track_context.pts_avg_inc;
 
 			logtw("Detected abnormal increased pts. track_id : %d, prv_pts : %lld, cur_pts : %lld, crt_pts : %lld, avg_inc : %lld, inc : %lld",
-				  track_id, _pts_last[track_id], pop_media_packet->GetPts(), _pts_correct[track_id], _pts_avg_inc[track_id], std::abs(ts_inc_ms));
+				  track_id, track_context.pts_last, pop_media_packet->GetPts(), track_context.pts_correct, track_context.pts_avg_inc, std::abs(ts_inc_ms));
 		}
 	}
 	else
 	{
 		// Originally it should be an average value, Use the difference of the last packet.
 		// Use DTS because the PTS value does not increase uniformly.
-		_pts_avg_inc[track_id] = pop_media_packet->GetDts() - _dts_last[track_id];
+		track_context.pts_avg_inc = pop_media_packet->GetDts() - track_context.dts_last;
 	}
 
-	_pts_last[track_id] = pop_media_packet->GetPts();
-	_dts_last[track_id] = pop_media_packet->GetDts();
+	track_context.pts_last = pop_media_packet->GetPts();
+	track_context.dts_last = pop_media_packet->GetDts();
 
-	pop_media_packet->SetPts(pop_media_packet->GetPts() - _pts_correct[track_id]);
-	pop_media_packet->SetDts(pop_media_packet->GetDts() - _pts_correct[track_id]);
+	pop_media_packet->SetPts(pop_media_packet->GetPts() - track_context.pts_correct);
+	pop_media_packet->SetDts(pop_media_packet->GetDts() - track_context.pts_correct);
 
 	////////////////////////////////////////////////////////////////////////////////////
 	// Statistics
 
-	UpdateStatistics(media_track, pop_media_packet);
+	UpdateStatistics(track_context, media_track, pop_media_packet);
 
 	return std::move(pop_media_packet);
 }
 
+bool MediaRouteStream::HasPendingPackets() const
+{
+	return _packets_queue.IsEmpty() == false;
+}
+
+bool MediaRouteStream::TrySchedule()
+{
+	return _scheduled.exchange(true) == false;
+}
+
+void MediaRouteStream::ClearScheduled()
+{
+	_scheduled = false;
+}
+
+uint32_t MediaRouteStream::GetWorkerId() const
+{
+	return _worker_id;
+}
+
+void MediaRouteStream::SetWorkerId(uint32_t worker_id)
+{
+	_worker_id = worker_id;
+}
+
+void MediaRouteStream::AddProcessingTime(int64_t processing_time_us)
+{
+	_processing_time_us += processing_time_us;
+}
+
+int64_t MediaRouteStream::TakeProcessingTime()
+{
+	return _processing_time_us.exchange(0);
+}
+
 void MediaRouteStream::DumpPacket(
 	std::shared_ptr<MediaPacket> &media_packet,
 	bool dump)
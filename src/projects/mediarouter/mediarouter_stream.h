@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <queue>
 #include <vector>
@@ -49,6 +50,24 @@ public:
 		std::shared_ptr<MediaPacket> &media_packet);
 
 	std::shared_ptr<MediaPacket> Pop();
+	bool HasPendingPackets() const;
+
+	// Scheduling interfaces for the workers of MediaRouteApplication
+	//
+	// A stream is in the queue of a worker at most once, and the worker drains all pending packets at a time.
+	// Returns true if the stream was not scheduled, then the caller have to put the stream in the queue of the worker.
+	bool TrySchedule();
+	// Called by the worker after draining the packets. The stream may be scheduled again after this.
+	void ClearScheduled();
+
+	uint32_t GetWorkerId() const;
+	// The stream is moved to another worker from the next scheduling
+	void SetWorkerId(uint32_t worker_id);
+
+	// CPU time the workers spent on this stream
+	void AddProcessingTime(int64_t processing_time_us);
+	// Returns the processing time accumulated since the last call
+	int64_t TakeProcessingTime();
 
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
@@ -62,6 +81,43 @@ public:
 	bool IsParseTrackAll();
 
 private:
+	// Per-track state which is looked up for every packet
+	struct TrackContext
+	{
+		enum class ParseState : uint8_t
+		{
+			// The track is not in the stream information
+			None,
+			Parsing,
+			Completed
+		};
+
+		ParseState parse_state = ParseState::None;
+
+		// Temporary packet store. for calculating packet duration
+		std::shared_ptr<MediaPacket> stashed_packet;
+
+		// Store the correction values in case of sudden change in PTS.
+		// If the PTS suddenly increases, the filter behaves incorrectly.
+		int64_t pts_last = 0;
+		int64_t dts_last = 0;
+		int64_t pts_correct = 0;
+		// Average Pts Incresement
+		int64_t pts_avg_inc = 0;
+
+		// Statistics
+		int64_t stat_recv_pkt_lpts = 0;
+		int64_t stat_recv_pkt_ldts = 0;
+		int64_t stat_recv_pkt_size = 0;
+		int64_t stat_recv_pkt_count = 0;
+		int64_t stat_first_time_diff = 0;
+	};
+
+	// Creates the context if it does not exist.
+	// The reference is valid until the context of another track is created.
+	TrackContext &GetTrackContext(MediaTrackId track_id);
+	const TrackContext *FindTrackContext(MediaTrackId track_id) const;
+
 	void InitParseTrackInfo();
 	// void SetParseTrackInfo(std::shared_ptr<MediaTrack> &media_track, bool parsed);
 	void SetParseTrackInfo(std::shared_ptr<MediaTrack> &media_track);
@@ -72,8 +128,6 @@ private:
 		std::shared_ptr<MediaTrack> &media_track,
 		std::shared_ptr<MediaPacket> &media_packet);
 
-	// Set whether parsing media track is complete
-	std::map<MediaTrackId, bool> _parse_completed_track_info;
 	bool _is_parsed_all_track;
 
 private:
@@ -99,7 +153,8 @@ private:
 		std::shared_ptr<MediaTrack> &media_track,
 		std::shared_ptr<MediaPacket> &media_packet);
 
-	void UpdateStatistics(std::shared_ptr<MediaTrack> &media_track,
+	void UpdateStatistics(TrackContext &track_context,
+						  std::shared_ptr<MediaTrack> &media_track,
 						  std::shared_ptr<MediaPacket> &media_packet);
 
 private:
@@ -116,31 +171,18 @@ private:
 	// Stream Information
 	std::shared_ptr<info::Stream> _stream;
 
-	// Temporary packet store. for calculating packet duration
-	std::map<MediaTrackId, std::shared_ptr<MediaPacket>> _media_packet_stash;
-
 	// Packets queue
 	ov::Queue<std::shared_ptr<MediaPacket>> _packets_queue;
 
-	// Store the correction values in case of sudden change in PTS.
-	// If the PTS suddenly increases, the filter behaves incorrectly.
-	std::map<MediaTrackId, int64_t> _pts_last;
-	std::map<MediaTrackId, int64_t> _dts_last;
-	// <TrackId, Pts>
-	std::map<MediaTrackId, int64_t> _pts_correct;
-	// Average Pts Incresement
-	std::map<MediaTrackId, int64_t> _pts_avg_inc;
-
-	// Timebase of incoming packets
-	std::map<MediaTrackId, cmn::Timebase> _incoming_tiembase;
-
-	// Statistics
-	// <TrackId, Values>
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_lpts;
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_ldts;
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_size;
-	std::map<MediaTrackId, int64_t> _stat_recv_pkt_count;
-	std::map<MediaTrackId, int64_t> _stat_first_time_diff;
+	// Scheduling state
+	std::atomic<bool> _scheduled{false};
+	std::atomic<uint32_t> _worker_id{0};
+	std::atomic<int64_t> _processing_time_us{0};
+
+	// Track ids are usually small numbers, so the contexts are indexed by the track id
+	std::vector<TrackContext> _track_contexts;
+	// Contexts of the tracks which have large ids (e.g. PID of MPEG-TS)
+	std::map<MediaTrackId, TrackContext> _sparse_track_contexts;
 
 	// Time for statistics
 	ov::StopWatch _stop_watch;
@@ -11,10 +11,13 @@
 
 #define OV_LOG_TAG "SRTP"
 
+// RTP packet + SRTP trailer(auth tag, MKI) or SRTCP index
+#define SRTP_PROTECT_BUFFER_SIZE		(RTP_DEFAULT_MAX_PACKET_SIZE + SRTP_MAX_TRAILER_LEN + 4)
+
 SrtpTransport::SrtpTransport(uint32_t node_id, std::shared_ptr<pub::Session> session)
 	: SessionNode(node_id, pub::SessionNodeType::Srtp, session)
 {
-
+	_protect_buffer = std::make_shared<ov::Data>(SRTP_PROTECT_BUFFER_SIZE);
 }
 
 SrtpTransport::~SrtpTransport()
@@ -48,17 +51,35 @@ bool SrtpTransport::SendData(pub::SessionNodeType from_node, const std::shared_p
 	{
 		return false;
 	}
-	
+
+	// To DTLS transport
+	auto node = GetLowerNode();
+	if(!node)
+	{
+		return false;
+	}
+
+	// RTP and RTCP(from RtcSession and RTCP receiver thread) can be sent at the same time
+	std::lock_guard<std::mutex> lock(_protect_buffer_lock);
+
+	// The lower nodes send the data synchronously, so the capacity of _protect_buffer is reused.
+	// SetLength(0) keeps the capacity unlike Clear()
+	_protect_buffer->SetLength(0);
+	if(_protect_buffer->Append(data->GetData(), data->GetLength()) == false)
+	{
+		return false;
+	}
+
 	if(from_node == pub::SessionNodeType::Rtp)
 	{
-		if(!_send_session->ProtectRtp(data))
+		if(!_send_session->ProtectRtp(_protect_buffer))
 		{
 			return false;
 		}
 	}
 	else if(from_node == pub::SessionNodeType::Rtcp)
 	{
-		 if(!_send_session->ProtectRtcp(data))
+		 if(!_send_session->ProtectRtcp(_protect_buffer))
 		 {
 			return false;
 		 }
@@ -68,15 +89,8 @@ bool SrtpTransport::SendData(pub::SessionNodeType from_node, const std::shared_p
 		return false;
 	}
 
-	// To DTLS transport
-	auto node = GetLowerNode();
-	if(!node)
-	{
-		return false;
-	}
-	
-	logtd("SrtpTransport Send next node : %d", data->GetLength());
-	return node->SendData(GetNodeType(), data);
+	logtd("SrtpTransport Send next node : %d", _protect_buffer->GetLength());
+	return node->SendData(GetNodeType(), _protect_buffer);
 }
 
 bool SrtpTransport::OnDataReceived(pub::SessionNodeType from_node, const std::shared_ptr<const ov::Data> &data)
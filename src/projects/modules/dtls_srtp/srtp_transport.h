@@ -34,4 +34,9 @@ public:
 private:
 	std::shared_ptr<SrtpAdapter>		_send_session;
 	std::shared_ptr<SrtpAdapter>		_recv_session;
+
+	// Outgoing packets are shared by all sessions of a stream, so they are encrypted in this buffer instead of in place.
+	// The buffer is reused for every packet to avoid allocation per packet per session.
+	std::mutex							_protect_buffer_lock;
+	std::shared_ptr<ov::Data>			_protect_buffer;
 };
@@ -38,3 +38,36 @@ std::shared_ptr<const HttpResponse> HttpClient::GetResponse() const
 {
 	return _response;
 }
+
+void HttpClient::WaitForResponse(const std::shared_ptr<const ov::Data> &remaining_data)
+{
+	// This is called in OnHttpData(), so _process_mutex is already locked by HttpServer
+	_is_waiting_for_response = true;
+
+	if ((remaining_data != nullptr) && (remaining_data->GetLength() > 0))
+	{
+		if (_pipelined_data == nullptr)
+		{
+			_pipelined_data = remaining_data->Clone();
+		}
+		else
+		{
+			_pipelined_data->Append(remaining_data.get());
+		}
+	}
+}
+
+bool HttpClient::ProcessNextRequest()
+{
+	return _server->ProcessNextRequest(GetSharedPtr());
+}
+
+uint32_t HttpClient::GetCompletedRequestCount() const
+{
+	return _completed_request_count;
+}
+
+uint64_t HttpClient::GetIdleSince() const
+{
+	return _idle_since;
+}
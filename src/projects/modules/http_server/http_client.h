@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include "http_request.h"
 #include "http_response.h"
@@ -18,13 +19,13 @@ class HttpServer;
 // HttpRequest: Contains request informations (Request HTTP Header & Body)
 // HttpResponse: Contains socket & response informations (Response HTTP Header & Body)
 
-class HttpClient
+class HttpClient : public ov::EnableSharedFromThis<HttpClient>
 {
 public:
 	friend class HttpServer;
 
 	HttpClient(const std::shared_ptr<HttpServer> &server, std::shared_ptr<HttpRequest> &http_request, std::shared_ptr<HttpResponse> &http_response);
-	virtual ~HttpClient() = default;
+	~HttpClient() override = default;
 
 	std::shared_ptr<HttpRequest> GetRequest();
 	std::shared_ptr<HttpResponse> GetResponse();
@@ -32,9 +33,36 @@ public:
 	std::shared_ptr<const HttpRequest> GetRequest() const;
 	std::shared_ptr<const HttpResponse> GetResponse() const;
 
+	// HTTP pipelining (RFC7230 - 6.3.2)
+	//
+	// Called by the interceptor in OnHttpData() when the request is handed over to a handler which responds later.
+	// The data received after the request (the next requests) is held until ProcessNextRequest() is called,
+	// so the responses are sent in the order of the requests.
+	//
+	// remaining_data: The data received with the request, which is not a part of the request
+	void WaitForResponse(const std::shared_ptr<const ov::Data> &remaining_data);
+
+	// Called after the response is sent to keep the connection alive.
+	// Prepares the request/response for the next request, and processes the held requests.
+	bool ProcessNextRequest();
+
+	// Number of the requests completed on the connection (keep-alive)
+	uint32_t GetCompletedRequestCount() const;
+	// ov::Clock::NowMSec() when the connection started to wait for the next request (keep-alive),
+	// or 0 if a request is being received or processed
+	uint64_t GetIdleSince() const;
+
 protected:
 	std::shared_ptr<HttpServer> _server = nullptr;
 
 	std::shared_ptr<HttpRequest> _request = nullptr;
 	std::shared_ptr<HttpResponse> _response = nullptr;
+
+	// Serializes the processing of the received data and ProcessNextRequest()
+	std::mutex _process_mutex;
+	bool _is_waiting_for_response = false;
+	std::shared_ptr<ov::Data> _pipelined_data;
+
+	std::atomic<uint32_t> _completed_request_count{0};
+	std::atomic<uint64_t> _idle_since{0};
 };
@@ -10,4 +10,7 @@
 
 #define OV_LOG_TAG                          "HttpServer"
 
-#define HTTP_CHECK_METHOD(method, flag)     OV_CHECK_FLAG((uint8_t)method, (uint8_t)flag)
\ No newline at end of file
+#define HTTP_CHECK_METHOD(method, flag)     OV_CHECK_FLAG((uint8_t)method, (uint8_t)flag)
+
+// Maximum length of the pipelined requests which are held while the response of the current request is not sent
+#define HTTP_MAX_PIPELINED_DATA_LENGTH      (1024 * 1024)
\ No newline at end of file
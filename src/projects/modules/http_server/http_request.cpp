@@ -10,6 +10,8 @@
 #include "http_client.h"
 #include "http_private.h"
 
+#include <string.h>
+
 #include <algorithm>
 
 HttpRequest::HttpRequest(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<HttpRequestInterceptor> &interceptor)
@@ -51,6 +53,48 @@ HttpRequestConnectionType HttpRequest::GetConnectionType() const
 	return _connection_type;
 }
 
+namespace
+{
+	// Maximum length of the header area (request-line + header fields)
+	constexpr size_t MaxHeaderLength = 64 * 1024;
+	// Most requests have less headers than this, so the array is not reallocated
+	constexpr size_t DefaultHeaderCount = 16;
+
+	// Case-insensitive FNV-1a
+	uint32_t HashHeaderName(const char *name, size_t length)
+	{
+		uint32_t hash = 2166136261U;
+
+		for (size_t index = 0; index < length; index++)
+		{
+			hash ^= static_cast<uint8_t>(::tolower(static_cast<uint8_t>(name[index])));
+			hash *= 16777619U;
+		}
+
+		return hash;
+	}
+
+	std::string_view TrimView(std::string_view view)
+	{
+		while ((view.empty() == false) && ((view.front() == ' ') || (view.front() == '\t')))
+		{
+			view.remove_prefix(1);
+		}
+
+		while ((view.empty() == false) && ((view.back() == ' ') || (view.back() == '\t')))
+		{
+			view.remove_suffix(1);
+		}
+
+		return view;
+	}
+
+	bool IsEqualIgnoreCase(std::string_view lhs, std::string_view rhs)
+	{
+		return (lhs.length() == rhs.length()) && (::strncasecmp(lhs.data(), rhs.data(), lhs.length()) == 0);
+	}
+}  // namespace
+
 ssize_t HttpRequest::ProcessData(const std::shared_ptr<const ov::Data> &data)
 {
 	if (_is_header_found)
@@ -62,73 +106,82 @@ ssize_t HttpRequest::ProcessData(const std::shared_ptr<const ov::Data> &data)
 
 	const char NewLines[] = "\r\n\r\n";
 	// Exclude null character
-	const int NewLinesLength = OV_COUNTOF(NewLines) - 1;
+	const size_t NewLinesLength = OV_COUNTOF(NewLines) - 1;
 
-	ssize_t used_length = data->GetLength();
+	auto new_data = data->GetDataAs<char>();
+	size_t new_length = data->GetLength();
 
-	// Since the header has not been parsed yet, try to parse the header every time data comes in
-	ssize_t previous_length = _request_string.GetLength();
+	// The data is accumulated in the buffer until the header is found (the data after the header is dropped from the buffer)
+	size_t previous_length = _header_buffer.size();
 
-	// ov::String is binary-safe
-	_request_string.Append(data->GetDataAs<char>(), data->GetLength());
-	ssize_t newline_position = _request_string.IndexOf(&(NewLines[0]));
+	// Only the new data needs to be scanned (the last 3 bytes of the previous data may be a part of "\r\n\r\n")
+	size_t scan_position = (previous_length > (NewLinesLength - 1)) ? (previous_length - (NewLinesLength - 1)) : 0;
 
-	if (newline_position >= 0)
+	if (_header_buffer.capacity() == 0)
 	{
-		// If the parser find "\r\n\r\n", start parsing
-		_request_string.SetLength(newline_position);
+		_header_buffer.reserve(std::min(MaxHeaderLength, std::max(new_length, static_cast<size_t>(1024))));
+	}
 
-		// Used length =
-		//             [Length of string after finding "\r\n\r\n"] -
-		//             [Length of string before finding] +
-		//             [Length of string "\r\n\r\n"]
-		used_length = _request_string.GetLength() - previous_length + NewLinesLength;
+	// Do not copy more than the maximum length of the header
+	size_t copy_length = std::min(new_length, MaxHeaderLength + NewLinesLength - std::min(previous_length, MaxHeaderLength));
+	_header_buffer.insert(_header_buffer.end(), new_data, new_data + copy_length);
 
-		_is_header_found = true;
-		_parse_status = ParseMessage();
+	auto buffer = _header_buffer.data();
+	auto position = static_cast<const char *>(::memmem(buffer + scan_position, _header_buffer.size() - scan_position, NewLines, NewLinesLength));
+	size_t check_end = (position != nullptr) ? (position - buffer) : _header_buffer.size();
 
-		if (_parse_status == HttpStatusCode::OK)
-		{
-			// Calculate some informations such as Content length
-			PostProcess();
-		}
-		else
+	// Check if the header consists of non-binary data (the data after the header (body) is not checked)
+	for (size_t index = previous_length; index < check_end; index++)
+	{
+		auto character = static_cast<uint8_t>(buffer[index]);
+
+		// Control characters except HTAB, CR and LF cannot be in the header (obs-text (0x80~0xFF) is allowed)
+		if (((character < 0x20) && (character != '\t') && (character != '\r') && (character != '\n')) || (character == 0x7F))
 		{
-			// An error occurred during parsing
-			used_length = -1L;
+			// Binary data found
 			_parse_status = HttpStatusCode::BadRequest;
+			return -1L;
 		}
 	}
-	else
+
+	if (position == nullptr)
 	{
+		if (_header_buffer.size() >= MaxHeaderLength)
+		{
+			logtw("Too large header: %zu bytes (max: %zu bytes)", _header_buffer.size(), MaxHeaderLength);
+
+			_parse_status = HttpStatusCode::BadRequest;
+			return -1L;
+		}
+
 		// Need more data
+		return static_cast<ssize_t>(new_length);
+	}
 
-		// Check if data consists of non-binary data
-		auto data_to_check = data->GetDataAs<char>();
-		auto remained = data->GetLength();
+	// If the parser find "\r\n\r\n", start parsing
+	size_t header_length = (position - buffer) + NewLinesLength;
 
-		while (remained > 0)
-		{
-			char character = *data_to_check;
-
-			// isprint(): 32 <= character <= 126
-			// isspace(): 9 <= character <= 13
-			// reference: https://en.cppreference.com/w/cpp/string/byte/isprint
-			if (::isprint(character) || ::isspace(character))
-			{
-				character++;
-				remained--;
-
-				continue;
-			}
-			else
-			{
-				// Binary data found
-				used_length = -1;
-				_parse_status = HttpStatusCode::BadRequest;
-				break;
-			}
-		}
+	// Used length =
+	//             [Length of the header] -
+	//             [Length of the header which was received before]
+	ssize_t used_length = static_cast<ssize_t>(header_length - previous_length);
+
+	// Leave the last "\r\n" only to make the parser simple (every line ends with "\r\n")
+	_header_buffer.resize(header_length - (NewLinesLength / 2));
+
+	_is_header_found = true;
+	_parse_status = ParseMessage();
+
+	if (_parse_status == HttpStatusCode::OK)
+	{
+		// Calculate some informations such as Content length
+		PostProcess();
+	}
+	else
+	{
+		// An error occurred during parsing
+		used_length = -1L;
+		_parse_status = HttpStatusCode::BadRequest;
 	}
 
 	return used_length;
@@ -145,72 +198,95 @@ HttpStatusCode HttpRequest::ParseMessage()
 	// RFC7230 - 3.1. Start Line
 	// start-line     = request-line / status-line
 
-	// Tokenize by "\r\n"
-	std::vector<ov::String> tokens = _request_string.Split("\r\n");
+	// Tokenize by "\r\n" (without copying the lines)
+	std::string_view message(_header_buffer.data(), _header_buffer.size());
+	bool is_request_line = true;
 
-	HttpStatusCode status_code;
-
-	status_code = ParseRequestLine(tokens[0]);
-	tokens.erase(tokens.begin());
+	if (_request_header.capacity() == 0)
+	{
+		_request_header.reserve(DefaultHeaderCount);
+	}
 
-	if (status_code == HttpStatusCode::OK)
+	while (message.empty() == false)
 	{
-		for (const ov::String &token : tokens)
+		auto line_end = message.find("\r\n");
+
+		if (line_end == std::string_view::npos)
 		{
-			status_code = ParseHeader(token);
+			// Every line ends with "\r\n"
+			OV_ASSERT2(false);
+			return HttpStatusCode::BadRequest;
+		}
 
-			if (status_code != HttpStatusCode::OK)
-			{
-				break;
-			}
+		auto line = message.substr(0, line_end);
+		message.remove_prefix(line_end + 2);
+
+		HttpStatusCode status_code = is_request_line ? ParseRequestLine(line) : ParseHeader(line);
+
+		if (status_code != HttpStatusCode::OK)
+		{
+			return status_code;
 		}
-	}
 
-	logtd("Request Headers: %ld:", _request_header.size());
+		is_request_line = false;
+	}
 
-	std::for_each(_request_header.begin(), _request_header.end(), [](const auto &pair) -> void {
-		logtd("\t>> %s: %s", pair.first.CStr(), pair.second.CStr());
-	});
+	if (is_request_line)
+	{
+		logtw("Request line is empty");
+		return HttpStatusCode::BadRequest;
+	}
 
-	return status_code;
-}
+	logtd("Request Headers: %zu:", _request_header.size());
 
-#define HTTP_COMPARE_METHOD(text, value_if_matches) \
-	if (method == text)                             \
-	{                                               \
-		_method = value_if_matches;                 \
+	for ([[maybe_unused]] const auto &field : _request_header)
+	{
+		logtd("\t>> %.*s: %.*s", static_cast<int>(field.name.length()), field.name.data(), static_cast<int>(field.value.length()), field.value.data());
 	}
 
-HttpStatusCode HttpRequest::ParseRequestLine(const ov::String &line)
+	return HttpStatusCode::OK;
+}
+
+HttpStatusCode HttpRequest::ParseRequestLine(std::string_view line)
 {
 	// RFC7230 - 3.1.1. Request Line
 	// request-line   = method SP request-target SP HTTP-version CRLF
-	ssize_t first_space_index = line.IndexOf(' ');
-	ssize_t last_space_index = line.IndexOfRev(' ');
+	auto first_space_index = line.find(' ');
+	auto last_space_index = line.rfind(' ');
 
-	if ((first_space_index < 0) || (last_space_index < 0) || (first_space_index == last_space_index))
+	if ((first_space_index == std::string_view::npos) || (first_space_index == last_space_index))
 	{
-		logtw("Invalid space index: first: %d, last: %d, line: %s", first_space_index, last_space_index, line.CStr());
+		logtw("Invalid request line: %.*s", static_cast<int>(line.length()), line.data());
 		return HttpStatusCode::BadRequest;
 	}
 
-	_method = HttpMethod::Unknown;
-
 	// RFC7231 - 4. Request Methods
-	ov::String method = line.Left(static_cast<size_t>(first_space_index));
+	static const std::pair<std::string_view, HttpMethod> method_list[] = {
+		{"GET", HttpMethod::Get},
+		{"HEAD", HttpMethod::Head},
+		{"POST", HttpMethod::Post},
+		{"PUT", HttpMethod::Put},
+		{"DELETE", HttpMethod::Delete},
+		{"CONNECT", HttpMethod::Connect},
+		{"OPTIONS", HttpMethod::Options},
+		{"TRACE", HttpMethod::Trace}};
+
+	auto method = line.substr(0, first_space_index);
+
+	_method = HttpMethod::Unknown;
 
-	HTTP_COMPARE_METHOD("GET", HttpMethod::Get);
-	HTTP_COMPARE_METHOD("HEAD", HttpMethod::Head);
-	HTTP_COMPARE_METHOD("POST", HttpMethod::Post);
-	HTTP_COMPARE_METHOD("PUT", HttpMethod::Put);
-	HTTP_COMPARE_METHOD("DELETE", HttpMethod::Delete);
-	HTTP_COMPARE_METHOD("CONNECT", HttpMethod::Connect);
-	HTTP_COMPARE_METHOD("OPTIONS", HttpMethod::Options);
-	HTTP_COMPARE_METHOD("TRACE", HttpMethod::Trace);
+	for (const auto &item : method_list)
+	{
+		if (method == item.first)
+		{
+			_method = item.second;
+			break;
+		}
+	}
 
 	if (_method == HttpMethod::Unknown)
 	{
-		logtw("Unknown method: %s", method.CStr());
+		logtw("Unknown method: %.*s", static_cast<int>(method.length()), method.data());
 		return HttpStatusCode::MethodNotAllowed;
 	}
 
@@ -219,18 +295,33 @@ HttpStatusCode HttpRequest::ParseRequestLine(const ov::String &line)
 	//            / absolute-form
 	//            / authority-form
 	//            / asterisk-form
-	_request_target = line.Substring(first_space_index + 1, static_cast<size_t>(last_space_index - first_space_index - 1));
+	auto request_target = line.substr(first_space_index + 1, last_space_index - first_space_index - 1);
+	_request_target = ov::String(request_target.data(), request_target.length());
 
 	// RFC7230 - 2.6. Protocol Versioning
 	// HTTP-version  = HTTP-name "/" DIGIT "." DIGIT
 	// HTTP-name     = %x48.54.54.50 ; "HTTP", case-sensitive
-	_http_version = line.Substring(last_space_index + 1);
+	auto http_version = line.substr(last_space_index + 1);
+	_http_version = ov::String(http_version.data(), http_version.length());
+
+	const std::string_view http_name = "HTTP/";
+
+	if ((http_version.length() == (http_name.length() + 3)) &&
+		(http_version.substr(0, http_name.length()) == http_name) &&
+		::isdigit(http_version[http_name.length()]) && (http_version[http_name.length() + 1] == '.') && ::isdigit(http_version[http_name.length() + 2]))
+	{
+		_http_version_number = (http_version[http_name.length()] - '0') + ((http_version[http_name.length() + 2] - '0') / 10.0);
+	}
+	else
+	{
+		_http_version_number = 0.0;
+	}
 
-	logtd("Method: [%s], uri: [%s], version: [%s]", method.CStr(), _request_target.CStr(), _http_version.CStr());
+	logtd("Method: [%.*s], uri: [%s], version: [%s]", static_cast<int>(method.length()), method.data(), _request_target.CStr(), _http_version.CStr());
 	return HttpStatusCode::OK;
 }
 
-HttpStatusCode HttpRequest::ParseHeader(const ov::String &line)
+HttpStatusCode HttpRequest::ParseHeader(std::string_view line)
 {
 	// RFC7230 - 3.2.  Header Fields
 	// header-field   = field-name ":" OWS field-value OWS
@@ -256,24 +347,50 @@ HttpStatusCode HttpRequest::ParseHeader(const ov::String &line)
 	// the obs-fold rule) unless the message is intended for packaging
 	// within the message/http media type.
 
-	ssize_t colon_index = line.IndexOf(':');
+	auto colon_index = line.find(':');
 
-	if (colon_index == -1)
+	if ((colon_index == std::string_view::npos) || (colon_index == 0))
 	{
-		logtw("Invalid header (could not find colon): %s", line.CStr());
+		logtw("Invalid header (could not find colon): %.*s", static_cast<int>(line.length()), line.data());
 		return HttpStatusCode::BadRequest;
 	}
 
-	// Convert all header names to uppercase
-	ov::String field_name = line.Left(static_cast<size_t>(colon_index)).UpperCaseString();
+	auto field_name = line.substr(0, colon_index);
 	// Eliminate OWS(optional white space) to simplify processing
-	ov::String field_value = line.Substring(colon_index + 1).Trim();
+	auto field_value = TrimView(line.substr(colon_index + 1));
+	auto hash = HashHeaderName(field_name.data(), field_name.length());
+
+	// If there are duplicated fields, the last one is used
+	for (auto &field : _request_header)
+	{
+		if ((field.hash == hash) && IsEqualIgnoreCase(field.name, field_name))
+		{
+			field.value = field_value;
+			return HttpStatusCode::OK;
+		}
+	}
 
-	_request_header[field_name] = field_value;
+	_request_header.push_back({hash, field_name, field_value});
 
 	return HttpStatusCode::OK;
 }
 
+const HttpHeaderField *HttpRequest::FindHeader(const char *key) const noexcept
+{
+	std::string_view name(key);
+	auto hash = HashHeaderName(name.data(), name.length());
+
+	for (const auto &field : _request_header)
+	{
+		if ((field.hash == hash) && IsEqualIgnoreCase(field.name, name))
+		{
+			return &field;
+		}
+	}
+
+	return nullptr;
+}
+
 ov::String HttpRequest::GetHeader(const ov::String &key) const noexcept
 {
 	return GetHeader(key, "");
@@ -281,19 +398,54 @@ ov::String HttpRequest::GetHeader(const ov::String &key) const noexcept
 
 ov::String HttpRequest::GetHeader(const ov::String &key, ov::String default_value) const noexcept
 {
-	auto item = _request_header.find(key.UpperCaseString());
+	auto field = FindHeader(key.CStr());
 
-	if (item == _request_header.cend())
+	if (field == nullptr)
 	{
 		return std::move(default_value);
 	}
 
-	return item->second;
+	return ov::String(field->value.data(), field->value.length());
+}
+
+std::string_view HttpRequest::GetHeaderView(const char *key) const noexcept
+{
+	auto field = FindHeader(key);
+
+	return (field != nullptr) ? field->value : std::string_view();
 }
 
 const bool HttpRequest::IsHeaderExists(const ov::String &key) const noexcept
 {
-	return _request_header.find(key.UpperCaseString()) != _request_header.cend();
+	return FindHeader(key.CStr()) != nullptr;
+}
+
+bool HttpRequest::IsKeepAliveRequested() const noexcept
+{
+	// The default is "keep-alive" since HTTP/1.1
+	bool keep_alive = (_http_version_number >= 1.1);
+
+	// connection-option = token (comma separated)
+	auto connection = GetHeaderView("Connection");
+
+	while (connection.empty() == false)
+	{
+		auto comma_index = connection.find(',');
+		auto option = TrimView(connection.substr(0, comma_index));
+
+		if (IsEqualIgnoreCase(option, "close"))
+		{
+			return false;
+		}
+		else if (IsEqualIgnoreCase(option, "keep-alive"))
+		{
+			keep_alive = true;
+		}
+
+		connection.remove_prefix((comma_index == std::string_view::npos) ? connection.length() : (comma_index + 1));
+	}
+
+	return keep_alive;
 }
 
 void HttpRequest::PostProcess()
@@ -9,11 +9,25 @@
 #pragma once
 #include <base/ovlibrary/converter.h>
 
+#include <string_view>
+
 #include "http_datastructure.h"
 #include "interceptors/http_request_interceptor.h"
 
 class HttpClient;
 
+// A header field of the request
+//
+// The name and the value refer to the header buffer of the HttpRequest, so they are valid until the next request is parsed
+struct HttpHeaderField
+{
+	// Case-insensitive hash of the name (to compare the names quickly)
+	uint32_t hash;
+
+	std::string_view name;
+	std::string_view value;
+};
+
 class HttpRequest : public ov::EnableSharedFromThis<HttpRequest>
 {
 public:
@@ -60,16 +74,14 @@ public:
 
 	double GetHttpVersionAsNumber() const noexcept
 	{
-		auto tokens = _http_version.Split("/");
-
-		if (tokens.size() != 2)
-		{
-			return 0.0;
-		}
-
-		return ov::Converter::ToDouble(tokens[1]);
+		return _http_version_number;
 	}
 
+	// RFC7230 - 6.3. Persistence
+	// HTTP/1.1 connections are persistent unless "Connection: close" is present,
+	// and HTTP/1.0 connections are persistent only when "Connection: keep-alive" is present
+	bool IsKeepAliveRequested() const noexcept;
+
 	// Full URI (including domain and port)
 	// Example: http://<domain>:<port>/<app>/<stream>/...
 	const ov::String &GetUri() const noexcept
@@ -97,13 +109,15 @@ public:
 		return _request_body;
 	}
 
-	const std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> &GetRequestHeader() const noexcept
+	const std::vector<HttpHeaderField> &GetRequestHeader() const noexcept
 	{
 		return _request_header;
 	}
 
 	ov::String GetHeader(const ov::String &key) const noexcept;
 	ov::String GetHeader(const ov::String &key, ov::String default_value) const noexcept;
+	// Returns the value without copying it (valid until the next request is parsed)
+	std::string_view GetHeaderView(const char *key) const noexcept;
 	const bool IsHeaderExists(const ov::String &key) const noexcept;
 
 	bool SetRequestInterceptor(const std::shared_ptr<HttpRequestInterceptor> &interceptor) noexcept
@@ -154,17 +168,23 @@ public:
 
 	ov::String ToString() const;
 
+	// Prepares to parse the next request on the same connection
+	// (The buffers are reused, so no memory is allocated for the headers in the steady state)
 	void InitParseInfo()
 	{
 		_parse_status = HttpStatusCode::PartialContent;
 
 		_is_header_found = false;
-		_request_string = "";
+		_header_buffer.clear();
 		_request_header.clear();
 
 		_method = HttpMethod::Unknown;
 		_request_target = "";
 		_http_version = "";
+		_http_version_number = 0.0;
+
+		_content_length = 0L;
+		_request_body = nullptr;
 	}
 
 protected:
@@ -180,8 +200,10 @@ protected:
 	}
 
 	HttpStatusCode ParseMessage();
-	HttpStatusCode ParseRequestLine(const ov::String &line);
-	HttpStatusCode ParseHeader(const ov::String &line);
+	HttpStatusCode ParseRequestLine(std::string_view line);
+	HttpStatusCode ParseHeader(std::string_view line);
+
+	const HttpHeaderField *FindHeader(const char *key) const noexcept;
 
 	void PostProcess();
 	void UpdateUri();
@@ -200,14 +222,16 @@ protected:
 	ov::String _request_uri;
 	ov::String _request_target;
 	ov::String _http_version;
+	double _http_version_number = 0.0;
 
 	ov::MatchResult _match_result;
 
 	// request 헤더
 	bool _is_header_found = false;
-	// 헤더 영역을 추출해내기 위해 임시로 사용되는 문자열 버퍼
-	ov::String _request_string;
-	std::map<ov::String, ov::String, ov::CaseInsensitiveComparator> _request_header;
+	// 헤더 영역을 모아두는 버퍼 (헤더를 찾으면 더 이상 변경되지 않으므로, _request_header는 이 버퍼를 가리킴)
+	std::vector<char> _header_buffer;
+	// 헤더가 많지 않으므로, map 대신 배열에서 hash로 찾음
+	std::vector<HttpHeaderField> _request_header;
 
 	// 자주 사용하는 헤더 값은 미리 저장해놓음
 	ssize_t _content_length = 0L;
@@ -76,7 +76,7 @@ bool HttpResponse::AppendData(const std::shared_ptr<const ov::Data> &data)
 
 	std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
 
-	_response_data_list.push_back(data);
+	_response_item_list.push_back({data, nullptr});
 	_response_data_size += data->GetLength();
 
 	return true;
@@ -89,27 +89,126 @@ bool HttpResponse::AppendString(const ov::String &string)
 
 bool HttpResponse::AppendFile(const ov::String &filename)
 {
-	// TODO: ov::Data에 파일에서 읽는 기능이 추가되면 그 때 구현
-	OV_ASSERT(false, "Not implemented");
-
-	return false;
+	return AppendFile(ov::FileRange::Open(filename));
 }
 
-uint32_t HttpResponse::Response()
+bool HttpResponse::AppendFile(const std::shared_ptr<const ov::FileRange> &file)
 {
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	if (_chunked_transfer)
+	{
+		// The length of a chunk must be known before sending it, so just read the file
+		auto data = file->Read();
+
+		return (data != nullptr) && AppendData(data);
+	}
+
 	std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
 
-	return SendHeaderIfNeeded() + SendResponse();
+	_response_item_list.push_back({nullptr, file});
+	_response_data_size += file->GetLength();
+
+	return true;
 }
 
-uint32_t HttpResponse::SendHeaderIfNeeded()
+uint32_t HttpResponse::Response()
 {
-	if (_is_header_sent)
+	std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+	// The header and the data are sent at once
+	std::vector<std::shared_ptr<const ov::Data>> data_list;
+	std::shared_ptr<const ov::Data> header;
+
+	if (_is_header_sent == false)
+	{
+		header = MakeHeader();
+		data_list.push_back(header);
+	}
+
+	if (data_list.empty() && _response_item_list.empty())
 	{
-		// The headers are already sent
 		return 0;
 	}
 
+	logtd("Trying to send datas...");
+
+	uint32_t sent_bytes = _response_data_size;
+	auto item_list = std::move(_response_item_list);
+
+	_response_item_list.clear();
+	_response_data_size = 0ULL;
+
+	bool result = true;
+
+	for (const auto &item : item_list)
+	{
+		if (item.file != nullptr)
+		{
+			// Send the data in front of the file first
+			result = data_list.empty() || Send(data_list);
+			data_list.clear();
+
+			result = result && SendFile(item.file);
+
+			if (result == false)
+			{
+				break;
+			}
+		}
+		else if (_chunked_transfer)
+		{
+			AppendChunk(data_list, item.data);
+		}
+		else
+		{
+			data_list.push_back(item.data);
+		}
+	}
+
+	if (result && (data_list.empty() == false))
+	{
+		result = Send(data_list);
+	}
+
+	if (result == false)
+	{
+		return 0;
+	}
+
+	if (header != nullptr)
+	{
+		logtd("Header is sent:\n%s", header->Dump(header->GetLength()).CStr());
+
+		_is_header_sent = true;
+		sent_bytes += header->GetLength();
+	}
+
+	logtd("All datas are sent...");
+
+	return sent_bytes;
+}
+
+void HttpResponse::ResetResponse()
+{
+	std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+	SetStatusCode(HttpStatusCode::OK);
+
+	_is_header_sent = false;
+	_response_header.clear();
+
+	_response_item_list.clear();
+	_response_data_size = 0;
+
+	_chunked_transfer = false;
+}
+
+std::shared_ptr<const ov::Data> HttpResponse::MakeHeader()
+{
 	std::shared_ptr<ov::Data> response = std::make_shared<ov::Data>();
 	ov::ByteStream stream(response.get());
 
@@ -134,16 +233,7 @@ uint32_t HttpResponse::SendHeaderIfNeeded()
 
 	stream.Append("\r\n", 2);
 
-	if (Send(response))
-	{
-		logtd("Header is sent:\n%s", response->Dump(response->GetLength()).CStr());
-
-		_is_header_sent = true;
-
-		return response->GetLength();
-	}
-
-	return 0;
+	return response;
 }
 
 bool HttpResponse::Send(const void *data, size_t length)
@@ -182,6 +272,57 @@ bool HttpResponse::Send(const std::shared_ptr<const ov::Data> &data)
 	return (_client_socket->Send(send_data) == static_cast<ssize_t>(send_data->GetLength()));
 }
 
+bool HttpResponse::Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+{
+	if ((_tls_data != nullptr) && (_tls_data->IsKernelTlsEnabled() == false))
+	{
+		// Encrypt the buffers together to make as few TLS records as possible
+		size_t total_length = 0;
+
+		for (const auto &data : data_list)
+		{
+			total_length += data->GetLength();
+		}
+
+		auto plain_data = std::make_shared<ov::Data>(total_length);
+
+		for (const auto &data : data_list)
+		{
+			plain_data->Append(data);
+		}
+
+		return Send(plain_data);
+	}
+
+	ssize_t total_length = 0;
+
+	for (const auto &data : data_list)
+	{
+		total_length += data->GetLength();
+	}
+
+	return (_client_socket->Send(data_list) == total_length);
+}
+
+bool HttpResponse::SendFile(const std::shared_ptr<const ov::FileRange> &file)
+{
+	if (file == nullptr)
+	{
+		OV_ASSERT2(file != nullptr);
+		return false;
+	}
+
+	if ((_tls_data != nullptr) && (_tls_data->IsKernelTlsEnabled() == false))
+	{
+		// OpenSSL needs the plain data in the memory to encrypt it
+		auto data = file->Read();
+
+		return (data != nullptr) && Send(data);
+	}
+
+	return (_client_socket->SendFile(file) == static_cast<ssize_t>(file->GetLength()));
+}
+
 bool HttpResponse::SendChunkedData(const void *data, size_t length)
 {
 	return SendChunkedData(std::make_shared<ov::Data>(data, length));
@@ -189,58 +330,130 @@ bool HttpResponse::SendChunkedData(const void *data, size_t length)
 
 bool HttpResponse::SendChunkedData(const std::shared_ptr<const ov::Data> &data)
 {
-	if ((data == nullptr) || data->IsEmpty())
-	{
-		// Send a empty chunk
-		return Send("0\r\n\r\n", 5);
-	}
+	std::vector<std::shared_ptr<const ov::Data>> data_list;
 
-	bool result =
-		// Send the chunk header
-		Send(ov::String::FormatString("%x\r\n", data->GetLength()).ToData(false)) &&
-		// Send the chunk payload
-		Send(data) &&
-		// Send a last data of chunk
-		Send("\r\n", 2);
+	AppendChunk(data_list, data);
 
-	return result;
+	return Send(data_list);
 }
 
-uint32_t HttpResponse::SendResponse()
+bool HttpResponse::MakeChunkedData(const std::vector<std::shared_ptr<const ov::Data>> &chunk_list, std::vector<std::shared_ptr<const ov::Data>> &data_list)
 {
-	bool sent = true;
+	std::vector<std::shared_ptr<const ov::Data>> plain_data_list;
 
-	std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+	for (const auto &chunk : chunk_list)
+	{
+		if ((chunk != nullptr) && (chunk->IsEmpty() == false))
+		{
+			AppendChunk(plain_data_list, chunk);
+		}
+	}
 
-	logtd("Trying to send datas...");
+	if (plain_data_list.empty())
+	{
+		return false;
+	}
+
+	if ((_tls_data == nullptr) || _tls_data->IsKernelTlsEnabled())
+	{
+		data_list.insert(data_list.end(), plain_data_list.begin(), plain_data_list.end());
+		return true;
+	}
+
+	size_t total_length = 0;
 
-	uint32_t sent_bytes = 0;
-	for (const auto &data : _response_data_list)
+	for (const auto &data : plain_data_list)
 	{
-		if (_chunked_transfer)
+		total_length += data->GetLength();
+	}
+
+	auto plain_data = std::make_shared<ov::Data>(total_length);
+
+	for (const auto &data : plain_data_list)
+	{
+		plain_data->Append(data);
+	}
+
+	std::shared_ptr<const ov::Data> encrypted_data;
+
+	if (_tls_data->Encrypt(plain_data, &encrypted_data) == false)
+	{
+		return false;
+	}
+
+	if ((encrypted_data == nullptr) || encrypted_data->IsEmpty())
+	{
+		return false;
+	}
+
+	data_list.push_back(encrypted_data);
+
+	return true;
+}
+
+void HttpResponse::SetChunkSource(const ChunkSource &source)
+{
+	// Don't keep a strong reference from the socket to the response
+	std::weak_ptr<HttpResponse> weak_response = GetSharedPtr();
+
+	_client_socket->SetSendSource([weak_response, source](std::vector<std::shared_ptr<const ov::Data>> &data_list) -> bool {
+		auto response = weak_response.lock();
+
+		if (response == nullptr)
 		{
-			sent &= SendChunkedData(data);
-			if (sent == true)
-			{
-				sent_bytes += data->GetLength();
-			}
+			return false;
 		}
-		else
+
+		std::vector<std::shared_ptr<const ov::Data>> chunk_list;
+
+		return source(chunk_list) && response->MakeChunkedData(chunk_list, data_list);
+	});
+
+	// Send the chunks which are already made
+	_client_socket->NotifySendSource();
+}
+
+void HttpResponse::NotifyChunkSource()
+{
+	_client_socket->NotifySendSource();
+}
+
+bool HttpResponse::CompleteChunkSource()
+{
+	auto source = _client_socket->DetachSendSource();
+
+	if (source != nullptr)
+	{
+		std::vector<std::shared_ptr<const ov::Data>> data_list;
+
+		// The data is already framed/encrypted
+		if (source(data_list) && (_client_socket->Send(data_list) < 0))
 		{
-			sent &= Send(data);
-			if (sent == true)
-			{
-				sent_bytes += data->GetLength();
-			}
+			return false;
 		}
 	}
 
-	_response_data_list.clear();
-	_response_data_size = 0ULL;
+	return SendChunkedData(nullptr);
+}
 
-	logtd("All datas are sent...");
+void HttpResponse::AppendChunk(std::vector<std::shared_ptr<const ov::Data>> &data_list, const std::shared_ptr<const ov::Data> &data)
+{
+	static const auto last_chunk = std::make_shared<const ov::Data>("0\r\n\r\n", 5, true);
+	static const auto crlf = std::make_shared<const ov::Data>("\r\n", 2, true);
 
-	return sent_bytes;
+	if ((data == nullptr) || data->IsEmpty())
+	{
+		// Send a empty chunk
+		data_list.push_back(last_chunk);
+		return;
+	}
+
+	// The chunk header
+	data_list.push_back(ov::String::FormatString("%zx\r\n", data->GetLength()).ToData(false));
+	// The chunk payload
+	data_list.push_back(data);
+	// A last data of chunk
+	data_list.push_back(crlf);
 }
 
 bool HttpResponse::Close()
@@ -57,11 +57,13 @@ public:
 	bool SetHeader(const ov::String &key, const ov::String &value);
 	const ov::String &GetHeader(const ov::String &key);
 
-	// Enqueue the data into the queue (This data will be sent when SendResponse() is called)
+	// Enqueue the data into the queue (This data will be sent when Response() is called)
 	// Can be used for response with content-length
 	bool AppendData(const std::shared_ptr<const ov::Data> &data);
 	bool AppendString(const ov::String &string);
+	// The file is sent with sendfile() if possible, so large files can be sent without reading them into the memory
 	bool AppendFile(const ov::String &filename);
+	bool AppendFile(const std::shared_ptr<const ov::FileRange> &file);
 
 	// Send the data immediately
 	// Can be used for response without content-length
@@ -72,12 +74,30 @@ public:
 	}
 	virtual bool Send(const void *data, size_t length);
 	virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+	// Send the buffers at once (with a writev-like system call, or in a TLS record)
+	virtual bool Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
+	// Send the file without copying it into the memory (The file is read into the memory only for a TLS connection without kTLS)
+	virtual bool SendFile(const std::shared_ptr<const ov::FileRange> &file);
 
 	bool SendChunkedData(const void *data, size_t length);
 	bool SendChunkedData(const std::shared_ptr<const ov::Data> &data);
 
+	// Appends the chunks to send to chunk_list, and returns false if there is no chunk for now
+	typedef std::function<bool(std::vector<std::shared_ptr<const ov::Data>> &chunk_list)> ChunkSource;
+
+	// The chunks are pulled from the source when the socket is writable, instead of being sent by the thread that makes them
+	// (Must be called after the header is sent with Response())
+	void SetChunkSource(const ChunkSource &source);
+	// Called when the source has new chunks
+	void NotifyChunkSource();
+	// Stops pulling, and sends the rest of the chunks and the last chunk
+	bool CompleteChunkSource();
+
 	uint32_t Response();
 
+	// Prepares the response for the next request on the same connection (keep-alive)
+	void ResetResponse();
+
 	bool Close();
 
 	void SetKeepAlive()
@@ -97,8 +117,18 @@ public:
 	}
 
 protected:
-	uint32_t SendHeaderIfNeeded();
-	uint32_t SendResponse();
+	// One of data or file is used
+	struct ResponseItem
+	{
+		std::shared_ptr<const ov::Data> data;
+		std::shared_ptr<const ov::FileRange> file;
+	};
+
+	std::shared_ptr<const ov::Data> MakeHeader();
+	// Append the chunk framing and the data to the list
+	void AppendChunk(std::vector<std::shared_ptr<const ov::Data>> &data_list, const std::shared_ptr<const ov::Data> &data);
+	// Make the data to send from the chunks (framing + TLS)
+	bool MakeChunkedData(const std::vector<std::shared_ptr<const ov::Data>> &chunk_list, std::vector<std::shared_ptr<const ov::Data>> &data_list);
 
 	std::shared_ptr<ov::ClientSocket> _client_socket;
 	std::shared_ptr<ov::TlsData> _tls_data;
@@ -115,7 +145,7 @@ protected:
 	// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 	std::recursive_mutex _response_mutex;
 	size_t _response_data_size = 0;
-	std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+	std::vector<ResponseItem> _response_item_list;
 
 	ov::String _default_value = "";
 
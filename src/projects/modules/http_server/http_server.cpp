@@ -87,6 +87,19 @@ bool HttpServer::IsRunning() const
 	return (_physical_port != nullptr);
 }
 
+bool HttpServer::SetSendQueueSize(size_t high_water_mark)
+{
+	auto lock_guard = std::lock_guard(_physical_port_mutex);
+
+	if (_physical_port == nullptr)
+	{
+		logtw("Server is not running");
+		return false;
+	}
+
+	return _physical_port->SetSendQueueSize(high_water_mark);
+}
+
 ssize_t HttpServer::TryParseHeader(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data)
 {
 	auto request = client->GetRequest();
@@ -132,106 +145,168 @@ std::shared_ptr<HttpClient> HttpServer::FindClient(const std::shared_ptr<ov::Soc
 
 void HttpServer::ProcessData(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data)
 {
-	if (client != nullptr)
+	if (client == nullptr)
 	{
-		std::shared_ptr<HttpRequest> request = client->GetRequest();
-		std::shared_ptr<HttpResponse> response = client->GetResponse();
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock_guard(client->_process_mutex);
+
+	client->_idle_since = 0;
 
-		bool need_to_disconnect = false;
+	if (client->_is_waiting_for_response)
+	{
+		// HTTP pipelining - The next requests are processed after the response of the current request is sent
+		auto pipelined_length = (client->_pipelined_data != nullptr) ? client->_pipelined_data->GetLength() : 0;
 
-		switch (request->ParseStatus())
+		if ((pipelined_length + data->GetLength()) > HTTP_MAX_PIPELINED_DATA_LENGTH)
 		{
-			case HttpStatusCode::OK: {
-				auto interceptor = request->GetRequestInterceptor();
+			logtw("Too many pipelined requests from %s: %zu bytes", client->GetRequest()->GetRemote()->ToString().CStr(), pipelined_length + data->GetLength());
+			client->GetResponse()->Close();
+			return;
+		}
 
-				if (interceptor != nullptr)
-				{
-					// If the request is parsed, bypass to the interceptor
-					need_to_disconnect = (interceptor->OnHttpData(client, data) == HttpInterceptorResult::Disconnect);
-				}
-				else
-				{
-					OV_ASSERT2(false);
-					need_to_disconnect = true;
-				}
+		client->WaitForResponse(data);
+		return;
+	}
 
-				break;
+	ProcessDataInternal(client, data);
+}
+
+bool HttpServer::ProcessNextRequest(const std::shared_ptr<HttpClient> &client)
+{
+	std::lock_guard<std::mutex> lock_guard(client->_process_mutex);
+
+	auto request = client->GetRequest();
+	auto response = client->GetResponse();
+
+	if (request->GetRemote()->GetState() != ov::SocketState::Connected)
+	{
+		return false;
+	}
+
+	request->InitParseInfo();
+	response->ResetResponse();
+
+	// Set default headers
+	response->SetHeader("Server", "OvenMediaEngine");
+	response->SetHeader("Content-Type", "text/html");
+
+	client->_is_waiting_for_response = false;
+	client->_completed_request_count++;
+	auto pipelined_data = std::move(client->_pipelined_data);
+
+	if (pipelined_data != nullptr)
+	{
+		ProcessDataInternal(client, pipelined_data);
+	}
+	else
+	{
+		client->_idle_since = ov::Clock::NowMSec();
+	}
+
+	return true;
+}
+
+void HttpServer::ProcessDataInternal(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data)
+{
+	std::shared_ptr<HttpRequest> request = client->GetRequest();
+	std::shared_ptr<HttpResponse> response = client->GetResponse();
+
+	bool need_to_disconnect = false;
+
+	switch (request->ParseStatus())
+	{
+		case HttpStatusCode::OK: {
+			auto interceptor = request->GetRequestInterceptor();
+
+			if (interceptor != nullptr)
+			{
+				// If the request is parsed, bypass to the interceptor
+				need_to_disconnect = (interceptor->OnHttpData(client, data) == HttpInterceptorResult::Disconnect);
+			}
+			else
+			{
+				OV_ASSERT2(false);
+				need_to_disconnect = true;
 			}
 
-			case HttpStatusCode::PartialContent: {
-				// Need to parse HTTP header
-				ssize_t processed_length = TryParseHeader(client, data);
+			break;
+		}
 
-				if (processed_length >= 0)
+		case HttpStatusCode::PartialContent: {
+			// Need to parse HTTP header
+			ssize_t processed_length = TryParseHeader(client, data);
+
+			if (processed_length >= 0)
+			{
+				if (request->ParseStatus() == HttpStatusCode::OK)
 				{
-					if (request->ParseStatus() == HttpStatusCode::OK)
+					// Parsing is completed
+
+					// Find interceptor for the request
 					{
-						// Parsing is completed
+						std::shared_lock<std::shared_mutex> guard(_interceptor_list_mutex);
 
-						// Find interceptor for the request
+						for (auto &interceptor : _interceptor_list)
 						{
-							std::shared_lock<std::shared_mutex> guard(_interceptor_list_mutex);
-
-							for (auto &interceptor : _interceptor_list)
+							if (interceptor->IsInterceptorForRequest(client))
 							{
-								if (interceptor->IsInterceptorForRequest(client))
-								{
-									request->SetRequestInterceptor(interceptor);
-									request->SetConnectionType(interceptor->GetConnectionType());
-									break;
-								}
+								request->SetRequestInterceptor(interceptor);
+								request->SetConnectionType(interceptor->GetConnectionType());
+								break;
 							}
 						}
+					}
 
-						auto interceptor = request->GetRequestInterceptor();
-
-						if (interceptor == nullptr)
-						{
-							response->SetStatusCode(HttpStatusCode::InternalServerError);
+					auto interceptor = request->GetRequestInterceptor();
 
-							need_to_disconnect = true;
-							OV_ASSERT2(false);
-						}
+					if (interceptor == nullptr)
+					{
+						response->SetStatusCode(HttpStatusCode::InternalServerError);
 
-						auto remote = request->GetRemote();
+						need_to_disconnect = true;
+						OV_ASSERT2(false);
+					}
 
-						if (remote != nullptr)
-						{
-							logti("Client(%s) is requested uri: [%s]", remote->GetRemoteAddress()->ToString().CStr(), request->GetUri().CStr());
-						}
+					auto remote = request->GetRemote();
 
-						need_to_disconnect = need_to_disconnect || (interceptor->OnHttpPrepare(client) == HttpInterceptorResult::Disconnect);
-						need_to_disconnect = need_to_disconnect || (interceptor->OnHttpData(client, data->Subdata(processed_length)) == HttpInterceptorResult::Disconnect);
-					}
-					else if (request->ParseStatus() == HttpStatusCode::PartialContent)
+					if (remote != nullptr)
 					{
-						// Need more data
+						logti("Client(%s) is requested uri: [%s]", remote->GetRemoteAddress()->ToString().CStr(), request->GetUri().CStr());
 					}
+
+					need_to_disconnect = need_to_disconnect || (interceptor->OnHttpPrepare(client) == HttpInterceptorResult::Disconnect);
+					need_to_disconnect = need_to_disconnect || (interceptor->OnHttpData(client, data->Subdata(processed_length)) == HttpInterceptorResult::Disconnect);
 				}
-				else
+				else if (request->ParseStatus() == HttpStatusCode::PartialContent)
 				{
-					// An error occurred with the request
-					request->GetRequestInterceptor()->OnHttpError(client, HttpStatusCode::BadRequest);
-					need_to_disconnect = true;
+					// Need more data
 				}
-
-				break;
 			}
-
-			default:
-				// 이전에 parse 할 때 오류가 발생했다면 response한 뒤 close() 했으므로, 정상적인 상황이라면 여기에 진입하면 안됨
-				logte("Invalid parse status: %d", request->ParseStatus());
-				OV_ASSERT2(false);
+			else
+			{
+				// An error occurred with the request
+				request->GetRequestInterceptor()->OnHttpError(client, HttpStatusCode::BadRequest);
 				need_to_disconnect = true;
-				break;
-		}
+			}
 
-		if (need_to_disconnect)
-		{
-			// 연결을 종료해야 함
-			response->Response();
-			response->Close();
+			break;
 		}
+
+		default:
+			// 이전에 parse 할 때 오류가 발생했다면 response한 뒤 close() 했으므로, 정상적인 상황이라면 여기에 진입하면 안됨
+			logte("Invalid parse status: %d", request->ParseStatus());
+			OV_ASSERT2(false);
+			need_to_disconnect = true;
+			break;
+	}
+
+	if (need_to_disconnect)
+	{
+		// 연결을 종료해야 함
+		response->Response();
+		response->Close();
 	}
 }
 
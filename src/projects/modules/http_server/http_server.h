@@ -42,6 +42,9 @@ public:
 
 	bool IsRunning() const;
 
+	// Applied to the clients connected after calling this
+	bool SetSendQueueSize(size_t high_water_mark);
+
 	bool AddInterceptor(const std::shared_ptr<HttpRequestInterceptor> &interceptor);
 	bool RemoveInterceptor(const std::shared_ptr<HttpRequestInterceptor> &interceptor);
 
@@ -51,6 +54,9 @@ public:
 	// If the iterator returns true, the client will be disconnected
 	bool DisconnectIf(ClientIterator iterator);
 
+	// Prepares the client for the next request on the same connection (keep-alive), and processes the pipelined requests
+	bool ProcessNextRequest(const std::shared_ptr<HttpClient> &client);
+
 protected:
 	// @return 파싱이 성공적으로 되었다면 true를, 데이터가 더 필요하거나 오류가 발생하였다면 false이 반환됨
 	ssize_t TryParseHeader(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data);
@@ -59,6 +65,8 @@ protected:
 
 	std::shared_ptr<HttpClient> ProcessConnect(const std::shared_ptr<ov::Socket> &remote);
 	void ProcessData(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data);
+	// Must be called while client->_process_mutex is locked
+	void ProcessDataInternal(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const ov::Data> &data);
 
 	//--------------------------------------------------------------------
 	// Implementation of PhysicalPortObserver
@@ -52,6 +52,16 @@ void HttpsServer::OnConnected(const std::shared_ptr<ov::Socket> &remote)
 			return remote->Send(data, length);
 		});
 
+		if (_kernel_tls_enabled)
+		{
+			auto client_socket = std::dynamic_pointer_cast<ov::ClientSocket>(remote);
+
+			tls_data->RequestKernelTls(remote->GetSocket().GetSocket(), [client_socket]() -> bool {
+				// The handshake data queued in the socket must be sent before switching to kernel TLS
+				return (client_socket != nullptr) && (client_socket->GetSendQueueBytes() == 0);
+			});
+		}
+
 		client->GetRequest()->SetTlsData(tls_data);
 		client->GetResponse()->SetTlsData(tls_data);
 	}
@@ -23,6 +23,12 @@ public:
 	// TODO(Dimiden): OME doesn't support SNI yet, so OME can handle only one certificate.
 	bool SetCertificate(const std::shared_ptr<info::Certificate> &certificate);
 
+	// If enabled, the kernel encrypts the responses after the TLS handshake (if the kernel and the cipher support it)
+	void SetKernelTlsEnabled(bool enabled)
+	{
+		_kernel_tls_enabled = enabled;
+	}
+
 protected:
 	//--------------------------------------------------------------------
 	// Implementation of PhysicalPortObserver
@@ -32,4 +38,5 @@ protected:
 
 protected:
 	std::shared_ptr<info::Certificate> _certificate;
+	bool _kernel_tls_enabled = false;
 };
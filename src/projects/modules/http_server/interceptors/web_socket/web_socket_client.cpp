@@ -59,29 +59,30 @@ ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data, WebSo
 
 	auto response = _client->GetResponse();
 
-	response->Send(&header);
+	// The frame header and the payload are sent at once
+	auto frame_header = std::make_shared<ov::Data>(&header, sizeof(header));
 
 	if (header.payload_length == 126)
 	{
 		auto payload_length = ov::HostToNetwork16(static_cast<uint16_t>(length));
 
-		response->Send(&payload_length);
+		frame_header->Append(&payload_length, sizeof(payload_length));
 	}
 	else if (header.payload_length == 127)
 	{
 		auto payload_length = ov::HostToNetwork64(static_cast<uint64_t>(length));
 
-		response->Send(&payload_length);
+		frame_header->Append(&payload_length, sizeof(payload_length));
 	}
 
 	if (length > 0LL)
 	{
 		logtd("Trying to send data\n%s", data->Dump(32).CStr());
 
-		return response->Send(data) ? length : -1LL;
+		return response->Send({frame_header, data}) ? length : -1LL;
 	}
 
-	return length;
+	return response->Send(frame_header) ? length : -1LL;
 }
 
 ssize_t WebSocketClient::Send(const std::shared_ptr<const ov::Data> &data)
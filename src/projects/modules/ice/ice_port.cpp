@@ -21,13 +21,14 @@
 #include <base/info/application.h>
 
 IcePort::IcePort()
+	: _expiry_wheel(ICE_PORT_EXPIRY_TICK_MS)
 {
 	_timer.Push(
 		[this](void *paramter) -> ov::DelayQueueAction {
 			CheckTimedoutItem();
 			return ov::DelayQueueAction::Repeat;
 		},
-		1000);
+		ICE_PORT_EXPIRY_TICK_MS);
 	_timer.Start();
 }
 
@@ -98,6 +99,44 @@ bool IcePort::CreateIceCandidates(std::vector<RtcIceCandidate> ice_candidate_lis
 	return succeeded;
 }
 
+bool IcePort::SetSendBatch(int batch_size, int flush_interval, bool use_gso)
+{
+	std::lock_guard<std::recursive_mutex> lock_guard(_physical_port_list_mutex);
+
+	bool result = true;
+
+	for (auto &physical_port : _physical_port_list)
+	{
+		if (physical_port->GetType() != ov::SocketType::Udp)
+		{
+			continue;
+		}
+
+		result = result && physical_port->SetSendBatch(batch_size, flush_interval, use_gso);
+	}
+
+	return result;
+}
+
+bool IcePort::SetRecvBatch(int batch_size)
+{
+	std::lock_guard<std::recursive_mutex> lock_guard(_physical_port_list_mutex);
+
+	bool result = true;
+
+	for (auto &physical_port : _physical_port_list)
+	{
+		if (physical_port->GetType() != ov::SocketType::Udp)
+		{
+			continue;
+		}
+
+		result = result && physical_port->SetRecvBatch(batch_size);
+	}
+
+	return result;
+}
+
 bool IcePort::CreateTurnServer(ov::SocketAddress address, ov::SocketType socket_type)
 {
 	// {[Browser][WebRTC][TURN Client]} <----(TCP)-----> {[TURN Server][OvenMediaEngine]}
@@ -272,7 +311,7 @@ void IcePort::AddSession(const std::shared_ptr<info::Session> &session_info, std
 		info->address = ov::SocketAddress();
 		info->state = IcePortConnectionState::Closed;
 
-		info->UpdateBindingTime();
+		UpdateBindingTime(info);
 
 		_user_mapping_table[local_ufrag] = info;
 	}
@@ -285,7 +324,7 @@ bool IcePort::RemoveSession(const session_id_t session_id)
 	std::shared_ptr<IcePortInfo> ice_port_info;
 
 	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
+		std::lock_guard<std::shared_mutex> lock_guard(_session_table_mutex);
 
 		auto item = _session_table.find(session_id);
 		if (item == _session_table.end())
@@ -303,6 +342,7 @@ bool IcePort::RemoveSession(const session_id_t session_id)
 					auto ice_port_info = it->second;
 					if (ice_port_info->session_info->GetId() == session_id)
 					{
+						_expiry_wheel.Cancel(ice_port_info);
 						_user_mapping_table.erase(it++);
 						logtw("This is because the stun request was not received from this session.");
 						return true;
@@ -320,7 +360,7 @@ bool IcePort::RemoveSession(const session_id_t session_id)
 		ice_port_info = item->second;
 
 		_session_table.erase(item);
-		_ice_port_info.erase(ice_port_info->address);
+		RemoveIcePortInfo(ice_port_info->address);
 	}
 
 	{
@@ -328,6 +368,8 @@ bool IcePort::RemoveSession(const session_id_t session_id)
 		_user_mapping_table.erase(ice_port_info->offer_sdp->GetIceUfrag());
 	}
 
+	_expiry_wheel.Cancel(ice_port_info);
+
 	return true;
 }
 
@@ -354,7 +396,7 @@ bool IcePort::Send(const std::shared_ptr<info::Session> &session_info, const std
 	std::shared_ptr<IcePortInfo> ice_port_info;
 
 	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
+		std::shared_lock<std::shared_mutex> lock_guard(_session_table_mutex);
 
 		auto item = _session_table.find(session_info->GetId());
 
@@ -387,12 +429,11 @@ void IcePort::OnDisconnected(const std::shared_ptr<ov::Socket> &remote, Physical
 
 void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data)
 {
-	
-
+	// Only the packets that look like STUN are parsed (most of the packets are SRTP/SRTCP)
 	ov::ByteStream stream(data.get());
 	StunMessage message;
 
-	if (message.Parse(stream))
+	if ((FindPacketIdentifier(*data) == IcePacketIdentifier::Stun) && message.Parse(stream))
 	{
 		logtd("Received message:\n%s", message.ToString().CStr());
 
@@ -437,18 +478,7 @@ void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov
 	{
 		logtd("Not Stun packet. Passing data to observer...");
 
-		std::shared_ptr<IcePortInfo> ice_port_info;
-
-		{
-			std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
-
-			auto item = _ice_port_info.find(address);
-
-			if (item != _ice_port_info.end())
-			{
-				ice_port_info = item->second;
-			}
-		}
+		auto ice_port_info = FindIcePortInfo(address);
 
 		if (ice_port_info == nullptr)
 		{
@@ -470,39 +500,49 @@ void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov
 	}
 }
 
+void IcePort::UpdateBindingTime(const std::shared_ptr<IcePortInfo> &info)
+{
+	_expiry_wheel.Schedule(info, info->GetExpireAfterMs());
+}
+
 void IcePort::CheckTimedoutItem()
 {
 	std::vector<std::shared_ptr<IcePortInfo>> delete_list;
 
+	// Process the expired items in small batches, so the STUN binding requests are not blocked for a long time
+	while (_expiry_wheel.Advance(delete_list, ICE_PORT_EXPIRY_BATCH_SIZE) > 0)
 	{
-		std::lock_guard<std::mutex> lock_guard(_user_mapping_table_mutex);
-
-		for (auto item = _user_mapping_table.begin(); item != _user_mapping_table.end();)
 		{
-			if (item->second->IsExpired())
-			{
-				logtd("Client %s(session id: %d) is expired", item->second->address.ToString().CStr(), item->second->session_info->GetId());
-				SetIceState(item->second, IcePortConnectionState::Disconnected);
+			std::lock_guard<std::mutex> lock_guard(_user_mapping_table_mutex);
 
-				delete_list.push_back(item->second);
+			for (auto &deleted_ice_port : delete_list)
+			{
+				auto item = _user_mapping_table.find(deleted_ice_port->offer_sdp->GetIceUfrag());
 
-				item = _user_mapping_table.erase(item);
+				if ((item != _user_mapping_table.end()) && (item->second == deleted_ice_port))
+				{
+					_user_mapping_table.erase(item);
+				}
 			}
-			else
+		}
+
+		{
+			std::lock_guard<std::shared_mutex> lock_guard(_session_table_mutex);
+
+			for (auto &deleted_ice_port : delete_list)
 			{
-				++item;
+				_session_table.erase(deleted_ice_port->session_info->GetId());
+				RemoveIcePortInfo(deleted_ice_port->address);
 			}
 		}
-	}
-
-	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
 
 		for (auto &deleted_ice_port : delete_list)
 		{
-			_session_table.erase(deleted_ice_port->session_info->GetId());
-			_ice_port_info.erase(deleted_ice_port->address);
+			logtd("Client %s(session id: %d) is expired", deleted_ice_port->address.ToString().CStr(), deleted_ice_port->session_info->GetId());
+			SetIceState(deleted_ice_port, IcePortConnectionState::Disconnected);
 		}
+
+		delete_list.clear();
 	}
 }
 
@@ -553,6 +593,8 @@ bool IcePort::ProcessBindingRequest(const std::shared_ptr<ov::Socket> &remote, c
 
 		SetIceState(ice_port_info, IcePortConnectionState::Failed);
 
+		_expiry_wheel.Cancel(ice_port_info);
+
 		{
 			std::lock_guard<std::mutex> lock_guard(_user_mapping_table_mutex);
 
@@ -560,16 +602,16 @@ bool IcePort::ProcessBindingRequest(const std::shared_ptr<ov::Socket> &remote, c
 		}
 
 		{
-			std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
+			std::lock_guard<std::shared_mutex> lock_guard(_session_table_mutex);
 
-			_ice_port_info.erase(ice_port_info->address);
+			RemoveIcePortInfo(ice_port_info->address);
 			_session_table.erase(ice_port_info->session_info->GetId());
 		}
 
 		return false;
 	}
 
-	ice_port_info->UpdateBindingTime();
+	UpdateBindingTime(ice_port_info);
 
 	if (ice_port_info->state == IcePortConnectionState::New)
 	{
@@ -612,13 +654,13 @@ bool IcePort::SendBindingResponse(const std::shared_ptr<ov::Socket> &remote, con
 
 	// client mapping 정보를 저장해놓음
 	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
+		std::lock_guard<std::shared_mutex> lock_guard(_session_table_mutex);
 
 		if (_session_table.find(info->session_info->GetId()) == _session_table.end())
 		{
 			logtd("Add the client to the port list: %s", address.ToString().CStr());
 
-			_ice_port_info[address] = info;
+			AddIcePortInfo(address, info);
 			_session_table[info->session_info->GetId()] = info;
 		}
 		else
@@ -705,24 +747,16 @@ bool IcePort::ProcessBindingResponse(const std::shared_ptr<ov::Socket> &remote,
 {
 	// TODO: state가 checking 상태인지 확인
 
-	std::shared_ptr<IcePortInfo> ice_port_info;
+	auto ice_port_info = FindIcePortInfo(address);
 
+	if (ice_port_info == nullptr)
 	{
-		std::lock_guard<std::mutex> lock_guard(_ice_port_info_mutex);
-
-		auto item = _ice_port_info.find(address);
-
-		if (item == _ice_port_info.end())
-		{
-			// 포트 정보가 없음
-			// 이전 단계에서 관련 정보가 저장되어 있어야 함
-
-			// 같은 ufrag에 대해 서로 다른 ICE candidate로 부터 동시에 접속 요청이 왔다면, 첫 번째로 도착한 ICE candidate가 저장됨
-			// 따라서 두 번째 address는 처리하지 않으므로, 없다고 간주
-			return false;
-		}
+		// 포트 정보가 없음
+		// 이전 단계에서 관련 정보가 저장되어 있어야 함
 
-		ice_port_info = item->second;
+		// 같은 ufrag에 대해 서로 다른 ICE candidate로 부터 동시에 접속 요청이 왔다면, 첫 번째로 도착한 ICE candidate가 저장됨
+		// 따라서 두 번째 address는 처리하지 않으므로, 없다고 간주
+		return false;
 	}
 
 	// SDP의 password로 무결성 검사를 한 뒤
@@ -752,6 +786,80 @@ void IcePort::SetIceState(std::shared_ptr<IcePortInfo> &info, IcePortConnectionS
 	std::for_each(_observers.begin(), _observers.end(), func);
 }
 
+IcePacketIdentifier IcePort::FindPacketIdentifier(const ov::Data &data)
+{
+	if (data.GetLength() == 0)
+	{
+		return IcePacketIdentifier::Unknown;
+	}
+
+	auto buffer = data.GetDataAs<uint8_t>();
+	uint8_t first_byte = buffer[0];
+
+	if (first_byte <= 3)
+	{
+		// RFC5389 - 6. STUN Message Structure
+		// The message length is a multiple of 4 (the header is not included), and the magic cookie is fixed
+		if ((data.GetLength() < StunMessage::DefaultHeaderLength()) || ((data.GetLength() & 0b11) != 0))
+		{
+			return IcePacketIdentifier::Unknown;
+		}
+
+		uint32_t magic_cookie = (buffer[4] << 24) | (buffer[5] << 16) | (buffer[6] << 8) | buffer[7];
+
+		return (magic_cookie == OV_STUN_MAGIC_COOKIE) ? IcePacketIdentifier::Stun : IcePacketIdentifier::Unknown;
+	}
+	else if ((first_byte >= 16) && (first_byte <= 19))
+	{
+		return IcePacketIdentifier::Zrtp;
+	}
+	else if ((first_byte >= 20) && (first_byte <= 63))
+	{
+		return IcePacketIdentifier::Dtls;
+	}
+	else if ((first_byte >= 64) && (first_byte <= 79))
+	{
+		return IcePacketIdentifier::TurnChannel;
+	}
+	else if ((first_byte >= 128) && (first_byte <= 191))
+	{
+		return IcePacketIdentifier::RtpRtcp;
+	}
+
+	return IcePacketIdentifier::Unknown;
+}
+
+IcePort::IcePortInfoShard &IcePort::GetIcePortInfoShard(const ov::SocketAddress &address)
+{
+	return _ice_port_info_shards[address.Hash() % IcePortInfoShardCount];
+}
+
+std::shared_ptr<IcePort::IcePortInfo> IcePort::FindIcePortInfo(const ov::SocketAddress &address)
+{
+	auto &shard = GetIcePortInfoShard(address);
+	std::shared_lock<std::shared_mutex> lock_guard(shard.mutex);
+
+	auto item = shard.table.find(address);
+
+	return (item != shard.table.end()) ? item->second : nullptr;
+}
+
+void IcePort::AddIcePortInfo(const ov::SocketAddress &address, const std::shared_ptr<IcePortInfo> &info)
+{
+	auto &shard = GetIcePortInfoShard(address);
+	std::lock_guard<std::shared_mutex> lock_guard(shard.mutex);
+
+	shard.table[address] = info;
+}
+
+void IcePort::RemoveIcePortInfo(const ov::SocketAddress &address)
+{
+	auto &shard = GetIcePortInfoShard(address);
+	std::lock_guard<std::shared_mutex> lock_guard(shard.mutex);
+
+	shard.table.erase(address);
+}
+
 // STUN 오류를 반환함
 void IcePort::ResponseError(const std::shared_ptr<ov::Socket> &remote)
 {
@@ -11,8 +11,11 @@
 #include "ice_port_observer.h"
 #include "modules/ice/stun/stun_message.h"
 
-#include <vector>
+#include <array>
 #include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <config/config.h>
 #include <modules/rtp_rtcp/rtp_packet.h>
@@ -21,6 +24,30 @@
 
 class RtcIceCandidate;
 
+// RFC7983 - 7. Updates to RFC 5764
+// The packets on the same port are classified by the first byte
+//
+//                 +----------------+
+//                 |        [0..3] -+--> forward to STUN
+//                 |                |
+//                 |      [16..19] -+--> forward to ZRTP
+//                 |                |
+//     packet -->  |      [20..63] -+--> forward to DTLS
+//                 |                |
+//                 |      [64..79] -+--> forward to TURN Channel
+//                 |                |
+//                 |    [128..191] -+--> forward to RTP/RTCP
+//                 +----------------+
+enum class IcePacketIdentifier : char
+{
+	Stun,
+	Zrtp,
+	Dtls,
+	TurnChannel,
+	RtpRtcp,
+	Unknown
+};
+
 class IcePort : protected PhysicalPortObserver
 {
 protected:
@@ -38,21 +65,14 @@ protected:
 
 		IcePortConnectionState state;
 
-		std::chrono::time_point<std::chrono::system_clock> expire_time;
-
 		IcePortInfo(int expire_after_ms)
 			: _expire_after_ms(expire_after_ms)
 		{
 		}
 
-		void UpdateBindingTime()
-		{
-			expire_time = std::chrono::system_clock::now() + std::chrono::milliseconds(_expire_after_ms);
-		}
-
-		bool IsExpired() const
+		int GetExpireAfterMs() const
 		{
-			return (std::chrono::system_clock::now() > expire_time);
+			return _expire_after_ms;
 		}
 
 	protected:
@@ -65,6 +85,10 @@ public:
 
 	bool CreateTurnServer(ov::SocketAddress address, ov::SocketType socket_type);
 	bool CreateIceCandidates(std::vector<RtcIceCandidate> ice_candidate_list);
+	// Configure batched sending of the UDP ports
+	bool SetSendBatch(int batch_size, int flush_interval, bool use_gso);
+	// Configure batched receiving of the UDP ports
+	bool SetRecvBatch(int batch_size);
 
 	const std::vector<RtcIceCandidate> &GetIceCandidateList() const;
 
@@ -122,7 +146,24 @@ protected:
 	// STUN 오류를 반환함
 	void ResponseError(const std::shared_ptr<ov::Socket> &remote);
 
+	// Classifies the packet without parsing it (the STUN packets are also checked with the header fields)
+	static IcePacketIdentifier FindPacketIdentifier(const ov::Data &data);
+
+	// The mapping table is split into the shards by the hash of the address
+	struct alignas(64) IcePortInfoShard
+	{
+		std::shared_mutex mutex;
+		std::unordered_map<ov::SocketAddress, std::shared_ptr<IcePortInfo>> table;
+	};
+
+	IcePortInfoShard &GetIcePortInfoShard(const ov::SocketAddress &address);
+	std::shared_ptr<IcePortInfo> FindIcePortInfo(const ov::SocketAddress &address);
+	void AddIcePortInfo(const ov::SocketAddress &address, const std::shared_ptr<IcePortInfo> &info);
+	void RemoveIcePortInfo(const ov::SocketAddress &address);
+
 private:
+	// Refreshes the expiry of the binding (O(1), called for every binding request)
+	void UpdateBindingTime(const std::shared_ptr<IcePortInfo> &info);
 	void CheckTimedoutItem();
 
 	// STUN negotiation order:
@@ -158,11 +199,18 @@ private:
 	// 상대방의 ip:port로 IcePortInfo를 바로 찾을 수 있게 함
 	// key: SocketAddress
 	// value: IcePortInfo
-	std::mutex _ice_port_info_mutex;
-	std::map<ov::SocketAddress, std::shared_ptr<IcePortInfo>> _ice_port_info;
+	//
+	// It is looked up for every packet received, so the receiving threads of the physical ports should not wait for one lock
+	static constexpr size_t IcePortInfoShardCount = 16;
+	std::array<IcePortInfoShard, IcePortInfoShardCount> _ice_port_info_shards;
+
 	// session_id로 IcePortInfo를 바로 찾을 수 있게 함
+	// (Looked up for every packet sent)
+	std::shared_mutex _session_table_mutex;
 	std::map<session_id_t, std::shared_ptr<IcePortInfo>> _session_table;
 
 	// 마지막으로 STUN 메시지가 온 시점을 기억함
+	// (The bindings which are not refreshed until the timeout are expired by the wheel, without scanning all the sessions)
+	ov::TimingWheel<std::shared_ptr<IcePortInfo>> _expiry_wheel;
 	ov::DelayQueue _timer;
 };
@@ -52,6 +52,31 @@ bool IcePortManager::CreateIceCandidates(std::shared_ptr<IcePort> ice_port, cons
 	else
 	{
 		logtd("IceCandidates is created successfully: %s", ice_port->ToString().CStr());
+
+		if (ice_candidates.GetSendBatchSize() > 1)
+		{
+			if (ice_port->SetSendBatch(ice_candidates.GetSendBatchSize(), ice_candidates.GetSendFlushInterval(), ice_candidates.IsUdpGsoEnabled()))
+			{
+				logti("ICE ports send datagrams in batches (batch size: %d, flush interval: %d ms, GSO: %s)",
+					  ice_candidates.GetSendBatchSize(), ice_candidates.GetSendFlushInterval(), ice_candidates.IsUdpGsoEnabled() ? "true" : "false");
+			}
+			else
+			{
+				logtw("Could not configure the send batch of ICE ports");
+			}
+		}
+
+		if (ice_candidates.GetRecvBatchSize() > 1)
+		{
+			if (ice_port->SetRecvBatch(ice_candidates.GetRecvBatchSize()))
+			{
+				logti("ICE ports receive datagrams in batches (batch size: %d)", ice_candidates.GetRecvBatchSize());
+			}
+			else
+			{
+				logtw("Could not configure the receive batch of ICE ports");
+			}
+		}
 	}
 
 	return true;
@@ -10,4 +10,9 @@
 
 #define OV_LOG_TAG                      "Ice"
 // Data dump log를 출력할지 여부
-#define STUN_LOG_DATA                   0
\ No newline at end of file
+#define STUN_LOG_DATA                   0
+
+// Resolution of the expiry of the ICE bindings
+#define ICE_PORT_EXPIRY_TICK_MS         100
+// Maximum number of the expired bindings processed while holding the locks
+#define ICE_PORT_EXPIRY_BATCH_SIZE      64
\ No newline at end of file
@@ -0,0 +1,648 @@
+//==============================================================================
+//
+//  MPEGTS Packetizer
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mpegts_packetizer.h"
+
+#define OV_LOG_TAG "MpegTsPacketizer"
+
+#define MPEGTS_PACKET_HEADER_SIZE 4
+#define MPEGTS_PACKET_PAYLOAD_SIZE (MPEGTS_MIN_PACKET_SIZE - MPEGTS_PACKET_HEADER_SIZE)
+
+#define MPEGTS_PROGRAM_NUMBER 0x0001
+#define MPEGTS_TRANSPORT_STREAM_ID 0x0001
+#define MPEGTS_PMT_PID 0x1000
+#define MPEGTS_FIRST_ES_PID 0x0100
+
+// Same as the default max_delay (0.7 sec) of libavformat
+// Unit: 90kHz
+#define MPEGTS_MUX_DELAY 63000LL
+// Same as the default pes_payload_size of libavformat
+#define MPEGTS_MAX_AUDIO_PES_PAYLOAD_SIZE 2930
+
+#define MPEGTS_TIMESTAMP_MASK 0x1FFFFFFFFLL
+
+namespace mpegts
+{
+	// CRC-32/MPEG-2 (poly: 0x04C11DB7, init: 0xFFFFFFFF, not reflected)
+	static uint32_t Crc32Mpeg2(const uint8_t *data, size_t length)
+	{
+		uint32_t crc = 0xFFFFFFFF;
+
+		for (size_t index = 0; index < length; index++)
+		{
+			crc ^= static_cast<uint32_t>(data[index]) << 24;
+
+			for (int bit = 0; bit < 8; bit++)
+			{
+				crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04C11DB7) : (crc << 1);
+			}
+		}
+
+		return crc;
+	}
+
+	// Write 33-bit PTS/DTS with the 4-bit prefix
+	static uint8_t *WriteTimestamp(uint8_t *buffer, uint8_t prefix, int64_t timestamp)
+	{
+		timestamp &= MPEGTS_TIMESTAMP_MASK;
+
+		buffer[0] = static_cast<uint8_t>((prefix << 4) | (((timestamp >> 30) & 0x07) << 1) | 0x01);
+		buffer[1] = static_cast<uint8_t>((timestamp >> 22) & 0xFF);
+		buffer[2] = static_cast<uint8_t>((((timestamp >> 15) & 0x7F) << 1) | 0x01);
+		buffer[3] = static_cast<uint8_t>((timestamp >> 7) & 0xFF);
+		buffer[4] = static_cast<uint8_t>(((timestamp & 0x7F) << 1) | 0x01);
+
+		return buffer + 5;
+	}
+
+	// Returns the type of the first NAL unit in the Annex B bitstream (-1 if not found)
+	static int GetFirstNalUnitHeader(const uint8_t *data, size_t length)
+	{
+		for (size_t index = 0; (index + 3) < length; index++)
+		{
+			if ((data[index] == 0x00) && (data[index + 1] == 0x00) && (data[index + 2] == 0x01))
+			{
+				return data[index + 3];
+			}
+		}
+
+		return -1;
+	}
+
+	bool MpegTsPacketizer::AddTrack(const std::shared_ptr<const MediaTrack> &media_track)
+	{
+		if (media_track == nullptr)
+		{
+			return false;
+		}
+
+		auto lock_guard = std::lock_guard(_mutex);
+
+		if (_psi_built)
+		{
+			logte("Could not add a track after the packetizer is prepared");
+			return false;
+		}
+
+		Track track;
+
+		switch (media_track->GetCodecId())
+		{
+			case cmn::MediaCodecId::H264:
+				track.stream_type = WellKnownStreamTypes::H264;
+				break;
+
+			case cmn::MediaCodecId::H265:
+				track.stream_type = WellKnownStreamTypes::H265;
+				break;
+
+			case cmn::MediaCodecId::Aac:
+				track.stream_type = WellKnownStreamTypes::AAC;
+				break;
+
+			case cmn::MediaCodecId::Mp3:
+				track.stream_type = WellKnownStreamTypes::MP3;
+				break;
+
+			default:
+				logtw("Not supported codec: %s", ::StringFromMediaCodecId(media_track->GetCodecId()).CStr());
+				return false;
+		}
+
+		auto &timebase = media_track->GetTimeBase();
+
+		if ((timebase.GetNum() <= 0) || (timebase.GetDen() <= 0))
+		{
+			logte("Invalid timebase: %s", timebase.ToString().CStr());
+			return false;
+		}
+
+		size_t index = _track_list.size();
+
+		track.media_track = media_track;
+		track.pid = static_cast<uint16_t>(MPEGTS_FIRST_ES_PID + index);
+
+		if (media_track->GetMediaType() == cmn::MediaType::Video)
+		{
+			track.stream_id = 0xE0 + std::count_if(_track_list.begin(), _track_list.end(), [](const Track &item) {
+								  return item.media_track->GetMediaType() == cmn::MediaType::Video;
+							  });
+
+			if ((_track_list.empty() == false) && (_track_list[_pcr_track_index].media_track->GetMediaType() != cmn::MediaType::Video))
+			{
+				_pcr_track_index = index;
+			}
+		}
+		else
+		{
+			track.stream_id = 0xC0 + std::count_if(_track_list.begin(), _track_list.end(), [](const Track &item) {
+								  return item.media_track->GetMediaType() != cmn::MediaType::Video;
+							  });
+		}
+
+		_track_list.push_back(std::move(track));
+		_track_index_map[media_track->GetId()] = index;
+
+		logtd("Track %s is added (pid: 0x%04X)", ::StringFromMediaType(media_track->GetMediaType()).CStr(), _track_list.back().pid);
+
+		return true;
+	}
+
+	void MpegTsPacketizer::MakeSectionPacket(std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> &packet, uint16_t pid, const std::vector<uint8_t> &section)
+	{
+		packet.fill(0xFF);
+
+		packet[0] = MPEGTS_SYNC_BYTE;
+		// payload_unit_start_indicator
+		packet[1] = 0x40 | ((pid >> 8) & 0x1F);
+		packet[2] = pid & 0xFF;
+		// Payload only (continuity counter is set when the packet is written)
+		packet[3] = 0x10;
+		// pointer_field
+		packet[4] = 0x00;
+
+		::memcpy(packet.data() + 5, section.data(), section.size());
+	}
+
+	void MpegTsPacketizer::BuildPsiPackets()
+	{
+		std::vector<uint8_t> section;
+
+		// Program Association Table
+		section = {
+			static_cast<uint8_t>(WellKnownTableId::PROGRAM_ASSOCIATION_SECTION),
+			// section_syntax_indicator, '0', reserved, section_length (filled later)
+			0xB0, 0x00,
+			(MPEGTS_TRANSPORT_STREAM_ID >> 8) & 0xFF, MPEGTS_TRANSPORT_STREAM_ID & 0xFF,
+			// reserved, version_number: 0, current_next_indicator: 1
+			0xC1,
+			// section_number, last_section_number
+			0x00, 0x00,
+			(MPEGTS_PROGRAM_NUMBER >> 8) & 0xFF, MPEGTS_PROGRAM_NUMBER & 0xFF,
+			0xE0 | ((MPEGTS_PMT_PID >> 8) & 0x1F), MPEGTS_PMT_PID & 0xFF};
+
+		auto finalize_section = [](std::vector<uint8_t> &section) {
+			// section_length: bytes after the section_length field including CRC
+			size_t section_length = section.size() - MPEGTS_TABLE_HEADER_SIZE + 4;
+			section[1] = (section[1] & 0xF0) | ((section_length >> 8) & 0x0F);
+			section[2] = section_length & 0xFF;
+
+			auto crc = Crc32Mpeg2(section.data(), section.size());
+			section.push_back((crc >> 24) & 0xFF);
+			section.push_back((crc >> 16) & 0xFF);
+			section.push_back((crc >> 8) & 0xFF);
+			section.push_back(crc & 0xFF);
+		};
+
+		finalize_section(section);
+		MakeSectionPacket(_pat_packet, static_cast<uint16_t>(WellKnownPacketId::PAT), section);
+
+		// Program Map Table
+		uint16_t pcr_pid = _track_list.empty() ? static_cast<uint16_t>(WellKnownPacketId::NULL_PACKET) : _track_list[_pcr_track_index].pid;
+
+		section = {
+			static_cast<uint8_t>(WellKnownTableId::PROGRAM_MAP_SECTION),
+			0xB0, 0x00,
+			(MPEGTS_PROGRAM_NUMBER >> 8) & 0xFF, MPEGTS_PROGRAM_NUMBER & 0xFF,
+			0xC1,
+			0x00, 0x00,
+			static_cast<uint8_t>(0xE0 | ((pcr_pid >> 8) & 0x1F)), static_cast<uint8_t>(pcr_pid & 0xFF),
+			// reserved, program_info_length: 0
+			0xF0, 0x00};
+
+		for (auto &track : _track_list)
+		{
+			section.push_back(static_cast<uint8_t>(track.stream_type));
+			section.push_back(0xE0 | ((track.pid >> 8) & 0x1F));
+			section.push_back(track.pid & 0xFF);
+			// reserved, ES_info_length: 0
+			section.push_back(0xF0);
+			section.push_back(0x00);
+		}
+
+		finalize_section(section);
+		MakeSectionPacket(_pmt_packet, MPEGTS_PMT_PID, section);
+
+		_psi_built = true;
+	}
+
+	void MpegTsPacketizer::WriteSectionPacket(const std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> &packet, uint8_t &continuity_counter)
+	{
+		_data->Append(packet.data(), packet.size());
+
+		auto buffer = _data->GetWritableDataAs<uint8_t>() + _data->GetLength() - packet.size();
+		buffer[3] = (buffer[3] & 0xF0) | continuity_counter;
+
+		continuity_counter = (continuity_counter + 1) & 0x0F;
+	}
+
+	bool MpegTsPacketizer::Prepare()
+	{
+		return Prepare(nullptr);
+	}
+
+	bool MpegTsPacketizer::Prepare(const std::shared_ptr<ov::Data> &buffer)
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+
+		if (_data != nullptr)
+		{
+			logte("Packetizer is already started");
+			return false;
+		}
+
+		if (_psi_built == false)
+		{
+			BuildPsiPackets();
+		}
+
+		// Allocate the buffer as large as the previous segment to avoid reallocations while the segment is written
+		if (buffer != nullptr)
+		{
+			_data = buffer;
+			_data->SetLength(0);
+			_data->Reserve(_last_segment_size + (_last_segment_size / 8));
+		}
+		else
+		{
+			_data = std::make_shared<ov::Data>(_last_segment_size + (_last_segment_size / 8));
+		}
+
+		for (auto &track : _track_list)
+		{
+			track.duration = 0LL;
+			track.first_pts = -1LL;
+			track.first_packet_received = false;
+		}
+
+		WriteSectionPacket(_pat_packet, _pat_continuity_counter);
+		WriteSectionPacket(_pmt_packet, _pmt_continuity_counter);
+
+		return true;
+	}
+
+	bool MpegTsPacketizer::PrepareIfNeeded()
+	{
+		{
+			auto lock_guard = std::lock_guard(_mutex);
+
+			if (_data != nullptr)
+			{
+				return true;
+			}
+		}
+
+		return Prepare();
+	}
+
+	int64_t MpegTsPacketizer::ConvertTo90kHz(const Track &track, int64_t timestamp) const
+	{
+		auto &timebase = track.media_track->GetTimeBase();
+
+		if ((timebase.GetNum() == 1) && (timebase.GetDen() == 90000))
+		{
+			return timestamp;
+		}
+
+		return timestamp * 90000LL * timebase.GetNum() / timebase.GetDen();
+	}
+
+	bool MpegTsPacketizer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+
+		if (_data == nullptr)
+		{
+			logte("Packetizer is not prepared");
+			return false;
+		}
+
+		auto track_item = _track_index_map.find(packet->GetTrackId());
+
+		if (track_item == _track_index_map.end())
+		{
+			OV_ASSERT2(false);
+			logtc("Could not find the track: %d (%zu)", packet->GetTrackId(), _track_index_map.size());
+			return false;
+		}
+
+		auto &track = _track_list[track_item->second];
+		auto data = packet->GetData();
+
+		if ((data == nullptr) || data->IsEmpty())
+		{
+			return true;
+		}
+
+		auto payload = data->GetDataAs<uint8_t>();
+		auto payload_length = data->GetLength();
+		auto pts = ConvertTo90kHz(track, packet->GetPts()) + MPEGTS_MUX_DELAY;
+		auto dts = ConvertTo90kHz(track, packet->GetDts()) + MPEGTS_MUX_DELAY;
+		bool result = true;
+
+		switch (track.stream_type)
+		{
+			case WellKnownStreamTypes::H264: {
+				// Add an access unit delimiter if needed (like libavformat)
+				static const uint8_t aud[] = {0x00, 0x00, 0x00, 0x01, 0x09, 0xF0};
+				auto has_aud = ((GetFirstNalUnitHeader(payload, payload_length) & 0x1F) == 9);
+
+				result = WritePes(track, pts, dts, packet->GetFlag() == MediaPacketFlag::Key,
+								  aud, has_aud ? 0 : sizeof(aud), payload, payload_length);
+				break;
+			}
+
+			case WellKnownStreamTypes::H265: {
+				static const uint8_t aud[] = {0x00, 0x00, 0x00, 0x01, 0x46, 0x01, 0x50};
+				auto has_aud = (((GetFirstNalUnitHeader(payload, payload_length) >> 1) & 0x3F) == 35);
+
+				result = WritePes(track, pts, dts, packet->GetFlag() == MediaPacketFlag::Key,
+								  aud, has_aud ? 0 : sizeof(aud), payload, payload_length);
+				break;
+			}
+
+			default:
+				if (&track == &(_track_list[_pcr_track_index]))
+				{
+					// PCR must be written at least every 100ms, so frames of the PCR track are not gathered
+					result = WritePes(track, pts, dts, true, nullptr, 0, payload, payload_length);
+					break;
+				}
+
+				if ((track.pending_payload.empty() == false) &&
+					((track.pending_payload.size() + payload_length) > MPEGTS_MAX_AUDIO_PES_PAYLOAD_SIZE))
+				{
+					FlushPendingPayload(track);
+				}
+
+				if (track.pending_payload.empty())
+				{
+					track.pending_pts = pts;
+					track.pending_dts = dts;
+				}
+
+				track.pending_payload.insert(track.pending_payload.end(), payload, payload + payload_length);
+				break;
+		}
+
+		if (result)
+		{
+			track.duration += packet->GetDuration();
+
+			if (track.first_packet_received == false)
+			{
+				track.first_pts = packet->GetPts();
+				track.first_packet_received = true;
+			}
+		}
+
+		return result;
+	}
+
+	void MpegTsPacketizer::FlushPendingPayload(Track &track)
+	{
+		if (track.pending_payload.empty())
+		{
+			return;
+		}
+
+		WritePes(track, track.pending_pts, track.pending_dts, true, nullptr, 0, track.pending_payload.data(), track.pending_payload.size());
+
+		track.pending_payload.clear();
+	}
+
+	bool MpegTsPacketizer::WritePes(Track &track, int64_t pts, int64_t dts, bool is_key_frame,
+									const uint8_t *prefix, size_t prefix_length,
+									const uint8_t *payload, size_t payload_length)
+	{
+		bool is_video = (track.stream_id >= 0xE0);
+		bool has_dts = (pts != dts);
+
+		// PES header
+		uint8_t pes_header[19];
+		uint8_t *header_position = pes_header;
+
+		*header_position++ = 0x00;
+		*header_position++ = 0x00;
+		*header_position++ = 0x01;
+		*header_position++ = track.stream_id;
+
+		size_t pes_header_data_length = has_dts ? 10 : 5;
+		size_t pes_packet_length = 3 + pes_header_data_length + prefix_length + payload_length;
+
+		// PES_packet_length can be 0 only for video
+		if (is_video || (pes_packet_length > 0xFFFF))
+		{
+			pes_packet_length = 0;
+		}
+
+		*header_position++ = (pes_packet_length >> 8) & 0xFF;
+		*header_position++ = pes_packet_length & 0xFF;
+		// '10', data_alignment_indicator (for video)
+		*header_position++ = is_video ? 0x84 : 0x80;
+		// PTS_DTS_flags
+		*header_position++ = has_dts ? 0xC0 : 0x80;
+		*header_position++ = static_cast<uint8_t>(pes_header_data_length);
+
+		header_position = WriteTimestamp(header_position, has_dts ? 0x03 : 0x02, pts);
+
+		if (has_dts)
+		{
+			header_position = WriteTimestamp(header_position, 0x01, dts);
+		}
+
+		// The PES is written from these chunks in order
+		const uint8_t *chunk_list[] = {pes_header, prefix, payload};
+		size_t chunk_length_list[] = {static_cast<size_t>(header_position - pes_header), prefix_length, payload_length};
+		size_t chunk_index = 0;
+		size_t chunk_offset = 0;
+
+		size_t remained = chunk_length_list[0] + prefix_length + payload_length;
+
+		bool write_pcr = (&track == &(_track_list[_pcr_track_index]));
+
+		// Calculate the number of TS packets to allocate the buffer at once
+		size_t first_packet_adaptation_length = (write_pcr || is_key_frame) ? (2 + (write_pcr ? 6 : 0)) : 0;
+		size_t first_packet_payload_length = MPEGTS_PACKET_PAYLOAD_SIZE - first_packet_adaptation_length;
+		size_t packet_count = 1;
+
+		if (remained > first_packet_payload_length)
+		{
+			packet_count += (remained - first_packet_payload_length + MPEGTS_PACKET_PAYLOAD_SIZE - 1) / MPEGTS_PACKET_PAYLOAD_SIZE;
+		}
+
+		auto offset = _data->GetLength();
+
+		if (_data->SetLength(offset + (packet_count * MPEGTS_MIN_PACKET_SIZE)) == false)
+		{
+			logte("Could not allocate memory for PES");
+			return false;
+		}
+
+		auto buffer = _data->GetWritableDataAs<uint8_t>() + offset;
+		bool is_first_packet = true;
+
+		while (remained > 0)
+		{
+			uint8_t *packet = buffer;
+			buffer += MPEGTS_MIN_PACKET_SIZE;
+
+			// Length of the adaptation field including adaptation_field_length
+			size_t adaptation_length = is_first_packet ? first_packet_adaptation_length : 0;
+			size_t payload_space = MPEGTS_PACKET_PAYLOAD_SIZE - adaptation_length;
+
+			if (remained < payload_space)
+			{
+				// Fill the rest of the packet with stuffing bytes
+				adaptation_length += (payload_space - remained);
+				payload_space = remained;
+			}
+
+			packet[0] = MPEGTS_SYNC_BYTE;
+			packet[1] = (is_first_packet ? 0x40 : 0x00) | ((track.pid >> 8) & 0x1F);
+			packet[2] = track.pid & 0xFF;
+			packet[3] = ((adaptation_length > 0) ? 0x30 : 0x10) | track.continuity_counter;
+
+			track.continuity_counter = (track.continuity_counter + 1) & 0x0F;
+
+			uint8_t *position = packet + MPEGTS_PACKET_HEADER_SIZE;
+
+			if (adaptation_length > 0)
+			{
+				uint8_t *adaptation_end = position + adaptation_length;
+
+				// adaptation_field_length
+				*position++ = static_cast<uint8_t>(adaptation_length - 1);
+
+				if (adaptation_length > 1)
+				{
+					uint8_t flags = 0x00;
+
+					if (is_first_packet)
+					{
+						// random_access_indicator
+						flags |= is_key_frame ? 0x40 : 0x00;
+						// PCR_flag
+						flags |= write_pcr ? 0x10 : 0x00;
+					}
+
+					*position++ = flags;
+
+					if (flags & 0x10)
+					{
+						// PCR: base (33 bits), reserved (6 bits), extension (9 bits)
+						int64_t pcr_base = (dts - MPEGTS_MUX_DELAY) & MPEGTS_TIMESTAMP_MASK;
+
+						*position++ = static_cast<uint8_t>(pcr_base >> 25);
+						*position++ = static_cast<uint8_t>(pcr_base >> 17);
+						*position++ = static_cast<uint8_t>(pcr_base >> 9);
+						*position++ = static_cast<uint8_t>(pcr_base >> 1);
+						*position++ = static_cast<uint8_t>(((pcr_base & 0x01) << 7) | 0x7E);
+						*position++ = 0x00;
+					}
+
+					::memset(position, 0xFF, adaptation_end - position);
+					position = adaptation_end;
+				}
+			}
+
+			// Copy the payload from the chunks
+			size_t to_copy = payload_space;
+
+			while (to_copy > 0)
+			{
+				size_t chunk_remained = chunk_length_list[chunk_index] - chunk_offset;
+
+				if (chunk_remained == 0)
+				{
+					chunk_index++;
+					chunk_offset = 0;
+					continue;
+				}
+
+				size_t length = std::min(chunk_remained, to_copy);
+
+				::memcpy(position, chunk_list[chunk_index] + chunk_offset, length);
+
+				position += length;
+				chunk_offset += length;
+				to_copy -= length;
+			}
+
+			remained -= payload_space;
+			is_first_packet = false;
+		}
+
+		OV_ASSERT2(buffer == (_data->GetWritableDataAs<uint8_t>() + _data->GetLength()));
+
+		return true;
+	}
+
+	std::shared_ptr<const ov::Data> MpegTsPacketizer::Finalize()
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+
+		if (_data == nullptr)
+		{
+			return nullptr;
+		}
+
+		for (auto &track : _track_list)
+		{
+			FlushPendingPayload(track);
+		}
+
+		auto data = std::move(_data);
+		_data = nullptr;
+
+		_last_segment_size = data->GetLength();
+
+		return data;
+	}
+
+	int64_t MpegTsPacketizer::GetFirstPts(uint32_t track_id) const
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+		auto track_item = _track_index_map.find(track_id);
+
+		if (track_item != _track_index_map.end())
+		{
+			auto &track = _track_list[track_item->second];
+			return (track.first_packet_received) ? track.first_pts : 0LL;
+		}
+
+		return 0LL;
+	}
+
+	int64_t MpegTsPacketizer::GetFirstPts(cmn::MediaType type) const
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+
+		for (auto &track : _track_list)
+		{
+			if (track.media_track->GetMediaType() == type)
+			{
+				return track.first_pts;
+			}
+		}
+
+		return 0LL;
+	}
+
+	int64_t MpegTsPacketizer::GetDuration(uint32_t track_id) const
+	{
+		auto lock_guard = std::lock_guard(_mutex);
+		auto track_item = _track_index_map.find(track_id);
+
+		if (track_item != _track_index_map.end())
+		{
+			return _track_list[track_item->second].duration;
+		}
+
+		return 0LL;
+	}
+}  // namespace mpegts
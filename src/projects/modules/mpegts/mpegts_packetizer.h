@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  MPEGTS Packetizer
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/mediarouter/media_type.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+
+#include "mpegts_packet.h"
+#include "mpegts_section.h"
+
+/*  PES Packetization Process
+
+	(PAT, PMT are written at the beginning of each segment)
+
+	ES 1 -> Packet 1: [TS Header][Adaptation field: PCR][PES Header |    Payload    ] : payload_unit_start_indicator = 1
+	        Packet 2: [TS Header][                    Payload                      ]
+	        Packet 3: [TS Header][Adaptation field: stuffing][         Payload     ]
+*/
+
+namespace mpegts
+{
+	// Writes the media packets into MPEG-TS segments without libavformat
+	//
+	// - PAT/PMT packets are built once when the first segment is prepared, and only the continuity counter is changed after that
+	// - Continuity counters are kept across segments, so the segments can be concatenated
+	// - Timestamps are the same as the libavformat mpegts muxer (shifted by MPEGTS_MUX_DELAY)
+	class MpegTsPacketizer
+	{
+	public:
+		MpegTsPacketizer() = default;
+		~MpegTsPacketizer() = default;
+
+		// Tracks must be added before the first Prepare()
+		bool AddTrack(const std::shared_ptr<const MediaTrack> &media_track);
+
+		// Start a new segment
+		bool Prepare();
+		// Start a new segment in the buffer (eg: a buffer of an old segment, to avoid allocating a new buffer for every segment)
+		bool Prepare(const std::shared_ptr<ov::Data> &buffer);
+		bool PrepareIfNeeded();
+
+		bool WritePacket(const std::shared_ptr<const MediaPacket> &packet);
+
+		// Returns the data of the current segment. Prepare() must be called to start the next segment.
+		std::shared_ptr<const ov::Data> Finalize();
+
+		// Get the packet pts of the track
+		// Unit: the timebase of the MediaTrack
+		int64_t GetFirstPts(uint32_t track_id) const;
+		// Get the packet pts by MediaType
+		// Unit: the timebase of the MediaTrack
+		int64_t GetFirstPts(cmn::MediaType type) const;
+
+		// Get the duration of the track
+		// Unit: the timebase of the MediaTrack
+		int64_t GetDuration(uint32_t track_id) const;
+
+	protected:
+		struct Track
+		{
+			std::shared_ptr<const MediaTrack> media_track;
+
+			uint16_t pid = 0;
+			uint8_t stream_id = 0;
+			WellKnownStreamTypes stream_type;
+
+			uint8_t continuity_counter = 0;
+
+			// Audio frames are gathered into a PES to reduce the overhead of TS/PES headers
+			std::vector<uint8_t> pending_payload;
+			// Unit: 90kHz
+			int64_t pending_pts = 0LL;
+			int64_t pending_dts = 0LL;
+
+			// Unit: Timebase
+			int64_t duration = 0LL;
+			int64_t first_pts = -1LL;
+			bool first_packet_received = false;
+		};
+
+		void BuildPsiPackets();
+
+		bool WritePes(Track &track, int64_t pts, int64_t dts, bool is_key_frame,
+					  const uint8_t *prefix, size_t prefix_length,
+					  const uint8_t *payload, size_t payload_length);
+		void FlushPendingPayload(Track &track);
+
+		// Make a packet that contains a PSI section (The section must fit in a packet)
+		static void MakeSectionPacket(std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> &packet, uint16_t pid, const std::vector<uint8_t> &section);
+		void WriteSectionPacket(const std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> &packet, uint8_t &continuity_counter);
+
+		int64_t ConvertTo90kHz(const Track &track, int64_t timestamp) const;
+
+		mutable std::mutex _mutex;
+
+		std::vector<Track> _track_list;
+		// Key: MediaTrack.GetId()
+		// Value: An index of _track_list
+		std::map<uint32_t, size_t> _track_index_map;
+		// Index of the track which carries PCR (The first video track, or the first track)
+		size_t _pcr_track_index = 0;
+
+		std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> _pat_packet;
+		std::array<uint8_t, MPEGTS_MIN_PACKET_SIZE> _pmt_packet;
+		uint8_t _pat_continuity_counter = 0;
+		uint8_t _pmt_continuity_counter = 0;
+		bool _psi_built = false;
+
+		// Data of the current segment
+		std::shared_ptr<ov::Data> _data;
+		// Used to allocate the buffer of the next segment at once
+		size_t _last_segment_size = 0;
+	};
+}  // namespace mpegts
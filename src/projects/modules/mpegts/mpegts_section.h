@@ -45,6 +45,7 @@ namespace mpegts
 	{
 		H264 = 0x1B,
 		H265 = 0x24,
+		MP3 = 0x03, // MPEG-1 Audio
 		AAC = 0x0F, // AAC ADTS
 		AAC_LATM = 0x11 // AAC LATM
 	};
@@ -143,7 +143,9 @@ bool PhysicalPort::CreateServerSocket(ov::SocketType type,
 
 					if (worker->AddTask(client, data) == false)
 					{
-						logte("Could not add task");
+						// The stream of the client cannot be continued without the data
+						logte("Could not add task, disconnecting the client: %s", client->ToString().CStr());
+						return ov::SocketConnectionState::Error;
 					}
 				}
 				else
@@ -204,8 +206,10 @@ bool PhysicalPort::CreateDatagramSocket(ov::SocketType type, const ov::SocketAdd
 				return true;
 			};
 
-			while ((_need_to_stop == false) && (socket->DispatchEvent(data_callback, 500)))
+			while ((_need_to_stop == false) && (socket->DispatchEvent(data_callback, _dispatch_timeout)))
 			{
+				// Send datagrams queued by other threads (such as publishers)
+				socket->FlushSendBatch();
 			}
 
 			socket->Close();
@@ -336,6 +340,60 @@ bool PhysicalPort::DisconnectClient(ov::ClientSocket *client_socket)
 	return _server_socket->DisconnectClient(client_socket, ov::SocketConnectionState::Disconnect);
 }
 
+bool PhysicalPort::SetSendBatch(int batch_size, int flush_interval, bool use_gso)
+{
+	if ((_type != ov::SocketType::Udp) || (_datagram_socket == nullptr))
+	{
+		logtw("Send batch is only available for UDP: %s", ToString().CStr());
+		return false;
+	}
+
+	if (_datagram_socket->SetSendBatch(batch_size, use_gso) == false)
+	{
+		return false;
+	}
+
+	_dispatch_timeout = (_datagram_socket->IsSendBatchEnabled() && (flush_interval > 0)) ? flush_interval : PHYSICAL_PORT_EPOLL_TIMEOUT_MSEC;
+
+	logtd("Send batch is configured: %s, batch size: %d, flush interval: %d ms, GSO: %s",
+		  _address.ToString().CStr(), batch_size, static_cast<int>(_dispatch_timeout), use_gso ? "true" : "false");
+
+	return true;
+}
+
+bool PhysicalPort::SetRecvBatch(int batch_size)
+{
+	if ((_type != ov::SocketType::Udp) || (_datagram_socket == nullptr))
+	{
+		logtw("Receive batch is only available for UDP: %s", ToString().CStr());
+		return false;
+	}
+
+	if (_datagram_socket->SetRecvBatch(batch_size) == false)
+	{
+		return false;
+	}
+
+	logtd("Receive batch is configured: %s, batch size: %d", _address.ToString().CStr(), batch_size);
+
+	return true;
+}
+
+bool PhysicalPort::SetSendQueueSize(size_t high_water_mark)
+{
+	if ((_type != ov::SocketType::Tcp) || (_server_socket == nullptr))
+	{
+		logtw("Send queue is only available for TCP: %s", ToString().CStr());
+		return false;
+	}
+
+	_server_socket->SetSendQueueSize(high_water_mark);
+
+	logtd("Send queue is configured: %s, high-water mark: %zu bytes", _address.ToString().CStr(), high_water_mark);
+
+	return true;
+}
+
 ov::String PhysicalPort::ToString() const
 {
 	ov::String description;
@@ -348,6 +406,11 @@ ov::String PhysicalPort::ToString() const
 		description.AppendFormat(", socket: %s", _server_socket->ToString().CStr());
 	}
 
+	if ((_datagram_socket != nullptr) && _datagram_socket->IsSendBatchEnabled())
+	{
+		description.AppendFormat(", stat: %s", _datagram_socket->GetStat().CStr());
+	}
+
 	description.Append('>');
 
 	return description;
@@ -74,6 +74,15 @@ public:
 
 	bool DisconnectClient(ov::ClientSocket *client_socket);
 
+	// Outgoing datagrams are sent with sendmmsg() when batch_size datagrams are queued,
+	// and the queued datagrams are sent every flush_interval milliseconds (UDP only)
+	bool SetSendBatch(int batch_size, int flush_interval, bool use_gso);
+	// Incoming datagrams are received with recvmmsg() up to batch_size at once (UDP only)
+	bool SetRecvBatch(int batch_size);
+	// Data that cannot be sent immediately is queued up to high_water_mark bytes per client,
+	// and policy is applied to the client when the queue is full (TCP only)
+	bool SetSendQueueSize(size_t high_water_mark);
+
 	ov::String ToString() const;
 
 protected:
@@ -94,6 +103,9 @@ protected:
 	volatile bool _need_to_stop;
 	std::thread _thread;
 
+	// epoll timeout of the datagram socket. It is also used as the interval to send the queued datagrams
+	std::atomic<int> _dispatch_timeout { PHYSICAL_PORT_EPOLL_TIMEOUT_MSEC };
+
 	std::atomic<int> _ref_count { 0 };
 
 	// TODO(dimiden): Must use a mutex to prevent race condition
@@ -80,9 +80,9 @@ bool PhysicalPortWorker::AddTask(const std::shared_ptr<ov::ClientSocket> &client
 	}
 
 	Task task(client, data);
-	_task_list.Enqueue(std::move(task));
 
-	return true;
+	// If the queue is full, the task is not added (The caller must not lose the data of the stream)
+	return _task_list.Enqueue(std::move(task));
 }
 
 void PhysicalPortWorker::ThreadProc()
@@ -24,6 +24,8 @@ public:
 	bool Start();
 	bool Stop();
 
+	// Returns false if the worker is stopped or the task list is full.
+	// In that case, the data is not delivered to the observers.
 	bool AddTask(const std::shared_ptr<ov::ClientSocket> &client, const std::shared_ptr<const ov::Data> &data);
 
 protected:
@@ -47,5 +49,5 @@ protected:
 	std::thread _thread;
 	volatile bool _stop = true;
 
-	ov::Queue<Task> _task_list { nullptr, 500 };
+	ov::MpscQueue<Task> _task_list { nullptr, 500, 5000, 8192 };
 };
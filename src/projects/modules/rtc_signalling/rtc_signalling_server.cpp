@@ -94,6 +94,11 @@ bool RtcSignallingServer::Start(const ov::SocketAddress *address, const ov::Sock
 			_ice_servers = Json::nullValue;
 		}
 
+		if (https_server != nullptr)
+		{
+			https_server->SetKernelTlsEnabled(webrtc_config.GetSignalling().IsKernelTlsEnabled());
+		}
+
 		_http_server = http_server;
 		_https_server = https_server;
 	}
@@ -0,0 +1,67 @@
+#include "bandwidth_estimator.h"
+
+#include <algorithm>
+
+#define OV_LOG_TAG "BWE"
+
+// Thresholds of the fraction lost (loss rate * 256)
+#define BWE_LOW_LOSS_THRESHOLD			5		// 2%
+#define BWE_HIGH_LOSS_THRESHOLD			26		// 10%
+
+// The estimate is not increased more than once in this interval, even if the Receiver Reports are received more frequently
+#define BWE_MIN_INCREASE_INTERVAL_MS	1000
+
+BandwidthEstimator::BandwidthEstimator(uint64_t start_bitrate, uint64_t min_bitrate, uint64_t max_bitrate)
+	: _min_bitrate(min_bitrate),
+	  _max_bitrate(std::max(min_bitrate, max_bitrate)),
+	  _loss_based_bitrate(std::clamp(start_bitrate, _min_bitrate, _max_bitrate)),
+	  _estimated_bitrate(_loss_based_bitrate)
+{
+}
+
+void BandwidthEstimator::OnReceiverReport(uint8_t fraction_lost)
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	if (fraction_lost < BWE_LOW_LOSS_THRESHOLD)
+	{
+		auto now = ov::Clock::NowMSec();
+
+		if ((now - _last_increase_time) >= BWE_MIN_INCREASE_INTERVAL_MS)
+		{
+			_loss_based_bitrate = _loss_based_bitrate * 108 / 100;
+			_last_increase_time = now;
+		}
+	}
+	else if (fraction_lost > BWE_HIGH_LOSS_THRESHOLD)
+	{
+		// rate * (1 - 0.5 * loss)
+		_loss_based_bitrate = _loss_based_bitrate * (512 - fraction_lost) / 512;
+	}
+
+	_loss_based_bitrate = std::clamp(_loss_based_bitrate, _min_bitrate, _max_bitrate);
+
+	UpdateEstimate();
+}
+
+void BandwidthEstimator::OnRemb(uint64_t bitrate)
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	_remb_bitrate = bitrate;
+
+	UpdateEstimate();
+}
+
+void BandwidthEstimator::UpdateEstimate()
+{
+	uint64_t estimated_bitrate = _loss_based_bitrate;
+
+	if (_remb_bitrate > 0)
+	{
+		estimated_bitrate = std::min(estimated_bitrate, _remb_bitrate);
+	}
+
+	_estimated_bitrate = std::clamp(estimated_bitrate, _min_bitrate, _max_bitrate);
+	_has_feedback = true;
+}
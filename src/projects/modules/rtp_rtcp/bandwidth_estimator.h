@@ -0,0 +1,64 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <mutex>
+
+// Initial estimate until the receiver reports anything
+#define BWE_DEFAULT_START_BITRATE		(2 * 1000 * 1000)
+#define BWE_DEFAULT_MIN_BITRATE			(100 * 1000)
+#define BWE_DEFAULT_MAX_BITRATE			(50 * 1000 * 1000)
+
+// Estimates the available bandwidth to a viewer from the RTCP feedback of the viewer
+//
+// - Loss based estimation (like the sender side loss controller of GCC) using the fraction lost of the Receiver Reports
+//   - loss < 2%:  increases the estimate by 8%
+//   - loss > 10%: decreases the estimate by (loss / 2)
+//   - otherwise:  holds the estimate
+// - The delay based estimate of the receiver (REMB) caps the estimate
+//
+// The feedback is received on the ICE thread, and the estimate is read on the sending threads,
+// so the estimate can be read without a lock.
+class BandwidthEstimator
+{
+public:
+	BandwidthEstimator(uint64_t start_bitrate = BWE_DEFAULT_START_BITRATE,
+					   uint64_t min_bitrate = BWE_DEFAULT_MIN_BITRATE,
+					   uint64_t max_bitrate = BWE_DEFAULT_MAX_BITRATE);
+
+	// fraction_lost: Fraction lost field of the report block (loss rate * 256)
+	void OnReceiverReport(uint8_t fraction_lost);
+	// bitrate: REMB bitrate in bps
+	void OnRemb(uint64_t bitrate);
+
+	// bps
+	uint64_t GetEstimatedBitrate() const
+	{
+		return _estimated_bitrate;
+	}
+
+	// true when any feedback which is used to estimate is received
+	bool HasFeedback() const
+	{
+		return _has_feedback;
+	}
+
+private:
+	// Must be called while holding _mutex
+	void UpdateEstimate();
+
+	const uint64_t _min_bitrate;
+	const uint64_t _max_bitrate;
+
+	std::mutex _mutex;
+
+	uint64_t _loss_based_bitrate;
+	// 0 - not received REMB
+	uint64_t _remb_bitrate = 0;
+	// Time when the loss based estimate was increased last
+	uint64_t _last_increase_time = 0;
+
+	std::atomic<uint64_t> _estimated_bitrate;
+	std::atomic<bool> _has_feedback{false};
+};
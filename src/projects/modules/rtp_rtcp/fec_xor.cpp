@@ -0,0 +1,149 @@
+#include "fec_xor.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define FEC_XOR_USE_X86_KERNELS 1
+#endif
+
+#define OV_LOG_TAG "FecXor"
+
+namespace
+{
+	using XorKernel = void (*)(uint8_t *dst, const uint8_t *src, size_t length);
+
+	struct XorKernelInfo
+	{
+		XorKernel kernel;
+		const char *name;
+	};
+
+	void XorScalar(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t offset = 0;
+
+		// memcpy() is used to avoid unaligned access, and is compiled to a single load/store
+		for (; (offset + sizeof(uint64_t)) <= length; offset += sizeof(uint64_t))
+		{
+			uint64_t d, s;
+
+			::memcpy(&d, dst + offset, sizeof(d));
+			::memcpy(&s, src + offset, sizeof(s));
+			d ^= s;
+			::memcpy(dst + offset, &d, sizeof(d));
+		}
+
+		for (; offset < length; offset++)
+		{
+			dst[offset] ^= src[offset];
+		}
+	}
+
+#if FEC_XOR_USE_X86_KERNELS
+	__attribute__((target("sse2"))) void XorSse2(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t offset = 0;
+
+		for (; (offset + 64) <= length; offset += 64)
+		{
+			auto d0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + offset));
+			auto d1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + offset + 16));
+			auto d2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + offset + 32));
+			auto d3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + offset + 48));
+
+			d0 = _mm_xor_si128(d0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset)));
+			d1 = _mm_xor_si128(d1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset + 16)));
+			d2 = _mm_xor_si128(d2, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset + 32)));
+			d3 = _mm_xor_si128(d3, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset + 48)));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + offset), d0);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + offset + 16), d1);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + offset + 32), d2);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + offset + 48), d3);
+		}
+
+		for (; (offset + 16) <= length; offset += 16)
+		{
+			auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + offset));
+			d = _mm_xor_si128(d, _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset)));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + offset), d);
+		}
+
+		XorScalar(dst + offset, src + offset, length - offset);
+	}
+
+	__attribute__((target("avx2"))) void XorAvx2(uint8_t *dst, const uint8_t *src, size_t length)
+	{
+		size_t offset = 0;
+
+		for (; (offset + 128) <= length; offset += 128)
+		{
+			auto d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + offset));
+			auto d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + offset + 32));
+			auto d2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + offset + 64));
+			auto d3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + offset + 96));
+
+			d0 = _mm256_xor_si256(d0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + offset)));
+			d1 = _mm256_xor_si256(d1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + offset + 32)));
+			d2 = _mm256_xor_si256(d2, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + offset + 64)));
+			d3 = _mm256_xor_si256(d3, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + offset + 96)));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + offset), d0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + offset + 32), d1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + offset + 64), d2);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + offset + 96), d3);
+		}
+
+		for (; (offset + 32) <= length; offset += 32)
+		{
+			auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + offset));
+			d = _mm256_xor_si256(d, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + offset)));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + offset), d);
+		}
+
+		// Avoid the AVX-SSE transition penalty before the remaining bytes are processed
+		_mm256_zeroupper();
+
+		XorScalar(dst + offset, src + offset, length - offset);
+	}
+#endif  // FEC_XOR_USE_X86_KERNELS
+
+	XorKernelInfo SelectKernel()
+	{
+#if FEC_XOR_USE_X86_KERNELS
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return {XorAvx2, "avx2"};
+		}
+
+		if (__builtin_cpu_supports("sse2"))
+		{
+			return {XorSse2, "sse2"};
+		}
+#endif  // FEC_XOR_USE_X86_KERNELS
+
+		return {XorScalar, "scalar"};
+	}
+
+	const XorKernelInfo &GetKernel()
+	{
+		static const XorKernelInfo kernel_info = []() {
+			auto info = SelectKernel();
+
+			logti("%s kernel is selected for FEC", info.name);
+
+			return info;
+		}();
+
+		return kernel_info;
+	}
+}  // namespace
+
+void FecXor::Xor(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	GetKernel().kernel(dst, src, length);
+}
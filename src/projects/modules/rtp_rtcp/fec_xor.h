@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// XOR kernels for the FEC encoders (ULPFEC)
+//
+// The kernel is selected once at runtime by the CPU features (AVX2 > SSE2 > 64-bit scalar),
+// so the binary can be run on any x86-64 CPU (and on other architectures with the scalar kernel).
+class FecXor
+{
+public:
+	// dst[i] ^= src[i] for i in [0, length)
+	static void Xor(uint8_t *dst, const uint8_t *src, size_t length);
+};
@@ -24,6 +24,7 @@ void RedRtpPacket::PackageAsRed(uint8_t red_payload_type, const RtpPacket &src)
 {
 	SetPayloadType(src.PayloadType());
 	SetUlpfec(src.IsUlpfec(), src.OriginPayloadType());
+	SetKeyframeStart(src.IsKeyframeStart());
 	SetSsrc(src.Ssrc());
 	SetSequenceNumber(src.SequenceNumber());
 	SetTimestamp(src.Timestamp());
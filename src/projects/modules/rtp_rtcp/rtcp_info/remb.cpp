@@ -0,0 +1,82 @@
+#include "remb.h"
+#include "rtcp_private.h"
+#include <base/ovlibrary/byte_io.h>
+
+// REMB (draft-alvestrand-rmcat-remb-03)
+//
+//    0                   1                   2                   3
+//    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//   |V=2|P| FMT=15  |   PT=206      |             length            |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// 0 |                  SSRC of packet sender                        |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// 4 |                  SSRC of media source (always 0)              |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// 8 |  Unique identifier 'R' 'E' 'M' 'B'                            |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//12 |  Num SSRC     | BR Exp    |  BR Mantissa                      |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//16 |   SSRC feedback                                               |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//   |  ...                                                          |
+
+#define REMB_FIXED_SIZE		16
+
+bool REMB::IsREMB(const RtcpPacket &packet)
+{
+	const uint8_t *payload = packet.GetPayload();
+
+	return (packet.GetType() == RtcpPacketType::PSFB) &&
+		   (packet.GetFMT() == static_cast<uint8_t>(PSFBFMT::AFB)) &&
+		   (packet.GetPayloadSize() >= REMB_FIXED_SIZE) &&
+		   (::memcmp(&payload[8], "REMB", 4) == 0);
+}
+
+bool REMB::Parse(const RtcpPacket &packet)
+{
+	const uint8_t *payload = packet.GetPayload();
+	size_t payload_size = packet.GetPayloadSize();
+
+	if(IsREMB(packet) == false)
+	{
+		logtd("Payload is not a REMB message");
+		return false;
+	}
+
+	uint8_t ssrc_count = payload[12];
+
+	if(payload_size < static_cast<size_t>(REMB_FIXED_SIZE + (ssrc_count * 4)))
+	{
+		logtd("Payload is too small to parse REMB");
+		return false;
+	}
+
+	SetSrcSsrc(ByteReader<uint32_t>::ReadBigEndian(&payload[0]));
+
+	uint8_t exponent = payload[13] >> 2;
+	uint64_t mantissa = (static_cast<uint64_t>(payload[13] & 0x03) << 16) | ByteReader<uint16_t>::ReadBigEndian(&payload[14]);
+
+	// The bitrate is mantissa * 2^exponent, which does not fit in 64 bits for the large exponents
+	_bitrate = (exponent > 46) ? UINT64_MAX : (mantissa << exponent);
+
+	size_t offset = REMB_FIXED_SIZE;
+	for(uint8_t i=0; i<ssrc_count; i++)
+	{
+		_ssrc_list.push_back(ByteReader<uint32_t>::ReadBigEndian(&payload[offset]));
+		offset += 4;
+	}
+
+	return true;
+}
+
+// RtcpInfo must provide raw data
+std::shared_ptr<ov::Data> REMB::GetData() const
+{
+	return nullptr;
+}
+
+void REMB::DebugPrint()
+{
+	logtd("REMB >> %" PRIu64 " bps (ssrc count: %zu)", _bitrate, GetSsrcCount());
+}
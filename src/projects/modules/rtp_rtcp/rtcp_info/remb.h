@@ -0,0 +1,56 @@
+#pragma once
+#include "base/ovlibrary/ovlibrary.h"
+#include "rtcp_info.h"
+#include "../rtcp_packet.h"
+
+// Receiver Estimated Maximum Bitrate (draft-alvestrand-rmcat-remb)
+class REMB : public RtcpInfo
+{
+public:
+	// Application Layer Feedback (PSFB, FMT=15) is also used by other messages,
+	// so check the unique identifier before parsing it as REMB
+	static bool IsREMB(const RtcpPacket &packet);
+
+	///////////////////////////////////////////
+	// Implement RtcpInfo virtual functions
+	///////////////////////////////////////////
+	bool Parse(const RtcpPacket &packet) override;
+	// RtcpInfo must provide raw data
+	std::shared_ptr<ov::Data> GetData() const override;
+	void DebugPrint() override;
+
+	// RtcpInfo must provide packet type
+	RtcpPacketType GetPacketType() const override
+	{
+		return RtcpPacketType::PSFB;
+	}
+
+	// If the packet type is one of the feedback messages (205, 206) child must provide fmt(format)
+	uint8_t GetFmt() const override
+	{
+		return static_cast<uint8_t>(PSFBFMT::AFB);
+	}
+
+	uint32_t GetSrcSsrc(){return _src_ssrc;}
+	void SetSrcSsrc(uint32_t ssrc){_src_ssrc = ssrc;}
+
+	// bps
+	uint64_t GetBitrate(){return _bitrate;}
+
+	size_t GetSsrcCount(){return _ssrc_list.size();}
+	uint32_t GetSsrc(size_t index)
+	{
+		if(index >= GetSsrcCount())
+		{
+			return 0;
+		}
+
+		return _ssrc_list[index];
+	}
+
+private:
+	uint32_t	_src_ssrc = 0;
+	uint64_t	_bitrate = 0;
+
+	std::vector<uint32_t> _ssrc_list;
+};
@@ -2,6 +2,7 @@
 #include "rtcp_info/sender_report.h"
 #include "rtcp_info/receiver_report.h"
 #include "rtcp_info/nack.h"
+#include "rtcp_info/remb.h"
 
 #include "rtcp_info/rtcp_private.h"
 
@@ -51,9 +52,20 @@ bool RtcpReceiver::ParseCompoundPacket(const std::shared_ptr<const ov::Data> &pa
 				break;
 			}
 
-			// It will be implemented soon
 			case RtcpPacketType::PSFB:
-				continue;
+			{
+				if(REMB::IsREMB(rtcp_packet))
+				{
+					info = std::make_shared<REMB>();
+				}
+				else
+				{
+					logtd("Does not support PSFB format : %d", rtcp_packet.GetFMT());
+					continue;
+				}
+
+				break;
+			}
 
 			case RtcpPacketType::SDES:
 			case RtcpPacketType::BYE:
@@ -0,0 +1,107 @@
+#include "rtp_pacer.h"
+
+#include <algorithm>
+
+#define OV_LOG_TAG "RtpPacer"
+
+RtpPacer::RtpPacer(const SendFunction &send_function)
+	: _send_function(send_function),
+	  _last_process_time(std::chrono::steady_clock::now())
+{
+}
+
+void RtpPacer::SetTargetBitrate(uint64_t bitrate)
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	_pacing_rate = static_cast<uint64_t>(bitrate * RTP_PACER_PACING_FACTOR);
+}
+
+size_t RtpPacer::GetPacketSize(const std::shared_ptr<RtpPacket> &packet)
+{
+	return packet->HeadersSize() + packet->PayloadSize() + packet->PaddingSize();
+}
+
+void RtpPacer::Enqueue(const std::shared_ptr<RtpPacket> &packet, bool retransmission)
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	_queued_bytes += GetPacketSize(packet);
+
+	if (retransmission)
+	{
+		_retransmission_queue.push_back(packet);
+	}
+	else
+	{
+		_queue.push_back(packet);
+	}
+}
+
+bool RtpPacer::Process()
+{
+	// Packets are sent while holding the lock to keep the order of them
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	auto now = std::chrono::steady_clock::now();
+	int64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - _last_process_time).count();
+	_last_process_time = now;
+
+	if (_pacing_rate == 0)
+	{
+		// The target bitrate is not set yet - do not pace
+		_budget = INT64_MAX;
+	}
+	else
+	{
+		// Not to let the packets stay in the queue longer than RTP_PACER_MAX_QUEUE_DELAY_MS
+		uint64_t drain_rate = static_cast<uint64_t>(_queued_bytes) * 8 * 1000 / RTP_PACER_MAX_QUEUE_DELAY_MS;
+		uint64_t bytes_per_sec = std::max(_pacing_rate, drain_rate) / 8;
+
+		// The budget is not accumulated more than RTP_PACER_MAX_BURST_MS
+		elapsed = std::clamp(elapsed, static_cast<int64_t>(0), static_cast<int64_t>(RTP_PACER_MAX_BURST_MS * 1000));
+
+		int64_t max_budget = static_cast<int64_t>(bytes_per_sec * RTP_PACER_MAX_BURST_MS / 1000);
+		int64_t budget_to_add = static_cast<int64_t>(bytes_per_sec * elapsed / (1000 * 1000));
+
+		_budget = std::min(_budget + budget_to_add, max_budget);
+	}
+
+	while (((_retransmission_queue.empty() == false) || (_queue.empty() == false)) && (_budget > 0))
+	{
+		auto &queue = (_retransmission_queue.empty() == false) ? _retransmission_queue : _queue;
+
+		auto packet = std::move(queue.front());
+		queue.pop_front();
+
+		auto packet_size = GetPacketSize(packet);
+		_queued_bytes -= packet_size;
+		_budget -= packet_size;
+
+		_send_function(packet);
+	}
+
+	if (_pacing_rate == 0)
+	{
+		_budget = 0;
+	}
+
+	return (_retransmission_queue.empty() == false) || (_queue.empty() == false);
+}
+
+void RtpPacer::Clear()
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	_queue.clear();
+	_retransmission_queue.clear();
+	_queued_bytes = 0;
+	_budget = 0;
+}
+
+size_t RtpPacer::GetQueuedBytes() const
+{
+	std::lock_guard<std::mutex> lock_guard(_mutex);
+
+	return _queued_bytes;
+}
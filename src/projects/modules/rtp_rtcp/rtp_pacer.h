@@ -0,0 +1,63 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include "rtp_packet.h"
+
+// Packets are sent this much faster than the target bitrate, so the queue is drained before the next frame in most cases
+#define RTP_PACER_PACING_FACTOR			2.5
+// Maximum bytes which can be sent at once after the pacer is idle (in ms of the pacing rate)
+// It covers a frame interval (25 fps), so an ordinary frame is sent by the thread which queued it, not by the timer.
+#define RTP_PACER_MAX_BURST_MS			40
+// If the packets are queued longer than this, the pacing rate is increased to drain the queue in this time
+// (so the queue does not grow infinitely when the target bitrate is lower than the bitrate of the media)
+#define RTP_PACER_MAX_QUEUE_DELAY_MS	500
+// Interval at which the pacer should be processed while packets are queued
+#define RTP_PACER_PROCESS_INTERVAL_MS	5
+
+// A leaky bucket which smooths the bursts (key frames) of a session over time
+//
+// The pacer does not have its own thread. Process() is called when a packet is queued,
+// and every RTP_PACER_PROCESS_INTERVAL_MS by the owner while packets remain in the queue.
+class RtpPacer
+{
+public:
+	using SendFunction = std::function<bool(const std::shared_ptr<RtpPacket> &packet)>;
+
+	RtpPacer(const SendFunction &send_function);
+
+	// bitrate: bps
+	void SetTargetBitrate(uint64_t bitrate);
+
+	// Retransmissions are sent before the queued media packets (they are already late)
+	void Enqueue(const std::shared_ptr<RtpPacket> &packet, bool retransmission = false);
+	// Sends the queued packets as many as the budget allows
+	//
+	// Returns true if packets remain in the queue
+	bool Process();
+	void Clear();
+
+	size_t GetQueuedBytes() const;
+
+private:
+	static size_t GetPacketSize(const std::shared_ptr<RtpPacket> &packet);
+
+	SendFunction _send_function;
+
+	mutable std::mutex _mutex;
+
+	std::deque<std::shared_ptr<RtpPacket>> _queue;
+	std::deque<std::shared_ptr<RtpPacket>> _retransmission_queue;
+	// Bytes of both queues
+	size_t _queued_bytes = 0;
+
+	// bps
+	uint64_t _pacing_rate = 0;
+	// Bytes which can be sent now (can be negative by the size of the last packet sent)
+	int64_t _budget = 0;
+	std::chrono::steady_clock::time_point _last_process_time;
+};
@@ -78,6 +78,7 @@ RtpPacket::RtpPacket(RtpPacket &src)
 	_marker = src._marker;
 	_payload_type = src._payload_type;
 	_origin_payload_type = src._origin_payload_type;
+	_keyframe_start = src._keyframe_start;
 	_ssrc = src._ssrc;
 	_payload_offset = src._payload_offset;
 	_payload_size = src._payload_size;
@@ -124,6 +125,11 @@ uint8_t RtpPacket::OriginPayloadType() const
 	return _origin_payload_type;
 }
 
+bool RtpPacket::IsKeyframeStart() const
+{
+	return _keyframe_start;
+}
+
 uint16_t RtpPacket::SequenceNumber() const
 {
 	return _sequence_number;
@@ -183,6 +189,11 @@ void RtpPacket::SetUlpfec(bool is_fec, uint8_t origin_payload_type)
 	_origin_payload_type = origin_payload_type;
 }
 
+void RtpPacket::SetKeyframeStart(bool keyframe_start)
+{
+	_keyframe_start = keyframe_start;
+}
+
 void RtpPacket::SetSequenceNumber(uint16_t seq_no)
 {
 	_sequence_number = seq_no;
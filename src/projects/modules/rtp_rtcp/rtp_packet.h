@@ -48,6 +48,8 @@ public:
 	// For FEC Payload
 	bool		IsUlpfec() const;
 	uint8_t 	OriginPayloadType() const;
+	// true if the packet is the first packet of a key frame (not in the RTP header)
+	bool		IsKeyframeStart() const;
 	uint16_t	SequenceNumber() const;
 	uint32_t	Timestamp() const;
 	uint32_t	Ssrc() const;
@@ -59,6 +61,7 @@ public:
 	void		SetPayloadType(uint8_t payload_type);
 	// For FEC Payload
 	void 		SetUlpfec(bool is_fec, uint8_t origin_payload_type);
+	void		SetKeyframeStart(bool keyframe_start);
 	void		SetSequenceNumber(uint16_t seq_no);
 	void		SetTimestamp(uint32_t timestamp);
 	void		SetSsrc(uint32_t ssrc);
@@ -91,6 +94,7 @@ protected:
 	uint8_t		_payload_type = 0;
 	bool		_is_fec = false;
 	uint8_t 	_origin_payload_type = 0;
+	bool		_keyframe_start = false;
 	uint8_t		_padding_size = 0;
 	uint16_t	_sequence_number = 0;
 	uint32_t	_timestamp = 0;
@@ -135,6 +135,9 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 			return false;
 		}
 
+		// Used to switch renditions at key frames
+		packet->SetKeyframeStart((i == 0) && (frame_type == FrameType::VideoFrameKey));
+
 		_rtp_packet_count ++;
 		_stream->OnRtpPacketized(packet);
 
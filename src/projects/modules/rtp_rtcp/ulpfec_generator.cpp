@@ -1,4 +1,5 @@
 #include "ulpfec_generator.h"
+#include "fec_xor.h"
 #include "base/ovlibrary/byte_io.h"
 
 #include <string.h>
@@ -80,68 +81,39 @@ bool UlpfecGenerator::Encode()
 
 	for(uint32_t i=0; i<fec_packet_count; i++)
 	{
-		uint16_t sn_base = 0;
-		bool first_media_packet;
 		uint8_t mask[6];
-		int selected_media_count;
-
-		first_media_packet = true;
+		size_t selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
+		auto first_media_packet = _media_packets[media_packet_idx];
+		uint16_t sn_base = first_media_packet->SequenceNumber();
 
 		// TODO(Getroot): A more efficient algorithm should be used like random mask or bursty mask.
-		auto fec_packet = std::make_shared<ov::Data>();
-		fec_packet->SetLength(fec_header_size);
-		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
-
-		// Initialize
-		memset(mask, 0, sizeof(mask));
-		first_media_packet = true;
-		selected_media_count = (media_size-media_packet_idx) / (fec_packet_count - i);
 
-		for(int j=0; j<selected_media_count; j++)
+		// The FEC payload is as long as the longest media payload in the group,
+		// so allocate it once instead of growing it for every media packet
+		size_t max_payload_size = 0;
+		for(size_t j=0; j<selected_media_count; j++)
 		{
-			auto media_packet = _media_packets[media_packet_idx];
+			max_payload_size = std::max(max_payload_size, _media_packets[media_packet_idx + j]->PayloadSize());
+		}
 
-			size_t fec_packet_length = fec_header_size + media_packet->PayloadSize();
+		auto fec_packet = std::make_shared<ov::Data>(fec_header_size + max_payload_size);
+		fec_packet->SetLength(fec_header_size + max_payload_size);
+		auto fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
 
-			if(fec_packet->GetLength() < fec_packet_length)
-			{
-				fec_packet->SetLength(fec_packet_length);
-				fec_buffer = fec_packet->GetWritableDataAs<uint8_t>();
-			}
+		// Initialize the FEC packet with the first media packet (same as XORing it into a zeroed packet)
+		auto first_payload_size = first_media_packet->PayloadSize();
+		memset(fec_buffer, 0, fec_header_size);
+		memcpy(&fec_buffer[fec_header_size], first_media_packet->Payload(), first_payload_size);
+		memset(&fec_buffer[fec_header_size + first_payload_size], 0, max_payload_size - first_payload_size);
+		XorFecHeader(fec_buffer, first_media_packet.get());
 
-			if(first_media_packet)
-			{
-				// Write P, X, CC fields.
-				// Bits 0, 1 are overwritten in FinalizeFecHeaders.
-				fec_buffer[0] = media_packet->Buffer()[0];
-
-				// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
-				// We should use media payload type in the red header.
-				// M, and PT recovery
-				fec_buffer[1] = media_packet->Buffer()[media_packet->HeadersSize() - 1];
-				if(media_packet->Marker())
-				{
-					fec_buffer[1] |= 0x80;
-				}
-				else
-				{
-					fec_buffer[1] &= 0x7F;
-				}
-
-				// SN Base
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], media_packet->SequenceNumber());
-				// Write timestamp recovery field.
-				ByteWriter<uint32_t>::WriteBigEndian(&fec_buffer[4], media_packet->Timestamp());
-				// Write length recovery field.
-				ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[8], (uint16_t)media_packet->PayloadSize());
-				// Write Payload.
-				memcpy(&fec_buffer[fec_header_size], media_packet->Payload(), media_packet->PayloadSize());
-
-				sn_base = media_packet->SequenceNumber();
-
-				first_media_packet = false;
-			}
-			else
+		// XOR the rest of the group and build the mask in one pass
+		memset(mask, 0, sizeof(mask));
+		for(size_t j=0; j<selected_media_count; j++)
+		{
+			auto &media_packet = _media_packets[media_packet_idx];
+
+			if(j > 0)
 			{
 				XorFecPacket(fec_buffer, fec_header_size, media_packet.get());
 			}
@@ -151,7 +123,10 @@ bool UlpfecGenerator::Encode()
 			media_packet_idx++;
 		}
 
-		FinalizeFecHeader(fec_buffer, fec_packet->GetLength() - fec_header_size, mask, mask_len);
+		// SN Base
+		ByteWriter<uint16_t>::WriteBigEndian(&fec_buffer[2], sn_base);
+
+		FinalizeFecHeader(fec_buffer, max_payload_size, mask, mask_len);
 
 		_generated_fec_packets.push(fec_packet);
 	}
@@ -161,16 +136,18 @@ bool UlpfecGenerator::Encode()
 	return true;
 }
 
-void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *media_packet)
+void UlpfecGenerator::XorFecHeader(uint8_t *fec_packet, RedRtpPacket *media_packet)
 {
 	auto rtp_header = media_packet->Header();
 	auto rtp_header_len = media_packet->HeadersSize();
-	auto rtp_payload = media_packet->Payload();
 	auto rtp_payload_len = media_packet->PayloadSize();
 
 	// XOR the first 2 bytes of the header: V, P, X, CC
 	fec_packet[0] ^= rtp_header[0];
 
+	// The media_packet is red packet. So buffer[1] of RTP header has red payload type.
+	// We should use media payload type in the red header.
+	// M, and PT recovery
 	uint8_t m_pt_fields = rtp_header[rtp_header_len-1];
 	if(media_packet->Marker())
 	{
@@ -193,12 +170,14 @@ void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, R
 	ByteWriter<uint16_t>::WriteBigEndian(rtp_payload_length_network_order, (uint16_t)rtp_payload_len);
 	fec_packet[8] ^= rtp_payload_length_network_order[0];
 	fec_packet[9] ^= rtp_payload_length_network_order[1];
+}
+
+void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *media_packet)
+{
+	XorFecHeader(fec_packet, media_packet);
 
 	// XOR Payload
-	for(size_t i = 0; i < rtp_payload_len; i++)
-	{
-		fec_packet[fec_header_len + i] ^= rtp_payload[i];
-	}
+	FecXor::Xor(&fec_packet[fec_header_len], media_packet->Payload(), media_packet->PayloadSize());
 }
 
 void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len)
@@ -56,6 +56,9 @@ public:
 
 private:
 	bool Encode();
+	// XOR the recovery fields (P, X, CC, M, PT, TS, length) of the media packet into the FEC header
+	void XorFecHeader(uint8_t *fec_packet, RedRtpPacket *media_packet);
+	// XOR the recovery fields and the payload of the media packet into the FEC packet
 	void XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, RedRtpPacket *packet);
 	void FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len);
 
@@ -110,7 +110,7 @@ bool MediaDescription::UpdateData(ov::String &sdp)
 
 		if(payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::GoogRemb))
 		{
-			sdp.AppendFormat("a=rtcp-fb:%d goog_remb\r\n", payload_id);
+			sdp.AppendFormat("a=rtcp-fb:%d goog-remb\r\n", payload_id);
 		}
 		if(payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::TransportCc))
 		{
@@ -102,7 +102,8 @@ ov::String PayloadAttr::GetCodecParams() const
 
 bool PayloadAttr::EnableRtcpFb(const ov::String &type, const bool on)
 {
-	ov::String type_name = type.UpperCaseString();
+	// Both of "goog-remb" (RFC) and "goog_remb" are accepted
+	ov::String type_name = type.UpperCaseString().Replace("-", "_").Replace(" ", "_");
 
 	if(type_name == "GOOG_REMB")
 	{
@@ -55,6 +55,17 @@ namespace mon
 		bool OnStreamCanceled(const ov::Url &stream_uri); // Reservation Canceled
 		std::map<uint32_t, std::shared_ptr<ReservedStreamMetrics>> GetReservedStreamMetricsMap();
 
+		// Bytes of the segments kept in the memory by all streams of the application (segment publishers)
+		void SetSegmentBytes(uint64_t bytes)
+		{
+			_segment_bytes = bytes;
+		}
+
+		uint64_t GetSegmentBytes() const
+		{
+			return _segment_bytes;
+		}
+
 		// Overriding from CommonMetrics 
 		void IncreaseBytesIn(uint64_t value) override;
 		void IncreaseBytesOut(PublisherType type, uint64_t value) override;
@@ -68,5 +79,7 @@ namespace mon
 
 		std::shared_mutex _reserved_streams_guard;
 		std::map<uint32_t, std::shared_ptr<ReservedStreamMetrics>> _reserved_streams;
+
+		std::atomic<uint64_t> _segment_bytes{0};
 	};
 }  // namespace mon
\ No newline at end of file
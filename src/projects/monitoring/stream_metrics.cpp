@@ -53,6 +53,64 @@ namespace mon
 		UpdateDate();
 	}
 
+	void StreamMetrics::SetEstimatedBitrate(uint32_t session_id, uint64_t bitrate)
+	{
+		std::lock_guard<std::mutex> lock_guard(_estimated_bitrates_mutex);
+		_estimated_bitrates[session_id] = bitrate;
+	}
+
+	void StreamMetrics::RemoveEstimatedBitrate(uint32_t session_id)
+	{
+		std::lock_guard<std::mutex> lock_guard(_estimated_bitrates_mutex);
+		_estimated_bitrates.erase(session_id);
+	}
+
+	std::map<uint32_t, uint64_t> StreamMetrics::GetEstimatedBitrates() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_estimated_bitrates_mutex);
+		return _estimated_bitrates;
+	}
+
+	void StreamMetrics::SetSegmentBytes(PublisherType type, uint64_t bytes)
+	{
+		std::lock_guard<std::mutex> lock_guard(_segment_bytes_mutex);
+		_segment_bytes[type] = bytes;
+	}
+
+	uint64_t StreamMetrics::GetSegmentBytes() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_segment_bytes_mutex);
+
+		uint64_t bytes = 0;
+
+		for (const auto &item : _segment_bytes)
+		{
+			bytes += item.second;
+		}
+
+		return bytes;
+	}
+
+	void StreamMetrics::IncreaseTranscoderSharedFrameBytes(uint64_t value)
+	{
+		_transcoder_shared_frame_bytes += value;
+	}
+
+	void StreamMetrics::IncreaseTranscoderCascadedFrameBytes(uint64_t value)
+	{
+		_transcoder_cascaded_frame_bytes += value;
+	}
+
+	uint64_t StreamMetrics::GetTranscoderSharedFrameBytes() const
+	{
+		return _transcoder_shared_frame_bytes;
+	}
+
+	uint64_t StreamMetrics::GetTranscoderCascadedFrameBytes() const
+	{
+		return _transcoder_cascaded_frame_bytes;
+	}
+
 	void StreamMetrics::IncreaseBytesIn(uint64_t value)
 	{
 		CommonMetrics::IncreaseBytesIn(value);
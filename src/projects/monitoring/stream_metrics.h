@@ -42,6 +42,22 @@ namespace mon
 		void SetOriginRequestTimeMSec(int64_t value);
 		void SetOriginResponseTimeMSec(int64_t value);
 
+		// Estimated bandwidth to each viewer (WebRTC sessions), in bps
+		void SetEstimatedBitrate(uint32_t session_id, uint64_t bitrate);
+		void RemoveEstimatedBitrate(uint32_t session_id);
+		std::map<uint32_t, uint64_t> GetEstimatedBitrates() const;
+
+		// Bytes of the segments kept in the memory by each segment publisher (HLS, DASH, LL-DASH)
+		void SetSegmentBytes(PublisherType type, uint64_t bytes);
+		uint64_t GetSegmentBytes() const;
+
+		// Memory bandwidth saved by the transcoder: frames passed to multiple filters/encoders by reference,
+		// and the bytes the cascaded filters did not have to read from the decoded frames
+		void IncreaseTranscoderSharedFrameBytes(uint64_t value);
+		void IncreaseTranscoderCascadedFrameBytes(uint64_t value);
+		uint64_t GetTranscoderSharedFrameBytes() const;
+		uint64_t GetTranscoderCascadedFrameBytes() const;
+
 		// Overriding from CommonMetrics 
 		void IncreaseBytesIn(uint64_t value) override;
 		void IncreaseBytesOut(PublisherType type, uint64_t value) override;
@@ -52,6 +68,16 @@ namespace mon
 		std::atomic<int64_t> _request_time_to_origin_msec = 0;
 		std::atomic<int64_t> _response_time_from_origin_msec = 0;
 
+		// key: session id
+		mutable std::mutex _estimated_bitrates_mutex;
+		std::map<uint32_t, uint64_t> _estimated_bitrates;
+
+		mutable std::mutex _segment_bytes_mutex;
+		std::map<PublisherType, uint64_t> _segment_bytes;
+
+		std::atomic<uint64_t> _transcoder_shared_frame_bytes{0};
+		std::atomic<uint64_t> _transcoder_cascaded_frame_bytes{0};
+
 		std::shared_ptr<ApplicationMetrics>	_app_metrics;
 	};
 }
\ No newline at end of file
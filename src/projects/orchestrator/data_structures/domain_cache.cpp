@@ -0,0 +1,151 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "domain_cache.h"
+
+namespace ocst
+{
+	DomainCache::DomainCache(const std::vector<std::shared_ptr<VirtualHost>> &virtual_host_list)
+	{
+		for (auto &vhost : virtual_host_list)
+		{
+			priority_t priority = _vhost_names.size();
+
+			_vhost_names.push_back(vhost->name);
+
+			for (auto &host : vhost->host_list)
+			{
+				AddHost(priority, host);
+			}
+		}
+	}
+
+	void DomainCache::AddHost(priority_t priority, const Host &host)
+	{
+		std::string name = host.name.CStr();
+
+		auto wildcard_position = name.find_first_of("*?");
+
+		if (wildcard_position == std::string::npos)
+		{
+			// Keep the first one if several VirtualHosts have the same name
+			_exact_map.emplace(name, priority);
+			return;
+		}
+
+		// "*.<labels without wildcards>"
+		if ((name.size() > 2) && (name[0] == '*') && (name[1] == '.') &&
+			(name.find_first_of("*?", 1) == std::string::npos) &&
+			// Empty labels are left to the regex
+			(name.find("..") == std::string::npos) && (name.back() != '.'))
+		{
+			AddWildcardSuffix(priority, name.substr(2));
+			return;
+		}
+
+		_regex_rules.push_back({priority, host.regex_for_domain});
+	}
+
+	void DomainCache::AddWildcardSuffix(priority_t priority, const std::string &suffix)
+	{
+		auto node = &_wildcard_root;
+		size_t end = suffix.size();
+
+		// Insert the labels from the end
+		while (true)
+		{
+			auto dot = (end > 0) ? suffix.rfind('.', end - 1) : std::string::npos;
+			auto start = (dot == std::string::npos) ? 0 : (dot + 1);
+
+			auto &child = node->children[suffix.substr(start, end - start)];
+			if (child == nullptr)
+			{
+				child = std::make_unique<LabelNode>();
+			}
+			node = child.get();
+
+			if (dot == std::string::npos)
+			{
+				break;
+			}
+
+			end = dot;
+		}
+
+		node->wildcard_priority = std::min(node->wildcard_priority, priority);
+	}
+
+	DomainCache::priority_t DomainCache::FindFromTrie(const std::string &domain_name) const
+	{
+		priority_t best = NoMatch;
+		auto node = &_wildcard_root;
+		size_t end = domain_name.size();
+
+		while (node->children.empty() == false)
+		{
+			auto dot = (end > 0) ? domain_name.rfind('.', end - 1) : std::string::npos;
+
+			if (dot == std::string::npos)
+			{
+				// The first label cannot be matched with "*." because there is no '.' in front of it
+				break;
+			}
+
+			auto child = node->children.find(domain_name.substr(dot + 1, end - dot - 1));
+
+			if (child == node->children.end())
+			{
+				break;
+			}
+
+			node = child->second.get();
+
+			// "*" of "*.<suffix>" matches everything in front of ".<suffix>", including an empty string
+			best = std::min(best, node->wildcard_priority);
+
+			end = dot;
+		}
+
+		return best;
+	}
+
+	ov::String DomainCache::GetVhostName(const ov::String &domain_name) const
+	{
+		if (domain_name.IsEmpty())
+		{
+			return "";
+		}
+
+		std::string name = domain_name.CStr();
+		priority_t best = NoMatch;
+
+		auto exact_item = _exact_map.find(name);
+		if (exact_item != _exact_map.end())
+		{
+			best = exact_item->second;
+		}
+
+		best = std::min(best, FindFromTrie(name));
+
+		for (auto &rule : _regex_rules)
+		{
+			if (rule.priority >= best)
+			{
+				// Rules are sorted by priority, so the remaining rules cannot win
+				break;
+			}
+
+			if (std::regex_match(name, rule.regex_for_domain))
+			{
+				best = rule.priority;
+				break;
+			}
+		}
+
+		return (best == NoMatch) ? "" : _vhost_names[best];
+	}
+}  // namespace ocst
@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <memory>
+#include <regex>
+#include <unordered_map>
+#include <vector>
+
+#include "structures.h"
+
+namespace ocst
+{
+	// An immutable snapshot of the host names of all VirtualHosts, used to find the VirtualHost of a domain.
+	//
+	// The result is the same as matching Host::regex_for_domain of each VirtualHost in order, but:
+	//  - Names without wildcards are looked up in a hash map
+	//  - Names like "*.airensoft.com" are looked up in a trie of the domain labels
+	//  - Only the other names (eg: "*", "ome?.airensoft.com") are evaluated with std::regex
+	//
+	// A DomainCache is never modified after it is built, so it can be used by several threads without locking.
+	class DomainCache
+	{
+	public:
+		DomainCache(const std::vector<std::shared_ptr<VirtualHost>> &virtual_host_list);
+
+		// Returns an empty string if there is no VirtualHost for the domain
+		ov::String GetVhostName(const ov::String &domain_name) const;
+
+	protected:
+		// The index of VirtualHost in the list. If several VirtualHosts match a domain, the smallest index wins.
+		typedef size_t priority_t;
+		static constexpr priority_t NoMatch = SIZE_MAX;
+
+		struct LabelNode
+		{
+			// Priority of the "*.<labels to this node>" rule
+			priority_t wildcard_priority = NoMatch;
+
+			std::unordered_map<std::string, std::unique_ptr<LabelNode>> children;
+		};
+
+		struct RegexRule
+		{
+			priority_t priority;
+			std::regex regex_for_domain;
+		};
+
+		void AddHost(priority_t priority, const Host &host);
+		void AddWildcardSuffix(priority_t priority, const std::string &suffix);
+
+		priority_t FindFromTrie(const std::string &domain_name) const;
+
+		std::vector<ov::String> _vhost_names;
+
+		// key: host name, value: priority
+		std::unordered_map<std::string, priority_t> _exact_map;
+		// Domain labels are stored from the end (eg: "*.airensoft.com" => com -> airensoft)
+		LabelNode _wildcard_root;
+		// Ordered by priority
+		std::vector<RegexRule> _regex_rules;
+	};
+}  // namespace ocst
@@ -148,11 +148,18 @@ namespace ocst
 			}
 		}
 
+		UpdateDomainCache();
+
 		logtd("All items are applied");
 
 		return result;
 	}
 
+	void Orchestrator::UpdateDomainCache()
+	{
+		std::atomic_store(&_domain_cache, std::shared_ptr<const DomainCache>(std::make_shared<DomainCache>(_virtual_host_list)));
+	}
+
 	std::vector<std::shared_ptr<ocst::VirtualHost>> Orchestrator::GetVirtualHostList()
 	{
 		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
@@ -233,28 +240,14 @@ namespace ocst
 
 	ov::String Orchestrator::GetVhostNameFromDomain(const ov::String &domain_name) const
 	{
-		// TODO(dimiden): I think it would be nice to create a VHost cache for performance
+		auto domain_cache = std::atomic_load(&_domain_cache);
 
-		if (domain_name.IsEmpty() == false)
+		if ((domain_cache == nullptr) || domain_name.IsEmpty())
 		{
-			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
-
-			// Search for the domain corresponding to domain_name
-
-			// CAUTION: This code is important to order, so don't use _virtual_host_map
-			for (auto &vhost_item : _virtual_host_list)
-			{
-				for (auto &host_item : vhost_item->host_list)
-				{
-					if (std::regex_match(domain_name.CStr(), host_item.regex_for_domain))
-					{
-						return vhost_item->name;
-					}
-				}
-			}
+			return "";
 		}
 
-		return "";
+		return domain_cache->GetVhostName(domain_name);
 	}
 
 	info::VHostAppName Orchestrator::ResolveApplicationNameFromDomain(const ov::String &domain_name, const ov::String &app_name) const
@@ -326,6 +319,8 @@ namespace ocst
 		_virtual_host_list.clear();
 		_virtual_host_map.clear();
 
+		UpdateDomainCache();
+
 		return Result::Succeeded;
 	}
 
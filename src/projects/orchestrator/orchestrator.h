@@ -154,7 +154,14 @@ namespace ocst
 		bool OnStreamPrepared(const info::Application &app_info, const std::shared_ptr<info::Stream> &info) override;
 
 	protected:
+		/// Publishes a new DomainCache built from _virtual_host_list. _virtual_host_map_mutex must be locked.
+		void UpdateDomainCache();
+
 		std::recursive_mutex _module_list_mutex;
 		mutable std::recursive_mutex _virtual_host_map_mutex;
+
+		// Replaced as a whole (using std::atomic_load()/std::atomic_store()) whenever the VirtualHost list is changed,
+		// so GetVhostNameFromDomain() doesn't need to lock _virtual_host_map_mutex
+		std::shared_ptr<const DomainCache> _domain_cache;
 	};
 }  // namespace ocst
@@ -141,6 +141,11 @@ namespace pvd
 				logti("%s is listening on %s", GetProviderName(), address.ToString().CStr());
 			}
 
+			if ((socket_type == ov::SocketType::Udp) && (mpegts_provider_config.GetRecvBatchSize() > 1))
+			{
+				physical_port->SetRecvBatch(mpegts_provider_config.GetRecvBatchSize());
+			}
+
 			physical_port->AddObserver(this);
 
 			auto stream_map_item = std::make_shared<MpegTsStreamPortItem>(socket_type, port, physical_port);
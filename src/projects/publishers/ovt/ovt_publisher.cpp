@@ -53,6 +53,11 @@ bool OvtPublisher::Start()
 		{
 			logti("%s is listening on %s", GetPublisherName(), address.ToString().CStr());
 			_server_port->AddObserver(this);
+
+			if (port_config.GetSocketType() == ov::SocketType::Tcp)
+			{
+				_server_port->SetSendQueueSize(ovt_config.GetSendQueueSize());
+			}
 		}
 		else
 		{
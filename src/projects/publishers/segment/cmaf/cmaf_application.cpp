@@ -38,6 +38,7 @@ CmafApplication::CmafApplication(const std::shared_ptr<pub::Publisher> &publishe
 	auto publisher_info = application_info.GetPublisher<cfg::vhost::app::pub::LlDashPublisher>();
 	_segment_count = 1;
 	_segment_duration = publisher_info->GetSegmentDuration();
+	_memory_budget = static_cast<size_t>(std::max(publisher_info->GetMemoryBudget(), 0)) * 1024 * 1024;
 	_chunked_transfer = chunked_transfer;
 }
 
@@ -59,6 +60,7 @@ bool CmafApplication::Start()
 
 	_segment_count = 1;
 	_segment_duration = publisher_info->GetSegmentDuration();
+	_memory_budget = static_cast<size_t>(std::max(publisher_info->GetMemoryBudget(), 0)) * 1024 * 1024;
 
 	return Application::Start();
 }
@@ -82,6 +84,9 @@ std::shared_ptr<pub::Stream> CmafApplication::CreateStream(const std::shared_ptr
 	return SegmentStream::Create<CmafStreamPacketizer>(
 		GetSharedPtrAs<pub::Application>(), *info.get(),
 		_segment_count, _segment_duration,
+		_memory_budget,
+		// LL-DASH doesn't support DVR yet
+		"", 0LL,
 		thread_count,
 		_chunked_transfer);
 }
@@ -39,6 +39,8 @@ private:
 private:
 	int _segment_count;
 	int _segment_duration;
+	// Unit: bytes
+	size_t _memory_budget = 0;
 
 	std::shared_ptr<ChunkedTransferInterface> _chunked_transfer = nullptr;
 };
@@ -637,25 +637,11 @@ std::shared_ptr<const SegmentItem> CmafPacketizer::GetSegmentData(const ov::Stri
 	switch (file_type)
 	{
 		case DashFileType::VideoSegment: {
-			std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-			auto item = std::find_if(_video_segments.begin(), _video_segments.end(),
-									 [&](std::shared_ptr<SegmentItem> const &value) -> bool {
-										 return value != nullptr ? value->file_name == file_name : false;
-									 });
-
-			return (item != _video_segments.end()) ? (*item) : nullptr;
+			return _video_segment_ring.Find(file_name);
 		}
 
 		case DashFileType::AudioSegment: {
-			std::unique_lock<std::mutex> lock(_audio_segment_mutex);
-
-			auto item = std::find_if(_audio_segments.begin(), _audio_segments.end(),
-									 [&](std::shared_ptr<SegmentItem> const &value) -> bool {
-										 return value != nullptr ? value->file_name == file_name : false;
-									 });
-
-			return (item != _audio_segments.end()) ? (*item) : nullptr;
+			return _audio_segment_ring.Find(file_name);
 		}
 
 		case DashFileType::VideoInit:
@@ -680,15 +666,7 @@ bool CmafPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int
 	switch (file_type)
 	{
 		case DashFileType::VideoSegment: {
-			// video segment mutex
-			std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-			_video_segments[_current_video_index++] = std::make_shared<SegmentItem>(SegmentDataType::Video, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data);
-
-			if (_segment_save_count <= _current_video_index)
-			{
-				_current_video_index = 0;
-			}
+			_video_segment_ring.Append(std::make_shared<SegmentItem>(SegmentDataType::Video, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data));
 
 			_video_segment_count++;
 
@@ -699,15 +677,7 @@ bool CmafPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int
 		}
 
 		case DashFileType::AudioSegment: {
-			// audio segment mutex
-			std::unique_lock<std::mutex> lock(_audio_segment_mutex);
-
-			_audio_segments[_current_audio_index++] = std::make_shared<SegmentItem>(SegmentDataType::Audio, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data);
-
-			if (_segment_save_count <= _current_audio_index)
-			{
-				_current_audio_index = 0;
-			}
+			_audio_segment_ring.Append(std::make_shared<SegmentItem>(SegmentDataType::Audio, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data));
 
 			_audio_segment_count++;
 
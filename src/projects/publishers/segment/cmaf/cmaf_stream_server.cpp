@@ -14,6 +14,59 @@
 #include "cmaf_packetizer.h"
 #include "cmaf_private.h"
 
+std::shared_ptr<CmafStreamServer::CmafStreamChunks> CmafStreamServer::GetStreamChunks(const ov::String &app_name, const ov::String &stream_name, bool create)
+{
+	auto key = ov::String::FormatString("%s/%s", app_name.CStr(), stream_name.CStr());
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_chunks_map_mutex);
+
+		auto item = _stream_chunks_map.find(key);
+
+		if (item != _stream_chunks_map.end())
+		{
+			return item->second;
+		}
+	}
+
+	if (create == false)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::shared_mutex> lock(_stream_chunks_map_mutex);
+
+	auto &stream_chunks = _stream_chunks_map[key];
+
+	if (stream_chunks == nullptr)
+	{
+		stream_chunks = std::make_shared<CmafStreamChunks>();
+	}
+
+	return stream_chunks;
+}
+
+void CmafStreamServer::RemoveStreamChunksIfEmpty(const ov::String &app_name, const ov::String &stream_name)
+{
+	auto key = ov::String::FormatString("%s/%s", app_name.CStr(), stream_name.CStr());
+
+	std::lock_guard<std::shared_mutex> lock(_stream_chunks_map_mutex);
+
+	auto item = _stream_chunks_map.find(key);
+
+	if (item != _stream_chunks_map.end())
+	{
+		// Keep the reference until the lock is released
+		auto stream_chunks = item->second;
+		std::lock_guard<std::mutex> stream_lock(stream_chunks->mutex);
+
+		if (stream_chunks->segment_map.empty())
+		{
+			_stream_chunks_map.erase(item);
+		}
+	}
+}
+
 HttpConnection CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<HttpClient> &client,
 													   const SegmentStreamRequestInfo &request_info,
 													   SegmentType segment_type)
@@ -23,67 +76,127 @@ HttpConnection CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<Htt
 	auto type = CmafPacketizer::GetFileType(request_info.file_name);
 
 	bool is_video = ((type == DashFileType::VideoSegment) || (type == DashFileType::VideoInit));
-	std::shared_ptr<SegmentItem> segment = nullptr;
 
 	// Check if the requested file is being created
+	auto stream_chunks = GetStreamChunks(request_info.vhost_app_name.CStr(), request_info.stream_name, false);
+	std::shared_ptr<CmafSegmentChunks> segment_chunks;
+
+	if (stream_chunks != nullptr)
 	{
-		auto key = ov::String::FormatString("%s/%s/%s", request_info.vhost_app_name.CStr(), request_info.stream_name.CStr(), request_info.file_name.CStr());
+		std::lock_guard<std::mutex> lock(stream_chunks->mutex);
 
-		std::unique_lock<std::mutex> lock(_http_chunk_guard);
+		auto chunk_item = stream_chunks->segment_map.find(request_info.file_name);
 
-		auto chunk_item = _http_chunk_list.find(key);
-		if (chunk_item != _http_chunk_list.end())
+		if (chunk_item != stream_chunks->segment_map.end())
 		{
-			// Find stream info
-			std::shared_ptr<pub::Stream> stream_info;
-			for (auto observer : _observers)
-			{
-				auto segment_publisher = std::dynamic_pointer_cast<pub::Publisher>(observer);
+			segment_chunks = chunk_item->second;
+		}
+	}
 
-				if (segment_publisher != nullptr)
-				{
-					stream_info = segment_publisher->GetStreamAs<pub::Stream>(request_info.vhost_app_name, request_info.stream_name);
+	if (segment_chunks == nullptr)
+	{
+		return DashStreamServer::ProcessSegmentRequest(client, request_info, segment_type);
+	}
+
+	// Find stream info
+	std::shared_ptr<pub::Stream> stream_info;
+	for (auto observer : _observers)
+	{
+		auto segment_publisher = std::dynamic_pointer_cast<pub::Publisher>(observer);
+
+		if (segment_publisher != nullptr)
+		{
+			stream_info = segment_publisher->GetStreamAs<pub::Stream>(request_info.vhost_app_name, request_info.stream_name);
 
-					if (stream_info != nullptr)
-					{
-						break;
-					}
-				}
+			if (stream_info != nullptr)
+			{
+				break;
 			}
+		}
+	}
+
+	if (stream_info == nullptr)
+	{
+		OV_ASSERT(false, "Stream does not exist, but remains in _stream_chunks_map");
 
-			if (stream_info == nullptr)
+		response->SetStatusCode(HttpStatusCode::InternalServerError);
+		return HttpConnection::Closed;
+	}
+
+	client->GetRequest()->SetExtra(stream_info);
+
+	// The file is being created
+	logtd("Requested file is being created");
+
+	// Set HTTP header
+	response->SetHeader("Content-Type", is_video ? "video/mp4" : "audio/mp4");
+
+	// Enable chunked transfer
+	response->SetKeepAlive();
+	response->SetChunkedTransfer();
+
+	// Send the header only - the chunks are pulled from the start of the segment when the socket is writable
+	IncreaseBytesOut(client, response->Response());
+
+	std::weak_ptr<HttpClient> weak_client = client;
+	// Index of the next chunk to send
+	auto cursor = std::make_shared<size_t>(0);
+
+	response->SetChunkSource([this, weak_client, stream_chunks, segment_chunks, cursor](std::vector<std::shared_ptr<const ov::Data>> &chunk_list) -> bool {
+		size_t bytes = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(stream_chunks->mutex);
+
+			auto &segment_chunk_list = segment_chunks->chunk_list;
+
+			for (; *cursor < segment_chunk_list.size(); (*cursor)++)
 			{
-				OV_ASSERT(false, "Stream does not exist, but remains in _http_chunk_list");
+				auto &chunk = segment_chunk_list[*cursor];
 
-				response->SetStatusCode(HttpStatusCode::InternalServerError);
-				return HttpConnection::Closed;
+				chunk_list.push_back(chunk);
+				bytes += chunk->GetLength();
 			}
+		}
 
-			client->GetRequest()->SetExtra(stream_info);
-
-			// The file is being created
-			logtd("Requested file is being created");
+		if (bytes == 0)
+		{
+			return false;
+		}
 
-			// Set HTTP header
-			response->SetHeader("Content-Type", is_video ? "video/mp4" : "audio/mp4");
+		auto client = weak_client.lock();
 
-			// Enable chunked transfer
-			response->SetKeepAlive();
-			response->SetChunkedTransfer();
+		if (client != nullptr)
+		{
+			IncreaseBytesOut(client, bytes);
+		}
 
-			// Append data to HTTP response
-			response->AppendData(chunk_item->second->chunked_data);
-			auto sent_bytes = response->Response();
+		return true;
+	});
 
-			IncreaseBytesOut(client, sent_bytes);
+	{
+		std::lock_guard<std::mutex> lock(stream_chunks->mutex);
 
-			chunk_item->second->client_list.push_back(client);
+		auto chunk_item = stream_chunks->segment_map.find(request_info.file_name);
 
+		if ((chunk_item != stream_chunks->segment_map.end()) && (chunk_item->second == segment_chunks))
+		{
+			// OnCmafChunkDataPush()/OnCmafChunkedComplete() will notify the client
+			segment_chunks->client_list.push_back(client);
 			return HttpConnection::KeepAlive;
 		}
 	}
 
-	return DashStreamServer::ProcessSegmentRequest(client, request_info, segment_type);
+	// The segment is completed in the meantime
+	if (response->CompleteChunkSource() == false)
+	{
+		logtw("[%s] Could not response the CMAF chunk: [%s/%s, %s]",
+			  response->GetRemote()->ToString().CStr(), request_info.vhost_app_name.CStr(), request_info.stream_name.CStr(), request_info.file_name.CStr());
+	}
+
+	response->Close();
+
+	return HttpConnection::KeepAlive;
 }
 
 void CmafStreamServer::OnCmafChunkDataPush(const ov::String &app_name, const ov::String &stream_name,
@@ -91,33 +204,30 @@ void CmafStreamServer::OnCmafChunkDataPush(const ov::String &app_name, const ov:
 										   bool is_video,
 										   std::shared_ptr<ov::Data> &chunk_data)
 {
-	auto key = ov::String::FormatString("%s/%s/%s", app_name.CStr(), stream_name.CStr(), file_name.CStr());
-
-	std::unique_lock<std::mutex> lock(_http_chunk_guard);
+	auto stream_chunks = GetStreamChunks(app_name, stream_name, true);
+	std::vector<std::shared_ptr<HttpClient>> client_list;
 
-	auto chunk_item = _http_chunk_list.find(key);
-	if (chunk_item == _http_chunk_list.end())
 	{
-		// New chunk data is arrived
-		logtd("Create a new chunk for [%s/%s, %s], size: %zu bytes", app_name.CStr(), stream_name.CStr(), file_name.CStr(), chunk_data->GetLength());
-		_http_chunk_list.emplace(key, std::make_shared<CmafHttpChunkedData>(chunk_data));
-		return;
-	}
+		std::lock_guard<std::mutex> lock(stream_chunks->mutex);
 
-	chunk_item->second->AddChunkData(chunk_data);
+		auto &segment_chunks = stream_chunks->segment_map[file_name];
 
-	for (auto client : chunk_item->second->client_list)
-	{
-		auto response = client->GetResponse();
-
-		if (response->SendChunkedData(chunk_data))
-		{
-			IncreaseBytesOut(client, chunk_data->GetLength());
-		}
-		else
+		if (segment_chunks == nullptr)
 		{
-			logtw("Failed to send the chunked data for [%s/%s, %s] to %s (%zu bytes)", app_name.CStr(), stream_name.CStr(), file_name.CStr(), response->GetRemote()->ToString().CStr(), chunk_data->GetLength());
+			// New chunk data is arrived
+			logtd("Create a new chunk for [%s/%s, %s], size: %zu bytes", app_name.CStr(), stream_name.CStr(), file_name.CStr(), chunk_data->GetLength());
+			segment_chunks = std::make_shared<CmafSegmentChunks>();
 		}
+
+		// The chunk is shared by all clients without copying
+		segment_chunks->chunk_list.push_back(chunk_data);
+		client_list = segment_chunks->client_list;
+	}
+
+	// The clients pull the chunk when their sockets are writable
+	for (auto &client : client_list)
+	{
+		client->GetResponse()->NotifyChunkSource();
 	}
 }
 
@@ -125,34 +235,46 @@ void CmafStreamServer::OnCmafChunkedComplete(const ov::String &app_name, const o
 											 const ov::String &file_name,
 											 bool is_video)
 {
-	std::shared_ptr<CmafHttpChunkedData> chunked_data;
+	auto stream_chunks = GetStreamChunks(app_name, stream_name, false);
+	std::shared_ptr<CmafSegmentChunks> segment_chunks;
+	bool is_last_segment = false;
 
+	if (stream_chunks != nullptr)
 	{
-		auto key = ov::String::FormatString("%s/%s/%s", app_name.CStr(), stream_name.CStr(), file_name.CStr());
-
-		std::unique_lock<std::mutex> lock(_http_chunk_guard);
+		std::lock_guard<std::mutex> lock(stream_chunks->mutex);
 
-		auto chunk_item = _http_chunk_list.find(key);
+		auto chunk_item = stream_chunks->segment_map.find(file_name);
 
-		if (chunk_item == _http_chunk_list.end())
+		if (chunk_item != stream_chunks->segment_map.end())
 		{
-			logtw("Could not find a CMAF chunk [%s/%s, %s]", app_name.CStr(), stream_name.CStr(), file_name.CStr());
-			OV_ASSERT2(false);
-			return;
+			segment_chunks = chunk_item->second;
+			stream_chunks->segment_map.erase(chunk_item);
 		}
 
-		chunked_data = chunk_item->second;
+		is_last_segment = stream_chunks->segment_map.empty();
+	}
 
-		_http_chunk_list.erase(chunk_item);
+	if (is_last_segment)
+	{
+		RemoveStreamChunksIfEmpty(app_name, stream_name);
+	}
+
+	if (segment_chunks == nullptr)
+	{
+		logtw("Could not find a CMAF chunk [%s/%s, %s]", app_name.CStr(), stream_name.CStr(), file_name.CStr());
+		OV_ASSERT2(false);
+		return;
 	}
 
 	logtd("The chunk is completed [%s/%s, %s]", app_name.CStr(), stream_name.CStr(), file_name.CStr());
 
-	for (auto client : chunked_data->client_list)
+	// No more clients are added to client_list after the segment is removed from the map
+	for (auto &client : segment_chunks->client_list)
 	{
 		auto response = client->GetResponse();
 
-		if (response->SendChunkedData(nullptr) == false)
+		// Most clients already have all chunks, so only the last chunk is sent here
+		if (response->CompleteChunkSource() == false)
 		{
 			logtw("[%s] Could not response the CMAF chunk: [%s/%s, %s]",
 				  response->GetRemote()->ToString().CStr(), app_name.CStr(), stream_name.CStr(), file_name.CStr());
@@ -160,4 +282,6 @@ void CmafStreamServer::OnCmafChunkedComplete(const ov::String &app_name, const o
 
 		response->Close();
 	}
-}
\ No newline at end of file
+
+	segment_chunks->client_list.clear();
+}
@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <shared_mutex>
+
 #include "../dash/dash_stream_server.h"
 #include "cmaf_interceptor.h"
 #include "cmaf_packetizer.h"
@@ -31,24 +33,26 @@ public:
 	}
 
 protected:
-	struct CmafHttpChunkedData
+	// Chunks of a segment which is being made (shared by all clients that request the segment)
+	struct CmafSegmentChunks
 	{
-	public:
-		CmafHttpChunkedData(const std::shared_ptr<const ov::Data> &data)
-		{
-			chunked_data = std::make_shared<ov::Data>(104 * 1024);
-			chunked_data->Append(data);
-		}
-
-		void AddChunkData(const std::shared_ptr<ov::Data> &data)
-		{
-			chunked_data->Append(data);
-		}
-
-		std::shared_ptr<ov::Data> chunked_data;
+		// Append-only while the segment is being made - each client reads it with its own cursor
+		std::vector<std::shared_ptr<const ov::Data>> chunk_list;
 		std::vector<std::shared_ptr<HttpClient>> client_list;
 	};
 
+	// Segments of a stream which are being made
+	// Each stream has its own lock, so the packetizers of the streams don't block each other
+	struct CmafStreamChunks
+	{
+		std::mutex mutex;
+		// Key: file name
+		std::map<ov::String, std::shared_ptr<CmafSegmentChunks>> segment_map;
+	};
+
+	std::shared_ptr<CmafStreamChunks> GetStreamChunks(const ov::String &app_name, const ov::String &stream_name, bool create);
+	void RemoveStreamChunksIfEmpty(const ov::String &app_name, const ov::String &stream_name);
+
 	//--------------------------------------------------------------------
 	// Overriding functions of DashStreamServer
 	//--------------------------------------------------------------------
@@ -67,8 +71,7 @@ protected:
 							   const ov::String &file_name,
 							   bool is_video) override;
 
-	// A temporary queue for the intermediate chunks
-	// Key: [app name]/[stream name]/[file name]
-	std::map<ov::String, std::shared_ptr<CmafHttpChunkedData>> _http_chunk_list;
-	std::mutex _http_chunk_guard;
+	// Key: [app name]/[stream name]
+	std::map<ov::String, std::shared_ptr<CmafStreamChunks>> _stream_chunks_map;
+	std::shared_mutex _stream_chunks_map_mutex;
 };
@@ -35,6 +35,7 @@ DashApplication::DashApplication(const std::shared_ptr<pub::Publisher> &publishe
 	auto publisher_info = application_info.GetPublisher<cfg::vhost::app::pub::DashPublisher>();
 	_segment_count = publisher_info->GetSegmentCount();
 	_segment_duration = publisher_info->GetSegmentDuration();
+	_memory_budget = static_cast<size_t>(std::max(publisher_info->GetMemoryBudget(), 0)) * 1024 * 1024;
 }
 
 //====================================================================================================
@@ -55,6 +56,21 @@ bool DashApplication::Start()
 
 	_segment_count = publisher_info->GetSegmentCount();
 	_segment_duration = publisher_info->GetSegmentDuration();
+	_memory_budget = static_cast<size_t>(std::max(publisher_info->GetMemoryBudget(), 0)) * 1024 * 1024;
+
+	auto &dvr = publisher_info->GetDvr();
+
+	if (dvr.IsEnabled())
+	{
+		_dvr_directory = ov::PathManager::ExpandPath(dvr.GetDirectory());
+		_dvr_duration_in_ms = static_cast<int64_t>(std::max(dvr.GetDuration(), 0)) * 1000;
+
+		if (ov::PathManager::MakeDirectory(_dvr_directory) == false)
+		{
+			logtw("DVR is disabled because the directory could not be created: %s (%s)", _dvr_directory.CStr(), ov::Error::CreateErrorFromErrno()->ToString().CStr());
+			_dvr_duration_in_ms = 0LL;
+		}
+	}
 
 	return Application::Start();
 }
@@ -78,6 +94,8 @@ std::shared_ptr<pub::Stream> DashApplication::CreateStream(const std::shared_ptr
 	return SegmentStream::Create<DashStreamPacketizer>(
 		GetSharedPtrAs<pub::Application>(), *info.get(),
 		_segment_count, _segment_duration,
+		_memory_budget,
+		_dvr_directory, _dvr_duration_in_ms,
 		thread_count,
 		nullptr);
 }
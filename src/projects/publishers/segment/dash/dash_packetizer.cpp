@@ -552,16 +552,17 @@ bool DashPacketizer::GetSegmentInfos(ov::String *video_urls, ov::String *audio_u
 	bool calculated = false;
 
 	{
-		std::unique_lock<std::mutex> lock(_video_segment_mutex);
+		std::vector<std::shared_ptr<SegmentItem>> video_segments;
+		GetVideoPlaySegments(video_segments);
 
-		if (_video_segment_queue.size() >= segment_count)
+		if (video_segments.size() >= segment_count)
 		{
 			int index = 0;
 			uint64_t video_total_duration = 0ULL;
 			uint64_t video_last_duration = 0ULL;
 			video_urls->Clear();
 
-			std::for_each(_video_segment_queue.end() - segment_count, _video_segment_queue.end() - 1, [&index, &video_total_duration, video_urls](const std::shared_ptr<SegmentItem> &segment) -> void {
+			std::for_each(video_segments.begin(), video_segments.end() - 1, [&index, &video_total_duration, video_urls](const std::shared_ptr<SegmentItem> &segment) -> void {
 				// Append [				<S]
 				video_urls->Append("\t\t\t\t<S");
 
@@ -578,7 +579,7 @@ bool DashPacketizer::GetSegmentInfos(ov::String *video_urls, ov::String *audio_u
 				index++;
 			});
 
-			video_last_duration = _video_segment_queue.back()->duration;
+			video_last_duration = video_segments.back()->duration;
 
 			time_shift_buffer_depth_for_video = video_total_duration * _video_timebase_expr;
 			minimum_update_period_for_video = video_last_duration * _video_timebase_expr;
@@ -588,16 +589,17 @@ bool DashPacketizer::GetSegmentInfos(ov::String *video_urls, ov::String *audio_u
 	}
 
 	{
-		std::unique_lock<std::mutex> lock(_audio_segment_mutex);
+		std::vector<std::shared_ptr<SegmentItem>> audio_segments;
+		GetAudioPlaySegments(audio_segments);
 
-		if (_audio_segment_queue.size() >= segment_count)
+		if (audio_segments.size() >= segment_count)
 		{
 			int index = 0;
 			uint64_t audio_total_duration = 0ULL;
 			uint64_t audio_last_duration = 0ULL;
 			audio_urls->Clear();
 
-			std::for_each(_audio_segment_queue.end() - segment_count, _audio_segment_queue.end() - 1, [&index, &audio_total_duration, audio_urls](const std::shared_ptr<SegmentItem> &segment) -> void {
+			std::for_each(audio_segments.begin(), audio_segments.end() - 1, [&index, &audio_total_duration, audio_urls](const std::shared_ptr<SegmentItem> &segment) -> void {
 				// Append [				<S]
 				audio_urls->Append("\t\t\t\t<S");
 
@@ -614,7 +616,7 @@ bool DashPacketizer::GetSegmentInfos(ov::String *video_urls, ov::String *audio_u
 				index++;
 			});
 
-			audio_last_duration = _audio_segment_queue.back()->duration;
+			audio_last_duration = audio_segments.back()->duration;
 
 			time_shift_buffer_depth_for_audio = audio_total_duration * _audio_timebase_expr;
 			minimum_update_period_for_audio = audio_last_duration * _audio_timebase_expr;
@@ -754,27 +756,11 @@ std::shared_ptr<const SegmentItem> DashPacketizer::GetSegmentData(const ov::Stri
 			return _audio_init_file;
 
 		case DashFileType::VideoSegment: {
-			std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-			auto item = _video_segment_map.find(file_name);
-			if (item != _video_segment_map.end())
-			{
-				return item->second;
-			}
-
-			return nullptr;
+			return _video_segment_ring.Find(file_name);
 		}
 
 		case DashFileType::AudioSegment: {
-			std::unique_lock<std::mutex> lock(_audio_segment_mutex);
-
-			auto item = _audio_segment_map.find(file_name);
-			if (item != _audio_segment_map.end())
-			{
-				return item->second;
-			}
-
-			return nullptr;
+			return _audio_segment_ring.Find(file_name);
 		}
 
 		default:
@@ -785,63 +771,14 @@ std::shared_ptr<const SegmentItem> DashPacketizer::GetSegmentData(const ov::Stri
 	return nullptr;
 }
 
-DashPacketizer::SetResult DashPacketizer::SetSegment(std::map<ov::String, std::shared_ptr<SegmentItem>> &map,
-													 std::deque<std::shared_ptr<SegmentItem>> &queue,
-													 const ov::String &file_name,
-													 std::shared_ptr<SegmentItem> segment,
-													 uint32_t max_segment_count)
+void DashPacketizer::SetSegment(SegmentRing &segment_ring, const std::shared_ptr<SegmentItem> &segment)
 {
-	static_assert(std::is_reference<decltype(segment)>::value == false, "\"segment\" must be not a reference type - because the shared_ptr is swapped below, it can cause other side-effects");
-
-	auto item = map.find(file_name);
-	SetResult result = SetResult::Failed;
-
-	if (item == map.end())
-	{
-		// There is no duplicated segment
-		queue.push_back(segment);
-
-		if (queue.size() > max_segment_count)
-		{
-			size_t erase_count = queue.size() - max_segment_count;
-
-			auto start = queue.begin();
-			auto end = queue.begin() + erase_count;
-
-			// Remove items with in [0, erase_count)
-			std::for_each(start, end, [&map](const std::shared_ptr<SegmentItem> &segment) -> void {
-				map.erase(segment->file_name);
-			});
-			queue.erase(queue.begin(), queue.begin() + erase_count);
-		}
-
-		result = SetResult::New;
-	}
-	else
+	if (segment_ring.Append(segment))
 	{
-		logaw("%s already exists - This is an abnormal situation, and DASH may not work properly", file_name.CStr());
-
-		map.erase(item);
-
-		for (auto segment_item = queue.begin(); segment_item != queue.end(); ++segment_item)
-		{
-			auto &old_segment = *segment_item;
-
-			if (old_segment->file_name == file_name)
-			{
-				old_segment.swap(segment);
-				result = SetResult::Replaced;
-			}
-		}
-
-		OV_ASSERT2(result != SetResult::Failed);
+		logaw("%s already exists - This is an abnormal situation, and DASH may not work properly", segment->file_name.CStr());
 	}
 
-	map[file_name] = segment;
-
 	DumpSegmentToFile(segment);
-
-	return result;
 }
 
 bool DashPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int64_t timestamp_in_ms, int64_t duration, int64_t duration_in_ms, const std::shared_ptr<const ov::Data> &data)
@@ -851,10 +788,8 @@ bool DashPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int
 	switch (file_type)
 	{
 		case DashFileType::VideoSegment: {
-			std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
 			auto segment = std::make_shared<SegmentItem>(SegmentDataType::Video, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data);
-			SetSegment(_video_segment_map, _video_segment_queue, file_name, segment, _segment_save_count);
+			SetSegment(_video_segment_ring, segment);
 			_video_segment_count++;
 
 			logad("Video segment is added, file: %s, pts: %" PRId64 "ms, duration: %" PRIu64 "ms, data size: %zubytes", file_name.CStr(), timestamp_in_ms, duration_in_ms, data->GetLength());
@@ -863,10 +798,8 @@ bool DashPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int
 		}
 
 		case DashFileType::AudioSegment: {
-			std::unique_lock<std::mutex> lock(_audio_segment_mutex);
-
 			auto segment = std::make_shared<SegmentItem>(SegmentDataType::Audio, _sequence_number++, file_name, timestamp, timestamp_in_ms, duration, duration_in_ms, data);
-			SetSegment(_audio_segment_map, _audio_segment_queue, file_name, segment, _segment_save_count);
+			SetSegment(_audio_segment_ring, segment);
 			_audio_segment_count++;
 
 			logad("Audio segment is added, file: %s, pts: %" PRId64 "ms, duration: %" PRIu64 "ms, data size: %zubytes", file_name.CStr(), timestamp_in_ms, duration_in_ms, data->GetLength());
@@ -901,7 +834,7 @@ void DashPacketizer::SetReadyForStreaming() noexcept
 	Packetizer::SetReadyForStreaming();
 }
 
-bool DashPacketizer::GetPlayList(ov::String &play_list)
+bool DashPacketizer::GetPlayList(std::shared_ptr<const PlayListItem> &play_list)
 {
 	if (IsReadyForStreaming() == false)
 	{
@@ -909,9 +842,21 @@ bool DashPacketizer::GetPlayList(ov::String &play_list)
 		return false;
 	}
 
+	auto play_list_template = std::atomic_load(&_play_list);
+
+	if (play_list_template == nullptr)
+	{
+		return false;
+	}
+
 	ov::String current_time = MakeUtcMillisecond();
+	ov::String play_list_format(play_list_template->data->GetDataAs<char>(), play_list_template->data->GetLength());
 
-	play_list = ov::String::FormatString(_play_list.CStr(), current_time.CStr());
+	// UTCTiming is different for each request, so it cannot be validated by ETag
+	play_list = std::make_shared<PlayListItem>(
+		play_list_template->version,
+		ov::String::FormatString(play_list_format.CStr(), current_time.CStr()).ToData(false),
+		"");
 
 	return true;
 }
@@ -61,18 +61,11 @@ public:
 	std::shared_ptr<const SegmentItem> GetSegmentData(const ov::String &file_name) const override;
 	bool SetSegmentData(ov::String file_name, int64_t timestamp, int64_t timestamp_in_ms, int64_t duration, int64_t duration_in_ms, const std::shared_ptr<const ov::Data> &data);
 
-	bool GetPlayList(ov::String &play_list) override;
+	bool GetPlayList(std::shared_ptr<const PlayListItem> &play_list) override;
 
 protected:
 	using DataCallback = std::function<void(const std::shared_ptr<const SampleData> &data, bool new_segment_written)>;
 
-	enum class SetResult
-	{
-		Failed,
-		New,
-		Replaced
-	};
-
 	void SetVideoTrack(const std::shared_ptr<MediaTrack> &video_track);
 	void SetAudioTrack(const std::shared_ptr<MediaTrack> &audio_track);
 
@@ -89,11 +82,7 @@ protected:
 
 	virtual bool UpdatePlayList();
 
-	SetResult SetSegment(std::map<ov::String, std::shared_ptr<SegmentItem>> &map,
-						 std::deque<std::shared_ptr<SegmentItem>> &queue,
-						 const ov::String &file_name,
-						 std::shared_ptr<SegmentItem> segment,
-						 uint32_t max_segment_count);
+	void SetSegment(SegmentRing &segment_ring, const std::shared_ptr<SegmentItem> &segment);
 
 	void SetReadyForStreaming() noexcept override;
 
@@ -130,14 +119,6 @@ protected:
 	std::shared_ptr<SegmentItem> _video_init_file = nullptr;
 	std::shared_ptr<SegmentItem> _audio_init_file = nullptr;
 
-	// Key: filename
-	std::map<ov::String, std::shared_ptr<SegmentItem>> _video_segment_map;
-	std::deque<std::shared_ptr<SegmentItem>> _video_segment_queue;
-
-	// Key: filename
-	std::map<ov::String, std::shared_ptr<SegmentItem>> _audio_segment_map;
-	std::deque<std::shared_ptr<SegmentItem>> _audio_segment_queue;
-
 	// Since the m4s segment cannot be split exactly to the desired duration, an error is inevitable.
 	// As this error results in an incorrect segment index, use the delta to correct the error.
 	//
@@ -36,7 +36,7 @@ bool DashPublisher::Start()
 		return true;
 	}
 
-	return SegmentPublisher::Start(dash_config.GetPort(), dash_config.GetTlsPort(),
+	return SegmentPublisher::Start(dash_config,
 								   std::make_shared<DashStreamServer>());
 }
 
@@ -37,7 +37,7 @@ bool DashStreamPacketizer::AppendAudioData(const std::shared_ptr<MediaPacket> &d
 	return _packetizer->AppendAudioFrame(data);
 }
 
-bool DashStreamPacketizer::GetPlayList(ov::String &play_list)
+bool DashStreamPacketizer::GetPlayList(std::shared_ptr<const PlayListItem> &play_list)
 {
 	return _packetizer->GetPlayList(play_list);
 }
@@ -42,7 +42,7 @@ HttpConnection DashStreamServer::ProcessPlayListRequest(const std::shared_ptr<Ht
 {
 	auto response = client->GetResponse();
 
-	ov::String play_list;
+	std::shared_ptr<const PlayListItem> play_list;
 
 	auto item = std::find_if(_observers.begin(), _observers.end(),
 							 [client, request_info, &play_list](std::shared_ptr<SegmentStreamObserver> &observer) -> bool {
@@ -58,7 +58,7 @@ HttpConnection DashStreamServer::ProcessPlayListRequest(const std::shared_ptr<Ht
 		return HttpConnection::Closed;
 	}
 
-	if (response->GetStatusCode() != HttpStatusCode::OK || play_list.IsEmpty())
+	if (response->GetStatusCode() != HttpStatusCode::OK || (play_list == nullptr) || (play_list->data->GetLength() == 0))
 	{
 		response->Response();
 		return HttpConnection::Closed;
@@ -66,12 +66,8 @@ HttpConnection DashStreamServer::ProcessPlayListRequest(const std::shared_ptr<Ht
 
 	// Set HTTP header
 	response->SetHeader("Content-Type", "application/dash+xml");
-	response->SetHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-	response->SetHeader("Pragma", "no-cache");
-	response->SetHeader("Expires", "0");
 
-	response->AppendString(play_list);
-	auto sent_bytes = response->Response();
+	auto sent_bytes = ResponsePlayList(client, play_list);
 
 	IncreaseBytesOut(client, sent_bytes);
 
@@ -102,7 +98,15 @@ HttpConnection DashStreamServer::ProcessSegmentRequest(const std::shared_ptr<Htt
 
 	// Set HTTP header
 	response->SetHeader("Content-Type", (segment->type == SegmentDataType::Video) ? "video/mp4" : "audio/mp4");
-	response->AppendData(segment->data);
+	if (segment->file != nullptr)
+	{
+		// A segment in the DVR window - sent from the file with sendfile()
+		response->AppendFile(segment->file);
+	}
+	else
+	{
+		response->AppendData(segment->data);
+	}
 	auto sent_bytes = response->Response();
 
 	IncreaseBytesOut(client, sent_bytes);
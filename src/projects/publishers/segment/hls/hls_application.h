@@ -31,4 +31,9 @@ private:
 
 	int _segment_count;
 	int _segment_duration;
+	// Unit: bytes
+	size_t _memory_budget = 0;
+	ov::String _dvr_directory;
+	// Unit: milliseconds (0: DVR is disabled)
+	int64_t _dvr_duration_in_ms = 0LL;
 };
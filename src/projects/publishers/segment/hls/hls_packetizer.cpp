@@ -9,7 +9,7 @@
 #include "hls_packetizer.h"
 
 #include <base/ovlibrary/ovlibrary.h>
-#include <modules/segment_writer/writer.h>
+#include <modules/mpegts/mpegts_packetizer.h>
 #include <publishers/segment/segment_stream/packetizer/packetizer_define.h>
 
 #include <algorithm>
@@ -26,9 +26,7 @@ HlsPacketizer::HlsPacketizer(const ov::String &app_name, const ov::String &strea
 	: Packetizer(app_name, stream_name,
 				 segment_count, segment_duration,
 				 video_track, audio_track,
-				 chunked_transfer),
-
-	  _ts_writer(Writer::Type::MpegTs)
+				 chunked_transfer)
 {
 	_video_enable = false;
 	_audio_enable = false;
@@ -274,7 +272,8 @@ bool HlsPacketizer::WriteSegment(int64_t timestamp, int64_t timestamp_in_ms, int
 
 	UpdatePlayList();
 
-	if (_ts_writer.Prepare() == false)
+	// Reuse the buffer of a segment which is removed from the ring
+	if (_ts_writer.Prepare(_video_segment_ring.GetFreeBuffer()) == false)
 	{
 		logae("Could not prepare ts writer");
 		return false;
@@ -307,9 +306,12 @@ bool HlsPacketizer::UpdatePlayList()
 		}
 	}
 
+	// The sequence number of the first segment in the playlist (RFC 8216 - 4.3.3.2), which is important for the DVR window
+	auto media_sequence = segment_datas.empty() ? static_cast<int>(_sequence_number - 1) : segment_datas.front()->sequence_number;
+
 	play_list_stream << "#EXTM3U\r\n"
 					 << "#EXT-X-VERSION:3\r\n"
-					 << "#EXT-X-MEDIA-SEQUENCE:" << (_sequence_number - 1) << "\r\n"
+					 << "#EXT-X-MEDIA-SEQUENCE:" << media_sequence << "\r\n"
 					 << "#EXT-X-ALLOW-CACHE:NO\r\n"
 					 << "#EXT-X-TARGETDURATION:" << std::fixed << std::setprecision(0) << (max_duration_in_ms / 1000) << "\r\n"
 					 << m3u8_play_list.str();
@@ -330,6 +332,9 @@ bool HlsPacketizer::UpdatePlayList()
 
 			logas("A-V Sync: %lldms (A: %lldms, V: %lldms)", delta_in_ms, audio_pts_in_ms, video_pts_in_ms);
 		}
+
+		logas("Segment memory: %zu bytes in %zu segments (application: %zu bytes)",
+			  GetSegmentBytes(), _video_segment_ring.GetCount(), SegmentRing::GetBytesOfApplication(_app_name));
 	}
 
 	return true;
@@ -342,20 +347,7 @@ std::shared_ptr<const SegmentItem> HlsPacketizer::GetSegmentData(const ov::Strin
 		return nullptr;
 	}
 
-	// video segment mutex
-	std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-	auto item = std::find_if(_video_segments.begin(),
-							 _video_segments.end(), [&](std::shared_ptr<SegmentItem> const &value) -> bool {
-								 return value != nullptr ? value->file_name == file_name : false;
-							 });
-
-	if (item == _video_segments.end())
-	{
-		return nullptr;
-	}
-
-	return (*item);
+	return _video_segment_ring.Find(file_name);
 }
 
 bool HlsPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int64_t timestamp_in_ms, int64_t duration, int64_t duration_in_ms, const std::shared_ptr<const ov::Data> &data)
@@ -370,15 +362,7 @@ bool HlsPacketizer::SetSegmentData(ov::String file_name, int64_t timestamp, int6
 		duration_in_ms,
 		data);
 
-	// video segment mutex
-	std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-	_video_segments[_current_video_index++] = segment_data;
-
-	if (_segment_save_count <= _current_video_index)
-	{
-		_current_video_index = 0;
-	}
+	_video_segment_ring.Append(segment_data);
 
 	logad("TS segment is added, file: %s, pts: %" PRId64 "ms, duration: %" PRIu64 "ms, data size: %zubytes", file_name.CStr(), timestamp_in_ms, duration_in_ms, data->GetLength());
 
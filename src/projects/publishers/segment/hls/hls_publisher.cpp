@@ -39,7 +39,7 @@ bool HlsPublisher::Start()
 		return true;
 	}
 
-	return SegmentPublisher::Start(hls_config.GetPort(), hls_config.GetTlsPort(),
+	return SegmentPublisher::Start(hls_config,
 								   std::make_shared<HlsStreamServer>());
 }
 
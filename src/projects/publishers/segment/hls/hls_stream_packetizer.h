@@ -35,6 +35,6 @@ public:
 		return false;
 	}
 
-	bool GetPlayList(ov::String &play_list) override;
+	bool GetPlayList(std::shared_ptr<const PlayListItem> &play_list) override;
 	std::shared_ptr<const SegmentItem> GetSegmentData(const ov::String &file_name) const override;
 };
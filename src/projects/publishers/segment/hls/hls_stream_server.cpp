@@ -37,7 +37,7 @@ HttpConnection HlsStreamServer::ProcessPlayListRequest(const std::shared_ptr<Htt
 {
 	auto response = client->GetResponse();
 
-	ov::String play_list;
+	std::shared_ptr<const PlayListItem> play_list;
 
 	auto item = std::find_if(_observers.begin(), _observers.end(),
 							 [client, request_info, &play_list](std::shared_ptr<SegmentStreamObserver> &observer) -> bool {
@@ -53,7 +53,7 @@ HttpConnection HlsStreamServer::ProcessPlayListRequest(const std::shared_ptr<Htt
 		return HttpConnection::Closed;
 	}
 
-	if (response->GetStatusCode() != HttpStatusCode::OK || play_list.IsEmpty())
+	if (response->GetStatusCode() != HttpStatusCode::OK || (play_list == nullptr) || (play_list->data->GetLength() == 0))
 	{
 		logte("Could not find a %s playlist for [%s/%s], %s : %d", GetPublisherName(), request_info.vhost_app_name.CStr(), request_info.stream_name.CStr(), request_info.file_name.CStr(), response->GetStatusCode());
 		response->Response();
@@ -62,12 +62,8 @@ HttpConnection HlsStreamServer::ProcessPlayListRequest(const std::shared_ptr<Htt
 
 	// Set HTTP header
 	response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
-	response->SetHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-	response->SetHeader("Pragma", "no-cache");
-	response->SetHeader("Expires", "0");
 
-	response->AppendString(play_list);
-	auto sent_bytes = response->Response();
+	auto sent_bytes = ResponsePlayList(client, play_list);
 
 	IncreaseBytesOut(client, sent_bytes);
 
@@ -98,7 +94,15 @@ HttpConnection HlsStreamServer::ProcessSegmentRequest(const std::shared_ptr<Http
 
 	// Set HTTP header
 	response->SetHeader("Content-Type", "video/MP2T");
-	response->AppendData(segment->data);
+	if (segment->file != nullptr)
+	{
+		// A segment in the DVR window - sent from the file with sendfile()
+		response->AppendFile(segment->file);
+	}
+	else
+	{
+		response->AppendData(segment->data);
+	}
 	auto sent_bytes = response->Response();
 
 	IncreaseBytesOut(client, sent_bytes);
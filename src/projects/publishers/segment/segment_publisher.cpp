@@ -25,13 +25,13 @@ SegmentPublisher::~SegmentPublisher()
 	logtd("Publisher has been destroyed");
 }
 
-bool SegmentPublisher::Start(const cfg::cmn::SingularPort &port_config, const cfg::cmn::SingularPort &tls_port_config, const std::shared_ptr<SegmentStreamServer> &stream_server)
+bool SegmentPublisher::Start(const cfg::bind::pub::Publisher<cfg::cmn::SingularPort> &publisher_config, const std::shared_ptr<SegmentStreamServer> &stream_server)
 {
 	auto server_config = GetServerConfig();
 	auto ip = server_config.GetIp();
 
-	auto port = port_config.GetPort();
-	auto tls_port = tls_port_config.GetPort();
+	auto port = publisher_config.GetPort().GetPort();
+	auto tls_port = publisher_config.GetTlsPort().GetPort();
 	bool has_port = (port != 0);
 	bool has_tls_port = (tls_port != 0);
 
@@ -52,6 +52,9 @@ bool SegmentPublisher::Start(const cfg::cmn::SingularPort &port_config, const cf
 		return false;
 	}
 
+	stream_server->SetSendQueueSize(publisher_config.GetSendQueueSize());
+	stream_server->SetKernelTlsEnabled(publisher_config.IsKernelTlsEnabled());
+
 	_stream_server = stream_server;
 
 	logti("%s is listening on %s%s%s%s...",
@@ -79,7 +82,7 @@ bool SegmentPublisher::Stop()
 
 bool SegmentPublisher::OnPlayListRequest(const std::shared_ptr<HttpClient> &client,
 										 const SegmentStreamRequestInfo &request_info,
-										 ov::String &play_list)
+										 std::shared_ptr<const PlayListItem> &play_list)
 {
 	auto request = client->GetRequest();
 	auto uri = request->GetUri();
@@ -169,7 +172,7 @@ bool SegmentPublisher::OnSegmentRequest(const std::shared_ptr<HttpClient> &clien
 			logtw("Could not find a segment for %s [%s/%s, %s]", GetPublisherName(), vhost_app_name.CStr(), stream_name.CStr(), file_name.CStr());
 			return false;
 		}
-		else if (segment->data == nullptr)
+		else if ((segment->data == nullptr) && (segment->file == nullptr))
 		{
 			logtw("Could not obtain segment data from %s for [%p, %s/%s, %s]", GetPublisherName(), segment.get(), vhost_app_name.CStr(), stream_name.CStr(), file_name.CStr());
 			return false;
@@ -347,6 +350,8 @@ void SegmentPublisher::RequestTableUpdateThread()
 
 		playlist_table_lock.unlock();
 
+		_stream_server->DisconnectIdleClients();
+
 		sleep(3);
 	}
 }
@@ -202,7 +202,7 @@ protected:
 	SegmentPublisher(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
 	~SegmentPublisher() override;
 
-	bool Start(const cfg::cmn::SingularPort &port_config, const cfg::cmn::SingularPort &tls_port_config, const std::shared_ptr<SegmentStreamServer> &stream_server);
+	bool Start(const cfg::bind::pub::Publisher<cfg::cmn::SingularPort> &publisher_config, const std::shared_ptr<SegmentStreamServer> &stream_server);
 	virtual bool Start() = 0;
 
 	bool HandleSignedX(const info::VHostAppName &vhost_app_name, const ov::String &stream_name, 
@@ -214,7 +214,7 @@ protected:
 	//--------------------------------------------------------------------
 	bool OnPlayListRequest(const std::shared_ptr<HttpClient> &client,
 						   const SegmentStreamRequestInfo &request_info,
-						   ov::String &play_list) override;
+						   std::shared_ptr<const PlayListItem> &play_list) override;
 
 	bool OnSegmentRequest(const std::shared_ptr<HttpClient> &client,
 						  const SegmentStreamRequestInfo &request_info,
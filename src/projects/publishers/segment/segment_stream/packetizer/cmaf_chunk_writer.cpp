@@ -100,45 +100,39 @@ uint64_t CmafChunkWriter::GetSegmentDuration() const
 
 int CmafChunkWriter::WriteMoofBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data)
 {
-	auto data = std::make_shared<ov::Data>(DEFAULT_CHUNK_HEADER_SIZE);
+	size_t data_offset_position = 0;
+	auto box_offset = BeginBox("moof", data_stream);
 
-	WriteMfhdBox(data);
-	WriteTrafBox(data, sample_data);
+	WriteMfhdBox(data_stream);
+	WriteTrafBox(data_stream, sample_data, data_offset_position);
 
-	WriteBoxData("moof", data, data_stream);
+	EndBox(box_offset, data_stream);
 
-	// trun data offset value change
-	int position = (_media_type == M4sMediaType::Video) ? data_stream->GetLength() - 16 - 4 : data_stream->GetLength() - 8 - 4;
-
-	if (position < 0)
-	{
-		return -1;
-	}
-
-	ByteWriter<uint32_t>::WriteBigEndian(data_stream->GetWritableDataAs<uint8_t>() + position, data_stream->GetLength() + 8);
+	// trun data offset value change (from the moof to the first sample of mdat)
+	PatchUint32(data_offset_position, data_stream->GetLength() - box_offset + MP4_BOX_HEADER_SIZE, data_stream);
 
 	return data_stream->GetLength();
 }
 
 int CmafChunkWriter::WriteMfhdBox(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mfhd", 0, 0, data_stream);
 
-	WriteUint32(_sequence_number, data);
+	WriteUint32(_sequence_number, data_stream);
 
-	return WriteBoxData("mfhd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int CmafChunkWriter::WriteTrafBox(std::shared_ptr<ov::Data> &data_stream,
-								  const std::shared_ptr<const SampleData> &sample_data)
+								  const std::shared_ptr<const SampleData> &sample_data, size_t &data_offset_position)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("traf", data_stream);
 
-	WriteTfhdBox(data);
-	WriteTfdtBox(data, sample_data->pts);
-	WriteTrunBox(data, sample_data);
+	WriteTfhdBox(data_stream);
+	WriteTfdtBox(data_stream, sample_data->pts);
+	WriteTrunBox(data_stream, sample_data, data_offset_position);
 
-	return WriteBoxData("traf", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 #define TFHD_FLAG_BASE_DATA_OFFSET_PRESENT (0x00001)
@@ -151,21 +145,21 @@ int CmafChunkWriter::WriteTrafBox(std::shared_ptr<ov::Data> &data_stream,
 
 int CmafChunkWriter::WriteTfhdBox(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
 	uint32_t flag = TFHD_FLAG_DEFAULT_BASE_IS_MOOF;
+	auto box_offset = BeginBox("tfhd", 0, flag, data_stream);
 
-	WriteUint32(_track_id, data);  // track id
+	WriteUint32(_track_id, data_stream);  // track id
 
-	return WriteBoxData("tfhd", 0, flag, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int CmafChunkWriter::WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream, int64_t timestamp)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("tfdt", 1, 0, data_stream);
 
-	WriteUint64(timestamp, data);  // Base media decode time
+	WriteUint64(timestamp, data_stream);  // Base media decode time
 
-	return WriteBoxData("tfdt", 1, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 #define TRUN_FLAG_DATA_OFFSET_PRESENT (0x0001)
@@ -176,9 +170,8 @@ int CmafChunkWriter::WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream, int64_
 #define TRUN_FLAG_SAMPLE_COMPOSITION_TIME_OFFSET_PRESENT (0x0800)
 
 int CmafChunkWriter::WriteTrunBox(std::shared_ptr<ov::Data> &data_stream,
-								  const std::shared_ptr<const SampleData> &sample_data)
+								  const std::shared_ptr<const SampleData> &sample_data, size_t &data_offset_position)
 {
-	auto data = std::make_shared<ov::Data>();
 	uint32_t flag = 0;
 
 	if (M4sMediaType::Video == _media_type)
@@ -191,23 +184,26 @@ int CmafChunkWriter::WriteTrunBox(std::shared_ptr<ov::Data> &data_stream,
 		flag = TRUN_FLAG_DATA_OFFSET_PRESENT | TRUN_FLAG_SAMPLE_DURATION_PRESENT | TRUN_FLAG_SAMPLE_SIZE_PRESENT;
 	}
 
-	WriteUint32(1, data);			// Sample Item Count;
-	WriteUint32(0x11111111, data);	// Data offset - temp 0 setting
+	auto box_offset = BeginBox("trun", 0, flag, data_stream);
+
+	WriteUint32(1, data_stream);  // Sample Item Count;
+	data_offset_position = data_stream->GetLength();
+	WriteUint32(0, data_stream);  // Data offset - patched after the moof is written
 
-	WriteUint32(sample_data->duration, data);  // duration
+	WriteUint32(sample_data->duration, data_stream);  // duration
 
 	if (_media_type == M4sMediaType::Video)
 	{
-		WriteUint32(sample_data->data->GetLength() + 4, data);	// size + sample
-		WriteUint32(sample_data->flag, data);					// flag
-		WriteUint32(sample_data->GetCts(), data);				// cts
+		WriteUint32(sample_data->data->GetLength() + 4, data_stream);  // size + sample
+		WriteUint32(sample_data->flag, data_stream);				   // flag
+		WriteUint32(sample_data->GetCts(), data_stream);			   // cts
 	}
 	else if (_media_type == M4sMediaType::Audio)
 	{
-		WriteUint32(sample_data->data->GetLength(), data);	// sample
+		WriteUint32(sample_data->data->GetLength(), data_stream);  // sample
 	}
 
-	return WriteBoxData("trun", 0, flag, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int CmafChunkWriter::WriteMdatBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<ov::Data> &frame_data)
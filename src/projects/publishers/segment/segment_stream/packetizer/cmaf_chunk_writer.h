@@ -54,10 +54,11 @@ public:
 protected:
 	int WriteMoofBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data);
 	int WriteMfhdBox(std::shared_ptr<ov::Data> &data_stream);
-	int WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data);
+	// data_offset_position: the position of data_offset in the trun box, which is written after the size of moof is known
+	int WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data, size_t &data_offset_position);
 	int WriteTfhdBox(std::shared_ptr<ov::Data> &data_stream);
 	int WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream, int64_t timestamp);
-	int WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data);
+	int WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<const SampleData> &sample_data, size_t &data_offset_position);
 
 	int WriteMdatBox(std::shared_ptr<ov::Data> &data_stream, const std::shared_ptr<ov::Data> &frame_data);
 
@@ -83,29 +83,29 @@ const std::shared_ptr<ov::Data> M4sInitWriter::CreateData()
 
 int M4sInitWriter::FtypBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("ftyp", data_stream);
 
-	WriteText("mp42", data);			  // Major brand
-	WriteUint32(0, data);				  // Minor version
-	WriteText("isommp42iso5dash", data);  // Compatible brands // isom(4)mp42(4)iso5(4)dash(4)
+	WriteText("mp42", data_stream);				 // Major brand
+	WriteUint32(0, data_stream);				 // Minor version
+	WriteText("isommp42iso5dash", data_stream);	 // Compatible brands // isom(4)mp42(4)iso5(4)dash(4)
 
-	return WriteBoxData("ftyp", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MoovBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("moov", data_stream);
 
-	MvhdBoxWrite(data);
-	MvexBoxWrite(data);
-	TrakBoxWrite(data);
+	MvhdBoxWrite(data_stream);
+	MvexBoxWrite(data_stream);
+	TrakBoxWrite(data_stream);
 
-	return WriteBoxData("moov", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MvhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mvhd", 0, 0, data_stream);
 
 	// 8.2.2.2 Syntax
 	//
@@ -134,43 +134,43 @@ int M4sInitWriter::MvhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 	uint32_t matrix[9] =
 		{0x00010000, 0, 0, 0, 0x00010000, 0, 0, 0, 0x40000000};
 
-	WriteUint32(0x00000000, data);								   // creation_time
-	WriteUint32(0x00000000, data);								   // modification_time
-	WriteUint32(_main_track->GetTimeBase().GetTimescale(), data);  // timescale
-	WriteUint32(0x00000000, data);								   // duration
-	WriteUint32(0x00010000, data);								   // rate
-	WriteUint16(0x0100, data);									   // volume
-	WriteUint16(0x00000000, data);								   // reserved - bit(16)
+	WriteUint32(0x00000000, data_stream);								  // creation_time
+	WriteUint32(0x00000000, data_stream);								  // modification_time
+	WriteUint32(_main_track->GetTimeBase().GetTimescale(), data_stream);  // timescale
+	WriteUint32(0x00000000, data_stream);								  // duration
+	WriteUint32(0x00010000, data_stream);								  // rate
+	WriteUint16(0x0100, data_stream);									  // volume
+	WriteUint16(0x00000000, data_stream);								  // reserved - bit(16)
 	for (int i = 0; i < 2; i++)									   // reserved - int(32)[0]
 	{
-		WriteUint32(0x00000000, data);
+		WriteUint32(0x00000000, data_stream);
 	}
 	for (int i = 0; i < static_cast<int>(OV_COUNTOF(matrix)); i++)  // matrix
 	{
-		WriteUint32(matrix[i], data);
+		WriteUint32(matrix[i], data_stream);
 	}
 	for (int i = 0; i < 6; i++)  // pre_defined
 	{
-		WriteUint32(0x00000000, data);
+		WriteUint32(0x00000000, data_stream);
 	}
-	WriteUint32(0XFFFFFFFF, data);  // Next Track ID
+	WriteUint32(0XFFFFFFFF, data_stream);  // Next Track ID
 
-	return WriteBoxData("mvhd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::TrakBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("trak", data_stream);
 
-	TkhdBoxWrite(data);
-	MdiaBoxWrite(data);
+	TkhdBoxWrite(data_stream);
+	MdiaBoxWrite(data_stream);
 
-	return WriteBoxData("trak", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::TkhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("tkhd", 0, 7, data_stream);
 	std::vector<uint8_t> metrix = {0, 0x01, 0, 0,
 								   0, 0, 0, 0,
 								   0, 0, 0, 0,
@@ -181,197 +181,197 @@ int M4sInitWriter::TkhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 								   0, 0, 0, 0,
 								   0x40, 0, 0, 0};
 
-	WriteUint32(0, data);		   // Create Time
-	WriteUint32(0, data);		   // Modification Time
-	WriteUint32(_track_id, data);  // Track ID
-	WriteInit(0, 4, data);		   // Reserve(4Byte)
-	WriteUint32(_duration, data);  // Duration
-	WriteInit(0, 8, data);		   // Reserve(8Byte)
-	WriteUint16(0, data);		   // layer
-	WriteUint16(0, data);		   // alternate group
-	WriteUint16(0, data);		   // volume
-	WriteInit(0, 2, data);		   // Reserve(2Byte)
-	WriteData(metrix, data);	   // Matrix
+	WriteUint32(0, data_stream);		  // Create Time
+	WriteUint32(0, data_stream);		  // Modification Time
+	WriteUint32(_track_id, data_stream);  // Track ID
+	WriteInit(0, 4, data_stream);		  // Reserve(4Byte)
+	WriteUint32(_duration, data_stream);  // Duration
+	WriteInit(0, 8, data_stream);		  // Reserve(8Byte)
+	WriteUint16(0, data_stream);		  // layer
+	WriteUint16(0, data_stream);		  // alternate group
+	WriteUint16(0, data_stream);		  // volume
+	WriteInit(0, 2, data_stream);		  // Reserve(2Byte)
+	WriteData(metrix, data_stream);		  // Matrix
 
 	if (_media_type == M4sMediaType::Video)
 	{
-		WriteUint32(_video_track->GetWidth() << 16, data);   // Width
-		WriteUint32(_video_track->GetHeight() << 16, data);  // Height
+		WriteUint32(_video_track->GetWidth() << 16, data_stream);	// Width
+		WriteUint32(_video_track->GetHeight() << 16, data_stream);	// Height
 	}
 	else
 	{
-		WriteUint32(0, data);  // Width
-		WriteUint32(0, data);  // Height
+		WriteUint32(0, data_stream);  // Width
+		WriteUint32(0, data_stream);  // Height
 	}
 
-	return WriteBoxData("tkhd", 0, 7, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MdiaBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mdia", data_stream);
 
-	MdhdBoxWrite(data);
-	HdlrBoxWrite(data);
-	MinfBoxWrite(data);
+	MdhdBoxWrite(data_stream);
+	HdlrBoxWrite(data_stream);
+	MinfBoxWrite(data_stream);
 
-	return WriteBoxData("mdia", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MdhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mdhd", 0, 0, data_stream);
 
-	WriteUint32(0, data);																   // Create Time
-	WriteUint32(0, data);																   // Modification Time
-	WriteUint32(_main_track->GetTimeBase().GetTimescale(), data);						   // Timescale
-	WriteUint32(0, data);																   // Duration
-	WriteUint8((((_language[0] - 0x60) << 2) | (_language[1] - 0x60) >> 3) & 0xFF, data);  // Language 1
-	WriteUint8((((_language[1] - 0x60) << 5) | (_language[2] - 0x60)) & 0xFF, data);	   // Language 2
-	WriteUint16(0, data);																   // Pre Define
+	WriteUint32(0, data_stream);																  // Create Time
+	WriteUint32(0, data_stream);																  // Modification Time
+	WriteUint32(_main_track->GetTimeBase().GetTimescale(), data_stream);						  // Timescale
+	WriteUint32(0, data_stream);																  // Duration
+	WriteUint8((((_language[0] - 0x60) << 2) | (_language[1] - 0x60) >> 3) & 0xFF, data_stream);  // Language 1
+	WriteUint8((((_language[1] - 0x60) << 5) | (_language[2] - 0x60)) & 0xFF, data_stream);		  // Language 2
+	WriteUint16(0, data_stream);																  // Pre Define
 
-	return WriteBoxData("mdhd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::HdlrBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("hdlr", 0, 0, data_stream);
 
-	WriteUint32(0, data);				// Pre Define
-	WriteText(_handler_type, data);		// Handler Type
-	WriteInit(0, 12, data);				// Reserve(12Byte)
-	WriteText(_compressor_name, data);  // Handler Name
-	WriteUint8(0, data);				// null
+	WriteUint32(0, data_stream);			   // Pre Define
+	WriteText(_handler_type, data_stream);	   // Handler Type
+	WriteInit(0, 12, data_stream);			   // Reserve(12Byte)
+	WriteText(_compressor_name, data_stream);  // Handler Name
+	WriteUint8(0, data_stream);				   // null
 
-	return WriteBoxData("hdlr", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MinfBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("minf", data_stream);
 
 	if (_media_type == M4sMediaType::Video)
 	{
-		VmhdBoxWrite(data);
+		VmhdBoxWrite(data_stream);
 	}
 	else if (_media_type == M4sMediaType::Audio)
 	{
-		SmhdBoxWrite(data);
+		SmhdBoxWrite(data_stream);
 	}
 
-	DinfBoxWrite(data);
-	StblBoxWrite(data);
+	DinfBoxWrite(data_stream);
+	StblBoxWrite(data_stream);
 
-	return WriteBoxData("minf", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::VmhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("vmhd", 0, 1, data_stream);
 
-	WriteUint16(0, data);   // Graphics Mode
-	WriteInit(0, 6, data);  // Op Color
+	WriteUint16(0, data_stream);   // Graphics Mode
+	WriteInit(0, 6, data_stream);  // Op Color
 
-	return WriteBoxData("vmhd", 0, 1, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::SmhdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("smhd", 0, 0, data_stream);
 
-	WriteUint16(0, data);  // Balance
-	WriteUint16(0, data);  // Reserved
+	WriteUint16(0, data_stream);  // Balance
+	WriteUint16(0, data_stream);  // Reserved
 
-	return WriteBoxData("smhd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::DinfBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("dinf", data_stream);
 
-	DrefBoxWrite(data);
+	DrefBoxWrite(data_stream);
 
-	return WriteBoxData("dinf", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::DrefBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("dref", 0, 0, data_stream);
 
-	WriteUint32(1, data);  // child count
-	UrlBoxWrite(data);	 // url child
+	WriteUint32(1, data_stream);  // child count
+	UrlBoxWrite(data_stream);	  // url child
 
-	return WriteBoxData("dref", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::UrlBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	std::shared_ptr<ov::Data> data = nullptr;
+	auto box_offset = BeginBox("url ", 0, 1, data_stream);
 
-	return WriteBoxData("url ", 0, 1, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::StblBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stbl", data_stream);
 
-	StsdBoxWrite(data);
-	SttsBoxWrite(data);
-	StscBoxWrite(data);
-	StszBoxWrite(data);
-	StcoBoxWrite(data);
+	StsdBoxWrite(data_stream);
+	SttsBoxWrite(data_stream);
+	StscBoxWrite(data_stream);
+	StszBoxWrite(data_stream);
+	StcoBoxWrite(data_stream);
 
-	return WriteBoxData("stbl", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::StsdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stsd", 0, 0, data_stream);
 
-	WriteUint32(1, data);  // Child Count
+	WriteUint32(1, data_stream);  // Child Count
 
 	if (_media_type == M4sMediaType::Video)
 	{
-		Avc1BoxWrite(data);
+		Avc1BoxWrite(data_stream);
 	}
 	if (_media_type == M4sMediaType::Audio)
 	{
-		Mp4aBoxWrite(data);
+		Mp4aBoxWrite(data_stream);
 	}
 
-	return WriteBoxData("stsd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::Avc1BoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("avc1", 0, 0, data_stream);
 
 	OV_ASSERT2(_video_track != nullptr);
 
-	WriteUint32(1, data);									  // Child Count
-	WriteUint16(0, data);									  // Pre Define
-	WriteUint16(0, data);									  // Reserve(2Byte)
-	WriteInit(0, 12, data);									  // Pre Define(12byte)
-	WriteUint16((uint16_t)_video_track->GetWidth(), data);	// Width
-	WriteUint16((uint16_t)_video_track->GetHeight(), data);   // Height
-	WriteUint32(0x00480000, data);							  // Horiz Resolution
-	WriteUint32(0x00480000, data);							  // Vert Resolution
-	WriteUint32(0, data);									  // Reserve(4Byte)
-	WriteUint16(1, data);									  // Frame Count
-	WriteUint8((uint8_t)_compressor_name.GetLength(), data);  // Compressor Name Size(Max 31Byte)
-	WriteText(_compressor_name, data);						  // Compressor Name
-	WriteInit(0, 31 - _compressor_name.GetLength(), data);	// Padding(31 - Compressor Name Size)
-	WriteUint16(0x0018, data);								  // Depth
-	WriteUint16(0xFFFF, data);								  // Pre Define
-
-	AvccBoxWrite(data);
-
-	return WriteBoxData("avc1", 0, 0, data, data_stream);
+	WriteUint32(1, data_stream);									 // Child Count
+	WriteUint16(0, data_stream);									 // Pre Define
+	WriteUint16(0, data_stream);									 // Reserve(2Byte)
+	WriteInit(0, 12, data_stream);									 // Pre Define(12byte)
+	WriteUint16((uint16_t)_video_track->GetWidth(), data_stream);	 // Width
+	WriteUint16((uint16_t)_video_track->GetHeight(), data_stream);	 // Height
+	WriteUint32(0x00480000, data_stream);							 // Horiz Resolution
+	WriteUint32(0x00480000, data_stream);							 // Vert Resolution
+	WriteUint32(0, data_stream);									 // Reserve(4Byte)
+	WriteUint16(1, data_stream);									 // Frame Count
+	WriteUint8((uint8_t)_compressor_name.GetLength(), data_stream);	 // Compressor Name Size(Max 31Byte)
+	WriteText(_compressor_name, data_stream);						 // Compressor Name
+	WriteInit(0, 31 - _compressor_name.GetLength(), data_stream);	 // Padding(31 - Compressor Name Size)
+	WriteUint16(0x0018, data_stream);								 // Depth
+	WriteUint16(0xFFFF, data_stream);								 // Pre Define
+
+	AvccBoxWrite(data_stream);
+
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::AvccBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("avcC", data_stream);
 
 	uint8_t avc_profile = 0;
 	uint8_t avc_profile_compatibility = 0;
@@ -387,60 +387,60 @@ int M4sInitWriter::AvccBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 		avc_level = buffer[3];
 	}
 
-	WriteUint8(1, data);										  // Configuration Version
-	WriteUint8(avc_profile, data);								  // Profile
-	WriteUint8(avc_profile_compatibility, data);				  // Profile Compatibillity
-	WriteUint8(avc_level, data);								  // Level
-	WriteUint8((uint8_t)((avc_nal_unit_size - 1) | 0xFC), data);  // Nal Unit Size
-	WriteUint8(1 | 0xE0, data);									  // SPS Count
-	WriteUint16(_avc_sps->GetLength(), data);					  // SPS Size
-	WriteData(_avc_sps, data);									  // SPS
-	WriteUint8(1, data);										  // PPS Count
-	WriteUint16(_avc_pps->GetLength(), data);					  // PPS Size
-	WriteData(_avc_pps, data);									  // PPS
-
-	return WriteBoxData("avcC", data, data_stream);
+	WriteUint8(1, data_stream);											 // Configuration Version
+	WriteUint8(avc_profile, data_stream);								 // Profile
+	WriteUint8(avc_profile_compatibility, data_stream);					 // Profile Compatibillity
+	WriteUint8(avc_level, data_stream);									 // Level
+	WriteUint8((uint8_t)((avc_nal_unit_size - 1) | 0xFC), data_stream);	 // Nal Unit Size
+	WriteUint8(1 | 0xE0, data_stream);									 // SPS Count
+	WriteUint16(_avc_sps->GetLength(), data_stream);					 // SPS Size
+	WriteData(_avc_sps, data_stream);									 // SPS
+	WriteUint8(1, data_stream);											 // PPS Count
+	WriteUint16(_avc_pps->GetLength(), data_stream);					 // PPS Size
+	WriteData(_avc_pps, data_stream);									 // PPS
+
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::Mp4aBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mp4a", 0, 0, data_stream);
 
 	OV_ASSERT2(_audio_track != nullptr);
 
-	WriteUint32(1, data);											   // Child Count
-	WriteUint16(0, data);											   // QT version
-	WriteUint16(0, data);											   // QT revision
-	WriteUint32(0, data);											   // QT vendor
-	WriteUint16(_audio_track->GetChannel().GetCounts(), data);		   // channel count
-	WriteUint16(_audio_track->GetSample().GetSampleSize() * 8, data);  // sample size
-	WriteUint16(0, data);											   // QT compression ID
-	WriteUint16(0, data);											   // QT packet size
-	WriteUint32(_audio_track->GetSampleRate() << 16, data);			   // sample rate
+	WriteUint32(1, data_stream);											  // Child Count
+	WriteUint16(0, data_stream);											  // QT version
+	WriteUint16(0, data_stream);											  // QT revision
+	WriteUint32(0, data_stream);											  // QT vendor
+	WriteUint16(_audio_track->GetChannel().GetCounts(), data_stream);		  // channel count
+	WriteUint16(_audio_track->GetSample().GetSampleSize() * 8, data_stream);  // sample size
+	WriteUint16(0, data_stream);											  // QT compression ID
+	WriteUint16(0, data_stream);											  // QT packet size
+	WriteUint32(_audio_track->GetSampleRate() << 16, data_stream);			  // sample rate
 
-	EsdsBoxWrite(data);
+	EsdsBoxWrite(data_stream);
 
-	return WriteBoxData("mp4a", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::EsdsBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("esds", 0, 0, data_stream);
 
 	// es id(3)
-	WriteUint8(3, data);	 // tag
-	WriteUint8(0x19, data);  // tag size
-	WriteUint16(0, data);	// es id ??? track id
-	WriteUint8(0, data);	 // flag
+	WriteUint8(3, data_stream);		// tag
+	WriteUint8(0x19, data_stream);	// tag size
+	WriteUint16(0, data_stream);	// es id ??? track id
+	WriteUint8(0, data_stream);		// flag
 
 	// decoder config(13)
-	WriteUint8(4, data);	 // tag
-	WriteUint8(0x11, data);  // tag size
-	WriteUint8(0x40, data);  // Object type indication  - MPEG-4 audio (0X40)
-	WriteUint8(0x15, data);  // Stream type( <<2)  / Up Stream ( << 1) / Reserve(0x01)
-	WriteUint24(0, data);	// Buffer Size
-	WriteUint32(0, data);	// MaxBitrate
-	WriteUint32(0, data);	// AverageBitreate
+	WriteUint8(4, data_stream);		// tag
+	WriteUint8(0x11, data_stream);	// tag size
+	WriteUint8(0x40, data_stream);	// Object type indication  - MPEG-4 audio (0X40)
+	WriteUint8(0x15, data_stream);	// Stream type( <<2)  / Up Stream ( << 1) / Reserve(0x01)
+	WriteUint24(0, data_stream);	// Buffer Size
+	WriteUint32(0, data_stream);	// MaxBitrate
+	WriteUint32(0, data_stream);	// AverageBitreate
 
 	// DecoderSpecific info descriptor
 	/*
@@ -463,82 +463,82 @@ int M4sInitWriter::EsdsBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 	bit_writer.Write(4, _audio_sample_index);					  // frequency index
 	bit_writer.Write(4, _audio_track->GetChannel().GetCounts());  // channel configuration
 
-	WriteUint8(5, data);  // tag
-	WriteUint8(2, data);  // tag size
+	WriteUint8(5, data_stream);	 // tag
+	WriteUint8(2, data_stream);	 // tag size
 
-	WriteData(bit_writer.GetData(), (int)bit_writer.GetDataSize(), data);  //
+	WriteData(bit_writer.GetData(), (int)bit_writer.GetDataSize(), data_stream);  //
 
 	// sl config(1)
-	WriteUint8(6, data);  // tag
-	WriteUint8(1, data);  // tag size
-	WriteUint8(2, data);  // always 2 refer from mov_write_esds_tag
+	WriteUint8(6, data_stream);	 // tag
+	WriteUint8(1, data_stream);	 // tag size
+	WriteUint8(2, data_stream);	 // always 2 refer from mov_write_esds_tag
 
-	return WriteBoxData("esds", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::SttsBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stts", 0, 0, data_stream);
 
-	WriteUint32(0, data);  // Entry Count
+	WriteUint32(0, data_stream);  // Entry Count
 
-	return WriteBoxData("stts", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::StscBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stsc", 0, 0, data_stream);
 
-	WriteUint32(0, data);  // Entry Count
+	WriteUint32(0, data_stream);  // Entry Count
 
-	return WriteBoxData("stsc", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::StszBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stsz", 0, 0, data_stream);
 
-	WriteUint32(0, data);  // Sample Size
-	WriteUint32(0, data);  // Sample Count
+	WriteUint32(0, data_stream);  // Sample Size
+	WriteUint32(0, data_stream);  // Sample Count
 
-	return WriteBoxData("stsz", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::StcoBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("stco", 0, 0, data_stream);
 
-	WriteUint32(0, data);  // Entry Count
+	WriteUint32(0, data_stream);  // Entry Count
 
-	return WriteBoxData("stco", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MvexBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mvex", data_stream);
 
-	//MehdBoxWrite(data);
-	TrexBoxWrite(data);
+	//MehdBoxWrite(data_stream);
+	TrexBoxWrite(data_stream);
 
-	return WriteBoxData("mvex", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::MehdBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mehd", 0, 0, data_stream);
 
-	return WriteBoxData("mehd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sInitWriter::TrexBoxWrite(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("trex", 0, 0, data_stream);
 
-	WriteUint32(_track_id, data);  // Track ID
-	WriteUint32(1, data);		   // Sample Description Index
-	WriteUint32(1, data);		   // Sample Duration
-	WriteUint32(1, data);		   // Sample Size
-	WriteUint32(0, data);		   // Sample Flags
+	WriteUint32(_track_id, data_stream);  // Track ID
+	WriteUint32(1, data_stream);		  // Sample Description Index
+	WriteUint32(1, data_stream);		  // Sample Duration
+	WriteUint32(1, data_stream);		  // Sample Size
+	WriteUint32(0, data_stream);		  // Sample Flags
 
-	return WriteBoxData("trex", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
@@ -47,44 +47,38 @@ const std::shared_ptr<ov::Data> M4sSegmentWriter::AppendSamples(const std::vecto
 
 int M4sSegmentWriter::WriteMoofBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas)
 {
-	auto data = std::make_shared<ov::Data>(DEFAULT_SEGMENT_HEADER_SIZE);
+	size_t data_offset_position = 0;
+	auto box_offset = BeginBox("moof", data_stream);
 
-	WriteMfhdBox(data);
-	WriteTrafBox(data, sample_datas);
+	WriteMfhdBox(data_stream);
+	WriteTrafBox(data_stream, sample_datas, data_offset_position);
 
-	WriteBoxData("moof", data, data_stream);
+	EndBox(box_offset, data_stream);
 
-	int position = (_media_type == M4sMediaType::Video) ? data_stream->GetLength() - sample_datas.size() * 16 - 4 : data_stream->GetLength() - sample_datas.size() * 8 - 4;
-
-	if (position < 0)
-	{
-		return -1;
-	}
-
-	// trun data offset value change
-	ByteWriter<uint32_t>::WriteBigEndian(data_stream->GetWritableDataAs<uint8_t>() + position, data_stream->GetLength() + 8);
+	// trun data offset value change (from the moof to the first sample of mdat)
+	PatchUint32(data_offset_position, data_stream->GetLength() - box_offset + MP4_BOX_HEADER_SIZE, data_stream);
 
 	return data_stream->GetLength();
 }
 
 int M4sSegmentWriter::WriteMfhdBox(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("mfhd", 0, 0, data_stream);
 
-	WriteUint32(_sequence_number, data);  // Sequence Number
+	WriteUint32(_sequence_number, data_stream);	 // Sequence Number
 
-	return WriteBoxData("mfhd", 0, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
-int M4sSegmentWriter::WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas)
+int M4sSegmentWriter::WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, size_t &data_offset_position)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("traf", data_stream);
 
-	WriteTfhdBox(data);
-	WriteTfdtBox(data);
-	WriteTrunBox(data, sample_datas);
+	WriteTfhdBox(data_stream);
+	WriteTfdtBox(data_stream);
+	WriteTrunBox(data_stream, sample_datas, data_offset_position);
 
-	return WriteBoxData("traf", data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 #define TFHD_FLAG_BASE_DATA_OFFSET_PRESENT (0x00001)
@@ -97,21 +91,21 @@ int M4sSegmentWriter::WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const
 
 int M4sSegmentWriter::WriteTfhdBox(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
 	uint32_t flag = TFHD_FLAG_DEFAULT_BASE_IS_MOOF;
+	auto box_offset = BeginBox("tfhd", 0, flag, data_stream);
 
-	WriteUint32(_track_id, data);  // track id
+	WriteUint32(_track_id, data_stream);  // track id
 
-	return WriteBoxData("tfhd", 0, flag, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sSegmentWriter::WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream)
 {
-	auto data = std::make_shared<ov::Data>();
+	auto box_offset = BeginBox("tfdt", 1, 0, data_stream);
 
-	WriteUint64(_start_timestamp, data);  // Base media decode time
+	WriteUint64(_start_timestamp, data_stream);	 // Base media decode time
 
-	return WriteBoxData("tfdt", 1, 0, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 #define TRUN_FLAG_DATA_OFFSET_PRESENT (0x0001)
@@ -121,9 +115,8 @@ int M4sSegmentWriter::WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream)
 #define TRUN_FLAG_SAMPLE_FLAGS_PRESENT (0x0400)
 #define TRUN_FLAG_SAMPLE_COMPOSITION_TIME_OFFSET_PRESENT (0x0800)
 
-int M4sSegmentWriter::WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas)
+int M4sSegmentWriter::WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, size_t &data_offset_position)
 {
-	auto data = std::make_shared<ov::Data>();
 	uint32_t flag = 0;
 
 	if (M4sMediaType::Video == _media_type)
@@ -136,31 +129,34 @@ int M4sSegmentWriter::WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const
 		flag = TRUN_FLAG_DATA_OFFSET_PRESENT | TRUN_FLAG_SAMPLE_DURATION_PRESENT | TRUN_FLAG_SAMPLE_SIZE_PRESENT;
 	}
 
-	WriteUint32(sample_datas.size(), data);  // Sample Item Count;
-	WriteUint32(0x11111111, data);			 // Data offset - temp 0 setting
+	auto box_offset = BeginBox("trun", 0, flag, data_stream);
+
+	WriteUint32(sample_datas.size(), data_stream);	// Sample Item Count;
+	data_offset_position = data_stream->GetLength();
+	WriteUint32(0, data_stream);  // Data offset - patched after the moof is written
 
 	for (auto &sample_data : sample_datas)
 	{
-		WriteUint32(sample_data->duration, data);  // duration
+		WriteUint32(sample_data->duration, data_stream);  // duration
 
 		if (_media_type == M4sMediaType::Video)
 		{
-			WriteUint32(sample_data->data->GetLength() + 4, data);	// size + sample
-			WriteUint32(sample_data->flag, data);					  // flag
-			WriteUint32(sample_data->GetCts(), data);  // compoistion timeoffset
+			WriteUint32(sample_data->data->GetLength() + 4, data_stream);  // size + sample
+			WriteUint32(sample_data->flag, data_stream);				   // flag
+			WriteUint32(sample_data->GetCts(), data_stream);			   // compoistion timeoffset
 		}
 		else if (_media_type == M4sMediaType::Audio)
 		{
-			WriteUint32(sample_data->data->GetLength(), data);  // sample
+			WriteUint32(sample_data->data->GetLength(), data_stream);  // sample
 		}
 	}
 
-	return WriteBoxData("trun", 0, flag, data, data_stream);
+	return EndBox(box_offset, data_stream);
 }
 
 int M4sSegmentWriter::WriteMdatBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, uint32_t total_sample_size)
 {
-	WriteUint32(MP4_BOX_HEADER_SIZE + total_sample_size, data_stream);  // box size write
+	WriteUint32(MP4_BOX_HEADER_SIZE + total_sample_size, data_stream);	// box size write
 	WriteText("mdat", data_stream);										// type write
 
 	for (auto &sample_data : sample_datas)
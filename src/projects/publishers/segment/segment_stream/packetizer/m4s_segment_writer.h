@@ -22,10 +22,11 @@ public:
 protected:
 	int WriteMoofBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas);
 	int WriteMfhdBox(std::shared_ptr<ov::Data> &data_stream);
-	int WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas);
+	// data_offset_position: the position of data_offset in the trun box, which is written after the size of moof is known
+	int WriteTrafBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, size_t &data_offset_position);
 	int WriteTfhdBox(std::shared_ptr<ov::Data> &data_stream);
 	int WriteTfdtBox(std::shared_ptr<ov::Data> &data_stream);
-	int WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas);
+	int WriteTrunBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, size_t &data_offset_position);
 	int WriteMdatBox(std::shared_ptr<ov::Data> &data_stream, const std::vector<std::shared_ptr<const SampleData>> &sample_datas, uint32_t total_sample_size);
 
 private:
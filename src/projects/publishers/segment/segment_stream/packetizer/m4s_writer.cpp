@@ -59,7 +59,7 @@ bool M4sWriter::WriteInit(uint8_t value, int init_size, std::shared_ptr<ov::Data
 
 bool M4sWriter::WriteText(const ov::String &value, std::shared_ptr<ov::Data> &data_stream)
 {
-	data_stream->Append(value.ToData(false).get());
+	data_stream->Append(value.CStr(), value.GetLength());
 	return true;
 }
 
@@ -152,3 +152,57 @@ int M4sWriter::WriteBoxData(const ov::String &type,
 
 	return data_stream->GetLength();
 }
+
+//====================================================================================================
+// Begin Box(ov::Data)
+// - return : offset of the box
+//====================================================================================================
+size_t M4sWriter::BeginBox(const char *type, std::shared_ptr<ov::Data> &data_stream)
+{
+	size_t box_offset = data_stream->GetLength();
+
+	WriteUint32(0, data_stream);	// box size write (EndBox)
+	data_stream->Append(type, 4);	// type write
+
+	return box_offset;
+}
+
+//====================================================================================================
+// Begin Box(ov::Data)
+// - return : offset of the box
+//====================================================================================================
+size_t M4sWriter::BeginBox(const char *type, uint8_t version, uint32_t flags, std::shared_ptr<ov::Data> &data_stream)
+{
+	size_t box_offset = BeginBox(type, data_stream);
+
+	WriteUint8(version, data_stream);	// version write
+	WriteUint24(flags, data_stream);	// flag write
+
+	return box_offset;
+}
+
+//====================================================================================================
+// End Box(ov::Data)
+// - return : data write size
+//====================================================================================================
+int M4sWriter::EndBox(size_t box_offset, std::shared_ptr<ov::Data> &data_stream)
+{
+	OV_ASSERT2((box_offset + MP4_BOX_HEADER_SIZE) <= data_stream->GetLength());
+
+	PatchUint32(box_offset, data_stream->GetLength() - box_offset, data_stream);
+
+	return data_stream->GetLength();
+}
+
+bool M4sWriter::PatchUint32(size_t offset, uint32_t value, std::shared_ptr<ov::Data> &data_stream)
+{
+	if ((offset + sizeof(uint32_t)) > data_stream->GetLength())
+	{
+		OV_ASSERT2(false);
+		return false;
+	}
+
+	ByteWriter<uint32_t>::WriteBigEndian(data_stream->GetWritableDataAs<uint8_t>() + offset, value);
+
+	return true;
+}
@@ -99,6 +99,19 @@ protected:
 					 const std::shared_ptr<ov::Data> &data,
 					 std::shared_ptr<ov::Data> &data_stream);
 
+	// Single-pass box writing
+	//
+	// BeginBox() writes the header of a box with an empty size, and returns the offset of the box in data_stream.
+	// The children of the box are written to the same data_stream, and EndBox() writes the size of the box at the offset.
+	// So the children are not copied to the parent box.
+	size_t BeginBox(const char *type, std::shared_ptr<ov::Data> &data_stream);
+	size_t BeginBox(const char *type, uint8_t version, uint32_t flags, std::shared_ptr<ov::Data> &data_stream);
+	// - return : data write size
+	int EndBox(size_t box_offset, std::shared_ptr<ov::Data> &data_stream);
+
+	// Overwrite a value that is already written (eg: data_offset of trun)
+	bool PatchUint32(size_t offset, uint32_t value, std::shared_ptr<ov::Data> &data_stream);
+
 protected:
 	M4sMediaType _media_type;
 };
\ No newline at end of file
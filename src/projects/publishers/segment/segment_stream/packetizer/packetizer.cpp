@@ -29,10 +29,12 @@ Packetizer::Packetizer(const ov::String &app_name, const ov::String &stream_name
 	  _video_track(video_track),
 	  _audio_track(audio_track),
 
-	  _chunked_transfer(chunked_transfer)
+	  _chunked_transfer(chunked_transfer),
+
+	  _video_segment_ring(app_name, _segment_save_count, _segment_count),
+	  _audio_segment_ring(app_name, _segment_save_count, _segment_count)
 {
-	_video_segments.resize(_segment_save_count);
-	_audio_segments.resize(_segment_save_count);
+	_play_list_etag_prefix.Format("%" PRIx64, GetTimestampInMs());
 }
 
 int64_t Packetizer::GetCurrentMilliseconds()
@@ -116,9 +118,22 @@ uint64_t Packetizer::ConvertTimeScale(uint64_t time, const cmn::Timebase &from_t
 
 void Packetizer::SetPlayList(const ov::String &play_list)
 {
-	std::unique_lock<std::mutex> lock(_play_list_mutex);
+	std::unique_lock<std::mutex> lock(_play_list_update_mutex);
+
+	auto previous_play_list = std::atomic_load(&_play_list);
 
-	_play_list = play_list;
+	if ((previous_play_list != nullptr) &&
+		(previous_play_list->data->GetLength() == play_list.GetLength()) &&
+		(::memcmp(previous_play_list->data->GetData(), play_list.CStr(), play_list.GetLength()) == 0))
+	{
+		// Keep the version to allow the clients to revalidate the playlist
+		return;
+	}
+
+	auto version = ++_play_list_version;
+	auto etag = ov::String::FormatString("\"%s-%" PRIu64 "\"", _play_list_etag_prefix.CStr(), version);
+
+	std::atomic_store(&_play_list, std::shared_ptr<const PlayListItem>(std::make_shared<PlayListItem>(version, play_list.ToData(false), etag)));
 }
 
 bool Packetizer::IsReadyForStreaming() const noexcept
@@ -131,107 +146,57 @@ void Packetizer::SetReadyForStreaming() noexcept
 	_streaming_start = true;
 }
 
-bool Packetizer::GetPlayList(ov::String &play_list)
+bool Packetizer::GetPlayList(std::shared_ptr<const PlayListItem> &play_list)
 {
 	if (IsReadyForStreaming() == false)
 	{
 		return false;
 	}
 
-	std::unique_lock<std::mutex> lock(_play_list_mutex);
-
-	play_list = _play_list;
+	play_list = std::atomic_load(&_play_list);
 
-	return true;
+	return (play_list != nullptr);
 }
 
 bool Packetizer::GetVideoPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas)
 {
-	uint32_t begin_index = (_current_video_index >= _segment_count) ? (_current_video_index - _segment_count) : (_segment_save_count - (_segment_count - _current_video_index));
-	uint32_t end_index = (begin_index <= (_segment_save_count - _segment_count)) ? (begin_index + _segment_count) - 1 : (_segment_count - (_segment_save_count - begin_index)) - 1;
-
-	// video segment mutex
-	std::unique_lock<std::mutex> lock(_video_segment_mutex);
-
-	if (begin_index <= end_index)
-	{
-		for (auto item = _video_segments.begin() + begin_index; item <= _video_segments.begin() + end_index; item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
-	}
-	else
-	{
-		for (auto item = _video_segments.begin() + begin_index; item < _video_segments.end(); item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
-
-		for (auto item = _video_segments.begin(); item <= _video_segments.begin() + end_index; item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
-	}
+	GetPlaySegments(_video_segment_ring, segment_datas);
 
 	return true;
 }
 
 bool Packetizer::GetAudioPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas)
 {
-	uint32_t begin_index = (_current_audio_index >= _segment_count) ? (_current_audio_index - _segment_count) : (_segment_save_count - (_segment_count - _current_audio_index));
-	uint32_t end_index = (begin_index <= (_segment_save_count - _segment_count)) ? (begin_index + _segment_count) - 1 : (_segment_count - (_segment_save_count - begin_index)) - 1;
+	GetPlaySegments(_audio_segment_ring, segment_datas);
 
-	// audio segment mutex
-	std::unique_lock<std::mutex> lock(_audio_segment_mutex);
+	return true;
+}
 
-	if (begin_index <= end_index)
+void Packetizer::GetPlaySegments(const SegmentRing &segment_ring, std::vector<std::shared_ptr<SegmentItem>> &segment_datas) const
+{
+	if (segment_ring.IsDvrEnabled())
 	{
-		for (auto item = _audio_segments.begin() + begin_index; item <= _audio_segments.begin() + end_index; item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
+		segment_ring.GetDvrSegments(segment_datas);
 	}
 	else
 	{
-		for (auto item = _audio_segments.begin() + begin_index; item < _audio_segments.end(); item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
-		for (auto item = _audio_segments.begin(); item <= _audio_segments.begin() + end_index; item++)
-		{
-			if (*item == nullptr)
-			{
-				return true;
-			}
-
-			segment_datas.push_back(*item);
-		}
+		segment_ring.GetLatestSegments(_segment_count, segment_datas);
 	}
+}
 
-	return true;
-}
\ No newline at end of file
+void Packetizer::SetSegmentMemoryBudget(size_t memory_budget)
+{
+	_video_segment_ring.SetMemoryBudget(memory_budget);
+	_audio_segment_ring.SetMemoryBudget(memory_budget);
+}
+
+size_t Packetizer::GetSegmentBytes() const
+{
+	return _video_segment_ring.GetBytes() + _audio_segment_ring.GetBytes();
+}
+
+void Packetizer::EnableDvr(const ov::String &directory, int64_t duration_in_ms)
+{
+	_video_segment_ring.SetFileStore(std::make_shared<SegmentFileStore>(_app_name, directory, duration_in_ms));
+	_audio_segment_ring.SetFileStore(std::make_shared<SegmentFileStore>(_app_name, directory, duration_in_ms));
+}
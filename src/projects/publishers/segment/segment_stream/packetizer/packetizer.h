@@ -15,6 +15,7 @@
 
 #include "packetizer_define.h"
 #include "chunked_transfer_interface.h"
+#include "segment_ring.h"
 
 class Packetizer
 {
@@ -50,14 +51,24 @@ public:
 	//   +--------+---------+--------+-----------+
 	static uint64_t ConvertTimeScale(uint64_t time, const cmn::Timebase &from_timebase, const cmn::Timebase &to_timebase);
 
+	// Publishes a new version of the playlist (It is not changed if the content is the same as the previous one)
 	void SetPlayList(const ov::String &play_list);
 
 	virtual bool IsReadyForStreaming() const noexcept;
-	virtual bool GetPlayList(ov::String &play_list);
+	virtual bool GetPlayList(std::shared_ptr<const PlayListItem> &play_list);
 
 	bool GetVideoPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas);
 	bool GetAudioPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas);
 
+	// The oldest segments are removed if the segments of a media type use more memory than memory_budget (bytes, 0: unlimited)
+	void SetSegmentMemoryBudget(size_t memory_budget);
+	// Total length of the segments which are kept in the packetizer
+	size_t GetSegmentBytes() const;
+
+	// Keep the segments removed from the live window in files of <directory> up to <duration_in_ms>,
+	// and make the playlist with all of the segments (Must be called before the first segment is made)
+	void EnableDvr(const ov::String &directory, int64_t duration_in_ms);
+
 	static int64_t GetTimestampInMs();
 	static ov::String MakeUtcSecond(time_t value);
 	static ov::String MakeUtcMillisecond(int64_t value = -1LL);
@@ -67,6 +78,9 @@ public:
 protected:
 	virtual void SetReadyForStreaming() noexcept;
 
+	// The latest <_segment_count> segments, or all segments in the DVR window
+	void GetPlaySegments(const SegmentRing &segment_ring, std::vector<std::shared_ptr<SegmentItem>> &segment_datas) const;
+
 	ov::String _app_name;
 	ov::String _stream_name;
 
@@ -86,15 +100,15 @@ protected:
 	bool _video_key_frame_received = false;
 	bool _audio_key_frame_received = false;
 
-	uint32_t _current_video_index = 0U;
-	uint32_t _current_audio_index = 0U;
-
-	ov::String _play_list;
-	std::vector<std::shared_ptr<SegmentItem>> _video_segments;
-	// HLS packetizer doesn't use _audio_segments
-	std::vector<std::shared_ptr<SegmentItem>> _audio_segments;
-
-	mutable std::mutex _play_list_mutex;
-	mutable std::mutex _video_segment_mutex;
-	mutable std::mutex _audio_segment_mutex;
+	// Replaced as a whole using std::atomic_load()/std::atomic_store(), so requests don't need to lock/copy the playlist
+	std::shared_ptr<const PlayListItem> _play_list;
+	// Used to make an ETag which is not reused by the next packetizer of the same stream
+	ov::String _play_list_etag_prefix;
+	std::atomic<uint64_t> _play_list_version{0};
+	std::mutex _play_list_update_mutex;
+
+	// Segments are appended by the packetizer thread, and found by the HTTP threads without locking
+	SegmentRing _video_segment_ring;
+	// HLS packetizer doesn't use _audio_segment_ring
+	SegmentRing _audio_segment_ring;
 };
@@ -10,6 +10,7 @@
 
 #include <base/mediarouter/media_type.h>
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/file_range.h>
 #include <string.h>
 
 #include <deque>
@@ -78,6 +79,27 @@ public:
 	int64_t duration = 0L;
 	int64_t duration_in_ms = 0L;
 	std::shared_ptr<const ov::Data> data;
+	// If the segment is moved to the DVR store, data is nullptr and the segment is in the file
+	std::shared_ptr<const ov::FileRange> file;
+};
+
+// A playlist (such as .m3u8, .mpd) which is shared by all requests until the playlist is updated
+struct PlayListItem
+{
+public:
+	PlayListItem(uint64_t version, const std::shared_ptr<const ov::Data> &data, const ov::String &etag)
+		: version(version),
+		  data(data),
+		  etag(etag)
+	{
+	}
+
+public:
+	// Increased whenever the content of the playlist is changed
+	uint64_t version = 0;
+	std::shared_ptr<const ov::Data> data;
+	// Empty if the playlist is generated for each request (it cannot be validated by If-None-Match)
+	ov::String etag;
 };
 
 enum class PacketizerFrameType
@@ -0,0 +1,339 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "segment_file_store.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+
+#include "../segment_stream_private.h"
+
+// If the writer cannot keep up with the segments (e.g. the disk is too slow), the DVR window starts again
+// instead of keeping the segments in the memory
+#define MAX_PENDING_SEGMENT_COUNT (10)
+// The file is rotated when it grows larger than max(the DVR window, MIN_FILE_ROTATION_SIZE)
+#define MIN_FILE_ROTATION_SIZE (16 * 1024 * 1024)
+
+namespace
+{
+	// Writes the segments of all stores in order on a thread
+	class SegmentFileWriter
+	{
+	public:
+		~SegmentFileWriter()
+		{
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+				_stop = true;
+			}
+
+			_condition.notify_one();
+
+			if (_thread.joinable())
+			{
+				_thread.join();
+			}
+		}
+
+		void Post(std::function<void()> task)
+		{
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+
+				if (_thread.joinable() == false)
+				{
+					_thread = std::thread(&SegmentFileWriter::Run, this);
+					pthread_setname_np(_thread.native_handle(), "SegmentWriter");
+				}
+
+				_tasks.push_back(std::move(task));
+			}
+
+			_condition.notify_one();
+		}
+
+	protected:
+		void Run()
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			while (true)
+			{
+				_condition.wait(lock, [this]() { return _stop || (_tasks.empty() == false); });
+
+				if (_stop)
+				{
+					break;
+				}
+
+				auto task = std::move(_tasks.front());
+				_tasks.pop_front();
+
+				lock.unlock();
+				task();
+				lock.lock();
+			}
+		}
+
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		std::deque<std::function<void()>> _tasks;
+		std::thread _thread;
+		bool _stop = false;
+	};
+
+	SegmentFileWriter &GetWriter()
+	{
+		static SegmentFileWriter writer;
+
+		return writer;
+	}
+
+	size_t GetSegmentLength(const std::shared_ptr<const SegmentItem> &segment)
+	{
+		if (segment->file != nullptr)
+		{
+			return segment->file->GetLength();
+		}
+
+		return (segment->data != nullptr) ? segment->data->GetLength() : 0;
+	}
+}  // namespace
+
+SegmentFileStore::SegmentFileStore(const ov::String &app_name, const ov::String &directory, int64_t duration_in_ms)
+	: _app_name(app_name),
+	  _directory(directory),
+	  _duration_in_ms(duration_in_ms)
+{
+}
+
+int SegmentFileStore::CreateFile()
+{
+	auto path = ov::PathManager::Combine(_directory, "ome_segment_XXXXXX");
+	std::vector<char> path_buffer(path.CStr(), path.CStr() + path.GetLength() + 1);
+
+	int fd = ::mkstemp(path_buffer.data());
+
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	// The file is removed when the last file descriptor is closed
+	::unlink(path_buffer.data());
+	::fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+	return fd;
+}
+
+bool SegmentFileStore::Store(const std::shared_ptr<const SegmentItem> &segment)
+{
+	if ((segment == nullptr) || (segment->data == nullptr))
+	{
+		return false;
+	}
+
+	// The segment is served from the memory until the writer thread writes it to the file
+	auto stored_segment = std::make_shared<SegmentItem>(*segment);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+		if (_pending_count >= MAX_PENDING_SEGMENT_COUNT)
+		{
+			if (_last_store_failed.exchange(true) == false)
+			{
+				logtw("Could not store segments of %s in %s in time, the DVR window starts again", _app_name.CStr(), _directory.CStr());
+			}
+
+			// Segments in the DVR window must be contiguous
+			_segments.clear();
+			_total_duration_in_ms = 0LL;
+			_bytes = 0;
+
+			return false;
+		}
+
+		_segments.push_back(stored_segment);
+		_total_duration_in_ms += stored_segment->duration_in_ms;
+		_bytes += GetSegmentLength(stored_segment);
+		_pending_count++;
+
+		while ((_total_duration_in_ms > _duration_in_ms) && (_segments.empty() == false))
+		{
+			auto &oldest = _segments.front();
+
+			_total_duration_in_ms -= oldest->duration_in_ms;
+			_bytes -= GetSegmentLength(oldest);
+
+			// The range of the file is released when the segment is not being sent
+			_segments.pop_front();
+		}
+	}
+
+	std::weak_ptr<SegmentFileStore> weak_store = shared_from_this();
+
+	GetWriter().Post([weak_store, stored_segment]() {
+		auto store = weak_store.lock();
+
+		if (store != nullptr)
+		{
+			store->Write(stored_segment);
+		}
+	});
+
+	return true;
+}
+
+void SegmentFileStore::Write(const std::shared_ptr<SegmentItem> &segment)
+{
+	{
+		std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+		_pending_count--;
+
+		if (std::find(_segments.begin(), _segments.end(), segment) == _segments.end())
+		{
+			// Already removed from the window
+			return;
+		}
+	}
+
+	auto length = segment->data->GetLength();
+	off_t offset = 0;
+
+	auto error = WriteToFile(segment->data->GetDataAs<uint8_t>(), length, &offset);
+
+	if (error != nullptr)
+	{
+		OnStoreFailed(error);
+		return;
+	}
+
+	_last_store_failed = false;
+
+	auto file_segment = std::make_shared<SegmentItem>(*segment);
+	file_segment->data = nullptr;
+	file_segment->file = std::make_shared<ov::FileRange>(_file, offset, length);
+
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	auto item = std::find(_segments.begin(), _segments.end(), segment);
+
+	if (item != _segments.end())
+	{
+		// Readers which already got the segment keep sending it from the memory
+		*item = file_segment;
+	}
+}
+
+std::shared_ptr<ov::Error> SegmentFileStore::WriteToFile(const uint8_t *data, size_t length, off_t *offset)
+{
+	size_t rotation_size = std::max(GetBytes(), static_cast<size_t>(MIN_FILE_ROTATION_SIZE));
+
+	if ((_file == nullptr) || (_file_length >= rotation_size))
+	{
+		int fd = CreateFile();
+
+		if (fd < 0)
+		{
+			return ov::Error::CreateErrorFromErrno();
+		}
+
+		// The segments in the old file keep it open until they are released
+		_file = std::make_shared<ov::FileRange>(fd, 0, 0);
+		_file_length = 0;
+	}
+
+	size_t total_written = 0;
+
+	while (total_written < length)
+	{
+		auto written = ::pwrite(_file->GetFd(), data + total_written, length - total_written, _file_length + total_written);
+
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			auto error = ov::Error::CreateErrorFromErrno();
+
+			// Start from a new file for the next segment
+			_file = nullptr;
+			_file_length = 0;
+
+			return error;
+		}
+
+		total_written += written;
+	}
+
+	*offset = _file_length;
+	_file_length += length;
+
+	return nullptr;
+}
+
+void SegmentFileStore::OnStoreFailed(const std::shared_ptr<ov::Error> &error)
+{
+	if (_last_store_failed.exchange(true) == false)
+	{
+		// Disk full, permission denied, etc.
+		logtw("Could not store segments of %s in %s: %s", _app_name.CStr(), _directory.CStr(), error->ToString().CStr());
+	}
+
+	// Segments in the DVR window must be contiguous, so the window starts again from the next segment
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	_segments.clear();
+	_total_duration_in_ms = 0LL;
+	_bytes = 0;
+}
+
+std::shared_ptr<SegmentItem> SegmentFileStore::Find(const ov::String &file_name) const
+{
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	for (auto item = _segments.rbegin(); item != _segments.rend(); ++item)
+	{
+		if ((*item)->file_name == file_name)
+		{
+			return *item;
+		}
+	}
+
+	return nullptr;
+}
+
+void SegmentFileStore::GetSegments(std::vector<std::shared_ptr<SegmentItem>> &segments) const
+{
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	segments.insert(segments.end(), _segments.begin(), _segments.end());
+}
+
+size_t SegmentFileStore::GetCount() const
+{
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	return _segments.size();
+}
+
+size_t SegmentFileStore::GetBytes() const
+{
+	std::lock_guard<std::mutex> lock_guard(_segments_mutex);
+
+	return _bytes;
+}
@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "packetizer_define.h"
+
+// Keeps the segments which are removed from the SegmentRing in files for the DVR window (timeshift)
+//
+// - The segments of a track are appended to one file in <directory> (a local disk or tmpfs),
+//   and each segment refers to its (offset, length) range of the file, so a store uses only a few file descriptors.
+// - The file is rotated when it grows larger than the DVR window. The old file is closed when
+//   the last segment in it is removed from the window and nobody is sending it.
+// - The file is unlinked right after it is created, so no file is left even if the process is killed.
+// - The files are written by a writer thread, so the packetizer thread is not blocked by the disk I/O.
+//   Until a segment is written, it is served from the memory.
+// - The oldest segments are removed when the total duration of the segments exceeds <duration>
+class SegmentFileStore : public std::enable_shared_from_this<SegmentFileStore>
+{
+public:
+	// duration_in_ms: Maximum duration of the segments in the store
+	SegmentFileStore(const ov::String &app_name, const ov::String &directory, int64_t duration_in_ms);
+
+	//--------------------------------------------------------------------
+	// Producer (packetizer thread only)
+	//--------------------------------------------------------------------
+	bool Store(const std::shared_ptr<const SegmentItem> &segment);
+
+	//--------------------------------------------------------------------
+	// Readers (any thread)
+	//--------------------------------------------------------------------
+	std::shared_ptr<SegmentItem> Find(const ov::String &file_name) const;
+
+	// Get all segments in the store (oldest first)
+	void GetSegments(std::vector<std::shared_ptr<SegmentItem>> &segments) const;
+
+	size_t GetCount() const;
+	// Total length of the segments
+	size_t GetBytes() const;
+
+protected:
+	int CreateFile();
+
+	// Called by the writer thread
+	void Write(const std::shared_ptr<SegmentItem> &segment);
+	std::shared_ptr<ov::Error> WriteToFile(const uint8_t *data, size_t length, off_t *offset);
+	void OnStoreFailed(const std::shared_ptr<ov::Error> &error);
+
+	ov::String _app_name;
+	ov::String _directory;
+	int64_t _duration_in_ms = 0LL;
+
+	mutable std::mutex _segments_mutex;
+	std::deque<std::shared_ptr<SegmentItem>> _segments;
+	int64_t _total_duration_in_ms = 0LL;
+	size_t _bytes = 0;
+	// Number of the segments which are not written yet
+	size_t _pending_count = 0;
+
+	// The file which the segments are appended to (used by the writer thread only)
+	std::shared_ptr<const ov::FileRange> _file;
+	size_t _file_length = 0;
+
+	// Used to log the error only once until the store is recovered
+	std::atomic<bool> _last_store_failed{false};
+};
@@ -0,0 +1,311 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "segment_ring.h"
+
+#include <map>
+#include <mutex>
+
+#include "../segment_stream_private.h"
+
+// Buffers of the removed segments to keep for the next segments
+#define MAX_FREE_BUFFER_COUNT (2)
+
+namespace
+{
+	std::mutex application_bytes_mutex;
+	// Key: Application name
+	std::map<ov::String, std::shared_ptr<std::atomic<size_t>>> application_bytes_map;
+
+	std::shared_ptr<std::atomic<size_t>> GetApplicationBytes(const ov::String &app_name)
+	{
+		auto lock_guard = std::lock_guard(application_bytes_mutex);
+
+		auto &application_bytes = application_bytes_map[app_name];
+
+		if (application_bytes == nullptr)
+		{
+			application_bytes = std::make_shared<std::atomic<size_t>>(0);
+		}
+
+		return application_bytes;
+	}
+}  // namespace
+
+SegmentRing::SegmentRing(const ov::String &app_name, size_t capacity, size_t min_count)
+	: _app_name(app_name),
+	  _min_count(min_count),
+	  _application_bytes(GetApplicationBytes(app_name))
+{
+	OV_ASSERT2(capacity > 0);
+	OV_ASSERT2(min_count <= capacity);
+
+	_slots.resize(std::max(capacity, static_cast<size_t>(1)));
+}
+
+SegmentRing::~SegmentRing()
+{
+	*_application_bytes -= _bytes;
+
+	auto lock_guard = std::lock_guard(application_bytes_mutex);
+
+	// Remove the entry when the last ring of the application is destroyed (the map and this ring refer to it)
+	if (_application_bytes.use_count() == 2)
+	{
+		application_bytes_map.erase(_app_name);
+	}
+}
+
+void SegmentRing::SetMemoryBudget(size_t memory_budget)
+{
+	_memory_budget = memory_budget;
+}
+
+void SegmentRing::SetFileStore(const std::shared_ptr<SegmentFileStore> &file_store)
+{
+	_file_store = file_store;
+}
+
+std::shared_ptr<SegmentItem> SegmentRing::LoadSlot(uint64_t index) const
+{
+	return std::atomic_load(&_slots[index % _slots.size()]);
+}
+
+void SegmentRing::StoreSlot(uint64_t index, const std::shared_ptr<SegmentItem> &segment)
+{
+	std::atomic_store(&_slots[index % _slots.size()], segment);
+}
+
+void SegmentRing::AddBytes(const std::shared_ptr<SegmentItem> &segment)
+{
+	size_t length = (segment->data != nullptr) ? segment->data->GetLength() : 0;
+
+	_bytes += length;
+	*_application_bytes += length;
+}
+
+void SegmentRing::SubtractBytes(const std::shared_ptr<SegmentItem> &segment)
+{
+	size_t length = (segment->data != nullptr) ? segment->data->GetLength() : 0;
+
+	_bytes -= length;
+	*_application_bytes -= length;
+}
+
+bool SegmentRing::Append(const std::shared_ptr<SegmentItem> &segment)
+{
+	if (segment == nullptr)
+	{
+		OV_ASSERT2(false);
+		return false;
+	}
+
+	auto head = _head.load(std::memory_order_relaxed);
+	auto tail = _tail.load(std::memory_order_relaxed);
+
+	for (auto index = head; index < tail; index++)
+	{
+		auto old_segment = LoadSlot(index);
+
+		if ((old_segment != nullptr) && (old_segment->file_name == segment->file_name))
+		{
+			// Keep the order of the segments in the ring
+			segment->sequence_number = old_segment->sequence_number;
+			StoreSlot(index, segment);
+
+			SubtractBytes(old_segment);
+			AddBytes(segment);
+
+			Recycle(std::move(old_segment));
+
+			return true;
+		}
+	}
+
+	if ((tail - head) >= _slots.size())
+	{
+		RemoveOldest();
+	}
+
+	StoreSlot(tail, segment);
+	AddBytes(segment);
+
+	// Readers see the segment after the slot is stored
+	_tail.store(tail + 1, std::memory_order_release);
+
+	if (_memory_budget > 0)
+	{
+		while ((_bytes > _memory_budget) && ((_tail - _head) > _min_count))
+		{
+			RemoveOldest();
+		}
+
+		bool over_budget = (_bytes > _memory_budget);
+
+		if (over_budget != _over_budget)
+		{
+			_over_budget = over_budget;
+
+			if (over_budget)
+			{
+				logtw("The segments of %s use more memory than the budget even with %zu segments: %zu bytes (budget: %zu bytes)",
+					  _app_name.CStr(), GetCount(), _bytes.load(), _memory_budget);
+			}
+		}
+	}
+
+	return false;
+}
+
+void SegmentRing::RemoveOldest()
+{
+	auto head = _head.load(std::memory_order_relaxed);
+
+	if (head == _tail.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	auto old_segment = LoadSlot(head);
+
+	if ((_file_store != nullptr) && (old_segment != nullptr))
+	{
+		// Store the segment before removing it from the ring, so readers can always find it in one of them
+		_file_store->Store(old_segment);
+	}
+
+	StoreSlot(head, nullptr);
+	_head.store(head + 1, std::memory_order_release);
+
+	if (old_segment != nullptr)
+	{
+		SubtractBytes(old_segment);
+		Recycle(std::move(old_segment));
+	}
+}
+
+void SegmentRing::Recycle(std::shared_ptr<SegmentItem> segment)
+{
+	// The segment is already removed from the ring, so nobody can get it from now on.
+	// If nobody is sending it, the buffer can be reused.
+	if ((_free_buffers.size() >= MAX_FREE_BUFFER_COUNT) ||
+		(segment.use_count() != 1) ||
+		(segment->data == nullptr) ||
+		(segment->data.use_count() != 1))
+	{
+		return;
+	}
+
+	// The buffer was created by the packetizer as a writable ov::Data
+	auto buffer = std::const_pointer_cast<ov::Data>(segment->data);
+	segment->data = nullptr;
+
+	if (buffer->SetLength(0))
+	{
+		_free_buffers.push_back(std::move(buffer));
+	}
+}
+
+std::shared_ptr<ov::Data> SegmentRing::GetFreeBuffer()
+{
+	if (_free_buffers.empty())
+	{
+		return nullptr;
+	}
+
+	auto buffer = std::move(_free_buffers.back());
+	_free_buffers.pop_back();
+
+	return buffer;
+}
+
+std::shared_ptr<SegmentItem> SegmentRing::Find(const ov::String &file_name) const
+{
+	auto head = _head.load(std::memory_order_acquire);
+	auto tail = _tail.load(std::memory_order_acquire);
+
+	// The latest segments are requested in most cases
+	for (auto index = tail; index > head; index--)
+	{
+		auto segment = LoadSlot(index - 1);
+
+		if ((segment != nullptr) && (segment->file_name == file_name))
+		{
+			return segment;
+		}
+	}
+
+	return (_file_store != nullptr) ? _file_store->Find(file_name) : nullptr;
+}
+
+void SegmentRing::GetLatestSegments(size_t count, std::vector<std::shared_ptr<SegmentItem>> &segments) const
+{
+	auto head = _head.load(std::memory_order_acquire);
+	auto tail = _tail.load(std::memory_order_acquire);
+
+	auto begin = std::max(head, (tail > count) ? (tail - count) : 0);
+
+	for (auto index = begin; index < tail; index++)
+	{
+		auto segment = LoadSlot(index);
+
+		if (segment == nullptr)
+		{
+			// Removed by the producer in the meantime
+			continue;
+		}
+
+		if ((segments.empty() == false) && (segments.back()->sequence_number >= segment->sequence_number))
+		{
+			// The slot is overwritten by a newer segment in the meantime
+			break;
+		}
+
+		segments.push_back(segment);
+	}
+}
+
+void SegmentRing::GetDvrSegments(std::vector<std::shared_ptr<SegmentItem>> &segments) const
+{
+	// A segment is stored in the file store before it is removed from the ring,
+	// so the ring must be read first not to miss a segment that is being moved
+	std::vector<std::shared_ptr<SegmentItem>> ring_segments;
+	GetLatestSegments(_slots.size(), ring_segments);
+
+	if (_file_store != nullptr)
+	{
+		_file_store->GetSegments(segments);
+	}
+
+	for (auto &segment : ring_segments)
+	{
+		// The segment can be in both of them while it is moved
+		if (segments.empty() || (segments.back()->sequence_number < segment->sequence_number))
+		{
+			segments.push_back(segment);
+		}
+	}
+}
+
+size_t SegmentRing::GetCount() const
+{
+	return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+}
+
+size_t SegmentRing::GetBytes() const
+{
+	return _bytes;
+}
+
+size_t SegmentRing::GetBytesOfApplication(const ov::String &app_name)
+{
+	auto lock_guard = std::lock_guard(application_bytes_mutex);
+
+	auto item = application_bytes_map.find(app_name);
+
+	return (item != application_bytes_map.end()) ? item->second->load() : 0;
+}
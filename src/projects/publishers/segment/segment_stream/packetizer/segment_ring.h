@@ -0,0 +1,97 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "packetizer_define.h"
+#include "segment_file_store.h"
+
+// A fixed-size ring of the segments of a stream (per media type)
+//
+// - Only the packetizer thread appends segments, and the HTTP threads look up segments without locking
+//   (each slot is replaced as a whole using std::atomic_load()/std::atomic_store())
+// - If the segments use more memory than the budget, the oldest segments are removed earlier,
+//   but at least <min_count> segments (the segments in the playlist) are kept
+// - The buffer of a removed segment is reused for the next segment if nobody references it,
+//   so the packetizer doesn't need to allocate a large buffer for every segment
+// - If a SegmentFileStore is set, the removed segments are moved to the store for the DVR window
+class SegmentRing
+{
+public:
+	SegmentRing(const ov::String &app_name, size_t capacity, size_t min_count);
+	~SegmentRing();
+
+	//--------------------------------------------------------------------
+	// Producer (packetizer thread only)
+	//--------------------------------------------------------------------
+	// Unit: bytes (0: unlimited)
+	void SetMemoryBudget(size_t memory_budget);
+	// Must be set before the first segment is appended
+	void SetFileStore(const std::shared_ptr<SegmentFileStore> &file_store);
+
+	// Returns true if the segment replaced an existing segment of the same name
+	bool Append(const std::shared_ptr<SegmentItem> &segment);
+
+	// Returns an empty buffer of a removed segment (nullptr if there is no buffer to reuse)
+	std::shared_ptr<ov::Data> GetFreeBuffer();
+
+	//--------------------------------------------------------------------
+	// Readers (any thread)
+	//--------------------------------------------------------------------
+	// Finds the segment from the ring, and then from the file store
+	std::shared_ptr<SegmentItem> Find(const ov::String &file_name) const;
+
+	// Get up to <count> latest segments (oldest first)
+	void GetLatestSegments(size_t count, std::vector<std::shared_ptr<SegmentItem>> &segments) const;
+	// Get the segments in the file store and all segments in the ring (oldest first)
+	void GetDvrSegments(std::vector<std::shared_ptr<SegmentItem>> &segments) const;
+	bool IsDvrEnabled() const
+	{
+		return (_file_store != nullptr);
+	}
+
+	size_t GetCount() const;
+	// Total length of the segments in the ring
+	size_t GetBytes() const;
+
+	// Total length of the segments of all streams in the application
+	static size_t GetBytesOfApplication(const ov::String &app_name);
+
+protected:
+	std::shared_ptr<SegmentItem> LoadSlot(uint64_t index) const;
+	void StoreSlot(uint64_t index, const std::shared_ptr<SegmentItem> &segment);
+
+	void RemoveOldest();
+	void AddBytes(const std::shared_ptr<SegmentItem> &segment);
+	void SubtractBytes(const std::shared_ptr<SegmentItem> &segment);
+	void Recycle(std::shared_ptr<SegmentItem> segment);
+
+	ov::String _app_name;
+
+	std::vector<std::shared_ptr<SegmentItem>> _slots;
+	size_t _min_count = 0;
+
+	// Segments in [_head, _tail) are alive (slot index: index % _slots.size())
+	std::atomic<uint64_t> _head{0};
+	std::atomic<uint64_t> _tail{0};
+
+	std::atomic<size_t> _bytes{0};
+	std::shared_ptr<std::atomic<size_t>> _application_bytes;
+	size_t _memory_budget = 0;
+	bool _over_budget = false;
+
+	// Used by the producer only
+	std::vector<std::shared_ptr<ov::Data>> _free_buffers;
+
+	std::shared_ptr<SegmentFileStore> _file_store;
+};
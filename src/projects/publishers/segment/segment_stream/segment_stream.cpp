@@ -10,20 +10,30 @@
 
 #include <base/publisher/publisher.h>
 #include <config/items/items.h>
+#include <monitoring/monitoring.h>
 
 #include "segment_stream_private.h"
+#include "packetizer/segment_ring.h"
 #include "stream_packetizer.h"
 
+// Interval to report the bytes of the segments to the monitoring module
+#define SEGMENT_METRICS_UPDATE_INTERVAL_MS (5 * 1000)
+
 SegmentStream::SegmentStream(
 	const std::shared_ptr<pub::Application> application,
 	const info::Stream &info,
 	int segment_count, int segment_duration,
+	size_t memory_budget,
+	const ov::String &dvr_directory, int64_t dvr_duration_in_ms,
 	const std::shared_ptr<PacketizerFactoryInterface> &packetizer_factory,
 	const std::shared_ptr<ChunkedTransferInterface> &chunked_transfer)
 	: Stream(application, info),
 
 	  _segment_count(segment_count),
 	  _segment_duration(segment_duration),
+	  _memory_budget(memory_budget),
+	  _dvr_directory(dvr_directory),
+	  _dvr_duration_in_ms(dvr_duration_in_ms),
 
 	  _packetizer_factory(packetizer_factory),
 
@@ -90,20 +100,61 @@ bool SegmentStream::Start()
 		_video_track, _audio_track,
 		_chunked_transfer);
 
+	_stream_packetizer->SetSegmentMemoryBudget(_memory_budget);
+
+	if (_dvr_duration_in_ms > 0LL)
+	{
+		_stream_packetizer->EnableDvr(_dvr_directory, _dvr_duration_in_ms);
+	}
+
+	_metrics_stop_watch.Start();
+
 	return Stream::Start();
 }
 
 bool SegmentStream::Stop()
 {
+	UpdateSegmentMetrics(true);
+
 	return Stream::Stop();
 }
 
+void SegmentStream::UpdateSegmentMetrics(bool stopping)
+{
+	auto stream_bytes = GetSegmentBytes();
+	auto application_bytes = SegmentRing::GetBytesOfApplication(GetApplicationName());
+
+	if (stopping)
+	{
+		// The segments of the stream are released after the stream is stopped
+		application_bytes -= std::min(application_bytes, stream_bytes);
+		stream_bytes = 0;
+	}
+
+	auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(pub::Stream::GetSharedPtr()));
+	if (stream_metrics != nullptr)
+	{
+		stream_metrics->SetSegmentBytes(GetApplication()->GetPublisherType(), stream_bytes);
+	}
+
+	auto application_metrics = ApplicationMetrics(*std::static_pointer_cast<info::Application>(GetApplication()));
+	if (application_metrics != nullptr)
+	{
+		application_metrics->SetSegmentBytes(application_bytes);
+	}
+}
+
 void SegmentStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	if (_stream_packetizer != nullptr && _media_tracks.find(media_packet->GetTrackId()) != _media_tracks.end())
 	{
 		_stream_packetizer->AppendVideoData(media_packet);
 	}
+
+	if (_metrics_stop_watch.IsElapsed(SEGMENT_METRICS_UPDATE_INTERVAL_MS) && _metrics_stop_watch.Update())
+	{
+		UpdateSegmentMetrics(false);
+	}
 }
 
 void SegmentStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
@@ -112,9 +163,15 @@ void SegmentStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_pac
 	{
 		_stream_packetizer->AppendAudioData(media_packet);
 	}
+
+	if ((_video_track == nullptr) && _metrics_stop_watch.IsElapsed(SEGMENT_METRICS_UPDATE_INTERVAL_MS) && _metrics_stop_watch.Update())
+	{
+		// Audio-only stream
+		UpdateSegmentMetrics(false);
+	}
 }
 
-bool SegmentStream::GetPlayList(ov::String &play_list)
+bool SegmentStream::GetPlayList(std::shared_ptr<const PlayListItem> &play_list)
 {
 	if (_stream_packetizer != nullptr)
 	{
@@ -134,6 +191,16 @@ std::shared_ptr<const SegmentItem> SegmentStream::GetSegmentData(const ov::Strin
 	return _stream_packetizer->GetSegmentData(file_name);
 }
 
+size_t SegmentStream::GetSegmentBytes() const
+{
+	if (_stream_packetizer == nullptr)
+	{
+		return 0;
+	}
+
+	return _stream_packetizer->GetSegmentBytes();
+}
+
 bool SegmentStream::CheckCodec(cmn::MediaType type, cmn::MediaCodecId codec_id)
 {
 	switch (type)
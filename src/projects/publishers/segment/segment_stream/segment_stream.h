@@ -52,6 +52,8 @@ public:
 		const std::shared_ptr<pub::Application> application,
 		const info::Stream &info,
 		int segment_count, int segment_duration,
+		size_t memory_budget,
+		const ov::String &dvr_directory, int64_t dvr_duration_in_ms,
 		const std::shared_ptr<PacketizerFactoryInterface> &packetizer_factory,
 		const std::shared_ptr<ChunkedTransferInterface> &chunked_transfer);
 
@@ -59,12 +61,18 @@ public:
 	static std::shared_ptr<SegmentStream> Create(const std::shared_ptr<pub::Application> &application,
 												 const info::Stream &info,
 												 int segment_count, int segment_duration,
+												 // Unit: bytes (0: unlimited)
+												 size_t memory_budget,
+												 // Unit: milliseconds (0: DVR is disabled)
+												 const ov::String &dvr_directory, int64_t dvr_duration_in_ms,
 												 uint32_t thread_count,
 												 const std::shared_ptr<ChunkedTransferInterface> &chunked_transfer)
 	{
 		return std::make_shared<SegmentStream>(
 			application, info,
 			segment_count, segment_duration,
+			memory_budget,
+			dvr_directory, dvr_duration_in_ms,
 			std::make_shared<PacketizerFactory<Tpacketizer>>(),
 			chunked_transfer);
 	}
@@ -75,15 +83,24 @@ public:
 	bool Start() override;
 	bool Stop() override;
 
-	bool GetPlayList(ov::String &play_list);
+	bool GetPlayList(std::shared_ptr<const PlayListItem> &play_list);
 
 	std::shared_ptr<const SegmentItem> GetSegmentData(const ov::String &file_name) const;
 
+	// Total length of the segments which are kept in the memory for the stream
+	size_t GetSegmentBytes() const;
+
 protected:
 	virtual bool CheckCodec(cmn::MediaType type, cmn::MediaCodecId codec_id);
 
+	// Reports the bytes of the segments kept by the stream and by its application to the monitoring module
+	void UpdateSegmentMetrics(bool stopping);
+
 	int _segment_count = 0;
 	int _segment_duration = 0;
+	size_t _memory_budget = 0;
+	ov::String _dvr_directory;
+	int64_t _dvr_duration_in_ms = 0LL;
 
 	std::shared_ptr<PacketizerFactoryInterface> _packetizer_factory;
 
@@ -95,4 +112,6 @@ protected:
 
 	std::shared_ptr<MediaTrack> _video_track;
 	std::shared_ptr<MediaTrack> _audio_track;
+
+	ov::StopWatch _metrics_stop_watch;
 };
@@ -38,31 +38,42 @@ HttpInterceptorResult SegmentStreamInterceptor::OnHttpData(const std::shared_ptr
 
 	OV_ASSERT2(request->GetContentLength() >= 0);
 
-	if (request->GetContentLength() == 0)
+	// The data after the body is the next requests (pipelined)
+	auto content_length = static_cast<size_t>(request->GetContentLength());
+	std::shared_ptr<const ov::Data> remaining_data;
+
+	if (content_length == 0)
 	{
-		response->SetStatusCode(HttpStatusCode::OK);
-		_worker_manager.AddWork(client, request->GetRequestTarget(), request->GetHeader("Origin"));
+		remaining_data = data;
 	}
 	else
 	{
 		const std::shared_ptr<ov::Data> request_body = GetRequestBody(request);
 
-		// data size over(error)
-		if (request_body == nullptr ||
-			request_body->GetLength() + data->GetLength() > static_cast<size_t>(request->GetContentLength()))
+		if (request_body == nullptr)
 		{
 			return HttpInterceptorResult::Disconnect;
 		}
 
-		request_body->Append(data.get());
+		auto body_length = std::min(content_length - request_body->GetLength(), data->GetLength());
+
+		request_body->Append(data->GetData(), body_length);
 
-		// http data completed
-		if (request_body->GetLength() == static_cast<size_t>(request->GetContentLength()))
+		if (request_body->GetLength() < content_length)
 		{
-			response->SetStatusCode(HttpStatusCode::OK);
-			_worker_manager.AddWork(client, request->GetRequestTarget(), request->GetHeader("Origin"));
+			// Need more data
+			return HttpInterceptorResult::Keep;
 		}
+
+		remaining_data = data->Subdata(body_length);
 	}
 
+	// http data completed
+	response->SetStatusCode(HttpStatusCode::OK);
+
+	// The next requests are held until SegmentStreamServer::ProcessRequest() sends the response
+	client->WaitForResponse(remaining_data);
+	_worker_manager.AddWork(client, request->GetRequestTarget(), request->GetHeader("Origin"));
+
 	return HttpInterceptorResult::Keep;
 }
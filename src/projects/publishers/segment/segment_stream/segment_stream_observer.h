@@ -25,7 +25,7 @@ public:
 	// Called when the client requests a playlist (such as .m3u8, .mpd)
 	virtual bool OnPlayListRequest(const std::shared_ptr<HttpClient> &client,
 								   const SegmentStreamRequestInfo &request_info,
-								   ov::String &play_list) = 0;
+								   std::shared_ptr<const PlayListItem> &play_list) = 0;
 
 	// Called when the client requests a segment (such as .ts, .m4s)
 	virtual bool OnSegmentRequest(const std::shared_ptr<HttpClient> &client,
@@ -1,3 +1,8 @@
 #pragma once
 
 #define OV_LOG_TAG                      "SegmentStream"
+
+// A keep-alive connection which does not send the next request in this time is closed
+#define SEGMENT_KEEP_ALIVE_IDLE_TIMEOUT_MS      (30 * 1000)
+// Maximum number of requests on a keep-alive connection ("Connection: close" is sent with the last response)
+#define SEGMENT_KEEP_ALIVE_MAX_REQUEST_COUNT    (1000)
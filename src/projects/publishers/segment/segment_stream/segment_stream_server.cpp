@@ -13,6 +13,7 @@
 
 #include <regex>
 #include <sstream>
+#include <string_view>
 
 #include "segment_stream_private.h"
 
@@ -93,6 +94,47 @@ bool SegmentStreamServer::Stop()
 	return false;
 }
 
+bool SegmentStreamServer::SetSendQueueSize(size_t high_water_mark)
+{
+	bool result = true;
+
+	result = result && ((_http_server == nullptr) || _http_server->SetSendQueueSize(high_water_mark));
+	result = result && ((_https_server == nullptr) || _https_server->SetSendQueueSize(high_water_mark));
+
+	return result;
+}
+
+void SegmentStreamServer::DisconnectIdleClients()
+{
+	auto now = ov::Clock::NowMSec();
+
+	auto is_idle = [now](const std::shared_ptr<HttpClient> &client) -> bool {
+		auto idle_since = client->GetIdleSince();
+
+		return (idle_since > 0) && (now > idle_since) && ((now - idle_since) > SEGMENT_KEEP_ALIVE_IDLE_TIMEOUT_MS);
+	};
+
+	if (_http_server != nullptr)
+	{
+		_http_server->DisconnectIf(is_idle);
+	}
+
+	if (_https_server != nullptr)
+	{
+		_https_server->DisconnectIf(is_idle);
+	}
+}
+
+void SegmentStreamServer::SetKernelTlsEnabled(bool enabled)
+{
+	auto https_server = std::dynamic_pointer_cast<HttpsServer>(_https_server);
+
+	if (https_server != nullptr)
+	{
+		https_server->SetKernelTlsEnabled(enabled);
+	}
+}
+
 bool SegmentStreamServer::AddObserver(const std::shared_ptr<SegmentStreamObserver> &observer)
 {
 	// 기존에 등록된 observer가 있는지 확인
@@ -146,54 +188,43 @@ bool SegmentStreamServer::ParseRequestUrl(const ov::String &request_url,
 										  ov::String &file_name,
 										  ov::String &file_ext)
 {
-	ov::String request_path;
-	ov::String request_param;
+	// Find the tokens in place (without splitting the URL into the temporary strings)
+	std::string_view request_path(request_url.CStr(), request_url.GetLength());
 
-	// 확장자 확인
 	// 파라메터 분리  directory/file.ext?param=test
-	auto tokens = request_url.Split("?");
-	if (tokens.size() == 0)
+	auto param_index = request_path.find('?');
+	if (param_index != std::string_view::npos)
 	{
-		return false;
+		request_path = request_path.substr(0, param_index);
 	}
 
-	request_path = tokens[0];
-	request_param = tokens.size() == 2 ? tokens[1] : "";
-
 	// ...../app_name/stream_name/file_name.ext_name 분리
-	tokens.clear();
-	tokens = request_path.Split("/");
+	auto file_index = request_path.rfind('/');
+	auto stream_index = ((file_index == std::string_view::npos) || (file_index == 0)) ? std::string_view::npos : request_path.rfind('/', file_index - 1);
 
-	if (tokens.size() < 3)
+	if (stream_index == std::string_view::npos)
 	{
 		return false;
 	}
 
-	app_name = tokens[tokens.size() - 3];
-	stream_name = tokens[tokens.size() - 2];
-	file_name = tokens[tokens.size() - 1];
+	auto app_index = (stream_index == 0) ? std::string_view::npos : request_path.rfind('/', stream_index - 1);
+	// If there is no '/' in front of the app name, the app name starts from the beginning
+	auto app_start = (app_index == std::string_view::npos) ? 0 : (app_index + 1);
 
-	// file_name.ext_name 분리
-	tokens.clear();
-	tokens = file_name.Split(".");
+	auto file_name_view = request_path.substr(file_index + 1);
 
-	if (tokens.size() != 2)
+	// file_name.ext_name 분리 (file_name must have only one '.')
+	auto ext_index = file_name_view.find('.');
+
+	if ((ext_index == std::string_view::npos) || (file_name_view.find('.', ext_index + 1) != std::string_view::npos))
 	{
 		return false;
 	}
 
-	file_ext = tokens[1];
-
-	/*
-    logtd("request : %s\n"\
-         "request path : %s\n"\
-         "request param : %s\n"\
-         "app name : %s\n"\
-         "stream name : %s\n"\
-         "file name : %s\n"\
-         "file ext : %s\n",
-          request_url.CStr(), request_path.CStr(), request_param.CStr(),  app_name.CStr(), stream_name.CStr(), file_name.CStr(),file_ext.CStr());
-    */
+	app_name = ov::String(request_path.data() + app_start, stream_index - app_start);
+	stream_name = ov::String(request_path.data() + stream_index + 1, file_index - stream_index - 1);
+	file_name = ov::String(file_name_view.data(), file_name_view.length());
+	file_ext = ov::String(file_name_view.data() + ext_index + 1, file_name_view.length() - ext_index - 1);
 
 	return true;
 }
@@ -206,6 +237,10 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpClient> &clie
 	auto request = client->GetRequest();
 	HttpConnection connetion = HttpConnection::Closed;
 
+	// Keep the connection for the next requests if the client wants
+	bool keep_alive = request->IsKeepAliveRequested() &&
+					  ((client->GetCompletedRequestCount() + 1) < SEGMENT_KEEP_ALIVE_MAX_REQUEST_COUNT);
+
 	do
 	{
 		ov::String app_name;
@@ -216,6 +251,7 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpClient> &clie
 		// Set default headers
 		response->SetHeader("Server", "OvenMediaEngine");
 		response->SetHeader("Content-Type", "text/html");
+		response->SetHeader("Connection", keep_alive ? "keep-alive" : "close");
 
 		// Check crossdomains
 		if (request_target.IndexOf("crossdomain.xml") >= 0)
@@ -239,7 +275,15 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpClient> &clie
 			SetAllowOrigin(origin_url, response);
 		}
 
-		auto host_name = request->GetHeader("HOST").Split(":")[0];
+		// Exclude the port from the host ("<host>:<port>" or "[<IPv6 address>]:<port>")
+		auto host = request->GetHeaderView("Host");
+		auto port_index = host.rfind(':');
+		if ((port_index != std::string_view::npos) && (host.find(']', port_index) == std::string_view::npos))
+		{
+			host = host.substr(0, port_index);
+		}
+
+		ov::String host_name(host.data(), host.length());
 		auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(host_name, app_name);
 		SegmentStreamRequestInfo request_info(
 			vhost_app_name,
@@ -251,9 +295,18 @@ bool SegmentStreamServer::ProcessRequest(const std::shared_ptr<HttpClient> &clie
 	switch (connetion)
 	{
 		case HttpConnection::Closed:
+			// The response of the request is completed
+			if (keep_alive && (response->IsChunkedTransfer() == false))
+			{
+				// Send the response if it is not sent yet (error responses), and process the next request
+				response->Response();
+				return client->ProcessNextRequest() || response->Close();
+			}
+
 			return response->Close();
 
 		case HttpConnection::KeepAlive:
+			// The connection is used by the handler (such as LL-DASH chunked transfer)
 			return true;
 
 		default:
@@ -408,4 +461,35 @@ bool SegmentStreamServer::IncreaseBytesOut(const std::shared_ptr<HttpClient> &cl
 	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+uint32_t SegmentStreamServer::ResponsePlayList(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const PlayListItem> &play_list)
+{
+	auto response = client->GetResponse();
+
+	if (play_list->etag.IsEmpty())
+	{
+		response->SetHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+		response->SetHeader("Pragma", "no-cache");
+		response->SetHeader("Expires", "0");
+	}
+	else
+	{
+		// The playlist can be stored, but it must be revalidated for every request
+		response->SetHeader("Cache-Control", "no-cache");
+		response->SetHeader("ETag", play_list->etag);
+
+		auto if_none_match = client->GetRequest()->GetHeader("If-None-Match");
+
+		if ((if_none_match == "*") || (if_none_match.IndexOf(play_list->etag.CStr()) >= 0))
+		{
+			response->SetStatusCode(HttpStatusCode::NotModified);
+			return response->Response();
+		}
+	}
+
+	// The playlist data is shared by all responses
+	response->AppendData(play_list->data);
+
+	return response->Response();
+}
@@ -32,11 +32,18 @@ public:
 		int thread_count);
 	bool Stop();
 
+	// Limits the data queued for slow clients (must be called after Start())
+	bool SetSendQueueSize(size_t high_water_mark);
+	void SetKernelTlsEnabled(bool enabled);
+
 	bool AddObserver(const std::shared_ptr<SegmentStreamObserver> &observer);
 	bool RemoveObserver(const std::shared_ptr<SegmentStreamObserver> &observer);
 
 	bool Disconnect(const ov::String &app_name, const ov::String &stream_name);
 
+	// Closes the keep-alive connections which do not send the next request in SEGMENT_KEEP_ALIVE_IDLE_TIMEOUT_MS
+	void DisconnectIdleClients();
+
 	void SetCrossDomain(const std::vector<ov::String> &url_list);
 
 	virtual PublisherType GetPublisherType() const noexcept = 0;
@@ -74,6 +81,9 @@ protected:
 
 	bool IncreaseBytesOut(const std::shared_ptr<HttpClient> &client, size_t sent_bytes);
 
+	// Sends the playlist, or "304 Not Modified" if the client already has the same version of the playlist
+	uint32_t ResponsePlayList(const std::shared_ptr<HttpClient> &client, const std::shared_ptr<const PlayListItem> &play_list);
+
 protected:
 	std::shared_ptr<HttpServer> _http_server;
 	std::shared_ptr<HttpServer> _https_server;
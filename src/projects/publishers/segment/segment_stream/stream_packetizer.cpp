@@ -49,3 +49,24 @@ bool StreamPacketizer::AppendAudioData(const std::shared_ptr<MediaPacket> &media
 
 	return true;
 }
+
+void StreamPacketizer::SetSegmentMemoryBudget(size_t memory_budget)
+{
+	if (_packetizer != nullptr)
+	{
+		_packetizer->SetSegmentMemoryBudget(memory_budget);
+	}
+}
+
+size_t StreamPacketizer::GetSegmentBytes() const
+{
+	return (_packetizer != nullptr) ? _packetizer->GetSegmentBytes() : 0;
+}
+
+void StreamPacketizer::EnableDvr(const ov::String &directory, int64_t duration_in_ms)
+{
+	if (_packetizer != nullptr)
+	{
+		_packetizer->EnableDvr(directory, duration_in_ms);
+	}
+}
@@ -49,9 +49,13 @@ public:
 	virtual bool AppendVideoFrame(std::shared_ptr<PacketizerFrameData> &dEncodedFrameata) = 0;
 	virtual bool AppendAudioFrame(std::shared_ptr<PacketizerFrameData> &data) = 0;
 
-	virtual bool GetPlayList(ov::String &play_list) = 0;
+	virtual bool GetPlayList(std::shared_ptr<const PlayListItem> &play_list) = 0;
 	virtual std::shared_ptr<const SegmentItem> GetSegmentData(const ov::String &file_name) const = 0;
 
+	void SetSegmentMemoryBudget(size_t memory_budget);
+	size_t GetSegmentBytes() const;
+	void EnableDvr(const ov::String &directory, int64_t duration_in_ms);
+
 protected:
 	std::shared_ptr<Packetizer> _packetizer = nullptr;
 
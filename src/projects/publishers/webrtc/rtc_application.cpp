@@ -3,6 +3,8 @@
 
 #include "modules/ice/ice_port_manager.h"
 
+#include <algorithm>
+
 
 std::shared_ptr<RtcApplication> RtcApplication::Create(const std::shared_ptr<pub::Publisher> &publisher, 
 													   const info::Application &application_info,
@@ -35,6 +37,85 @@ std::shared_ptr<Certificate> RtcApplication::GetCertificate()
 	return _certificate;
 }
 
+std::vector<std::shared_ptr<RtcStream>> RtcApplication::GetRenditions(const std::shared_ptr<RtcStream> &stream)
+{
+	std::vector<std::shared_ptr<RtcStream>> renditions;
+
+	auto origin_stream = stream->GetOriginStream();
+	if(origin_stream == nullptr)
+	{
+		return renditions;
+	}
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_map_mutex);
+
+		for(const auto &item : _streams)
+		{
+			auto rendition = std::static_pointer_cast<RtcStream>(item.second);
+			auto rendition_origin_stream = rendition->GetOriginStream();
+
+			if((rendition_origin_stream == nullptr) || (rendition_origin_stream->GetId() != origin_stream->GetId()))
+			{
+				continue;
+			}
+
+			if((rendition->GetState() != pub::Stream::State::STARTED) || (rendition->GetVideoBitrate() <= 0))
+			{
+				continue;
+			}
+
+			if((rendition != stream) && (IsCompatibleRendition(stream, rendition) == false))
+			{
+				continue;
+			}
+
+			renditions.push_back(rendition);
+		}
+	}
+
+	std::sort(renditions.begin(), renditions.end(), [](const std::shared_ptr<RtcStream> &a, const std::shared_ptr<RtcStream> &b) {
+		return a->GetVideoBitrate() < b->GetVideoBitrate();
+	});
+
+	return renditions;
+}
+
+bool RtcApplication::IsCompatibleRendition(const std::shared_ptr<RtcStream> &stream, const std::shared_ptr<RtcStream> &rendition)
+{
+	// The payload types negotiated with the viewer must be used as they are
+	const auto &media_list = stream->GetSessionDescription()->GetMediaList();
+	const auto &rendition_media_list = rendition->GetSessionDescription()->GetMediaList();
+
+	if(media_list.size() != rendition_media_list.size())
+	{
+		return false;
+	}
+
+	for(size_t i = 0; i < media_list.size(); i++)
+	{
+		auto &media_desc = media_list[i];
+		auto &rendition_media_desc = rendition_media_list[i];
+
+		if(media_desc->GetMediaType() != rendition_media_desc->GetMediaType())
+		{
+			return false;
+		}
+
+		auto payload = media_desc->GetFirstPayload();
+		auto rendition_payload = rendition_media_desc->GetFirstPayload();
+
+		if((payload == nullptr) || (rendition_payload == nullptr) ||
+		   (payload->GetId() != rendition_payload->GetId()) ||
+		   (payload->GetCodec() != rendition_payload->GetCodec()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 std::shared_ptr<pub::Stream> RtcApplication::CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t worker_count)
 {
 	// Stream Class 생성할때는 복사를 사용한다.
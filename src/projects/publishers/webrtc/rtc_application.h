@@ -26,6 +26,12 @@ public:
 
 	std::shared_ptr<Certificate> GetCertificate();
 
+	// Returns the started streams which are encoded from the same source as the stream (including itself),
+	// in ascending order of the video bitrate.
+	// The streams which have a different media layout or no video bitrate are excluded,
+	// since a session cannot switch to them without renegotiation.
+	std::vector<std::shared_ptr<RtcStream>> GetRenditions(const std::shared_ptr<RtcStream> &stream);
+
 private:
 	bool Start() override;
 	bool Stop() override;
@@ -34,6 +40,8 @@ private:
 	std::shared_ptr<pub::Stream> CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t worker_count) override;
 	bool DeleteStream(const std::shared_ptr<info::Stream> &info) override;
 
+	static bool IsCompatibleRendition(const std::shared_ptr<RtcStream> &stream, const std::shared_ptr<RtcStream> &rendition);
+
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<RtcSignallingServer> _rtc_signalling;
 	std::shared_ptr<Certificate> _certificate;
@@ -1,3 +1,11 @@
 #pragma once
 
 #define OV_LOG_TAG                      "WebRTC"
+
+// Maximum number of threads which process the pacers of the sessions (sharded by the session id)
+#define RTC_PACER_MAX_THREAD_COUNT		16
+
+// ABR: Uses up to 70% of the estimated bandwidth for the video of the rendition
+#define RTC_ABR_BITRATE_USAGE_PERCENT	70
+// ABR: Switches to a higher rendition only when the last switch is older than this
+#define RTC_ABR_SWITCH_UP_HOLD_MS		10000
@@ -6,6 +6,11 @@
 #include "rtc_stream.h"
 
 #include "modules/rtp_rtcp/rtcp_info/nack.h"
+#include "modules/rtp_rtcp/rtcp_info/receiver_report.h"
+#include "modules/rtp_rtcp/rtcp_info/remb.h"
+#include "modules/rtp_rtcp/rtx_rtp_packet.h"
+
+#include <base/ovlibrary/byte_io.h>
 
 #include <utility>
 
@@ -35,7 +40,10 @@ RtcSession::RtcSession(const info::Session &session_info,
 					   const std::shared_ptr<const SessionDescription> &peer_sdp,
 					   const std::shared_ptr<IcePort> &ice_port,
 					   const std::shared_ptr<WebSocketClient> &ws_client)
-	: Session(session_info, application, stream)
+	: Session(session_info, application, stream),
+	  _pacer([this](const std::shared_ptr<RtpPacket> &packet) -> bool {
+		  return _rtp_rtcp->SendOutgoingData(packet);
+	  })
 {
 	_publisher = publisher;
 	_offer_sdp = offer_sdp;
@@ -149,6 +157,11 @@ bool RtcSession::Start()
 	_dtls_ice_transport->RegisterLowerNode(nullptr);
 	_dtls_ice_transport->Start();
 
+	_pacer.SetTargetBitrate(_bandwidth_estimator.GetEstimatedBitrate());
+
+	_abr_enabled = application->GetConfig().GetPublishers().GetWebrtcPublisher().IsAbrEnabled();
+	_current_rendition = std::static_pointer_cast<RtcStream>(GetStream());
+
 	return Session::Start();
 }
 
@@ -164,6 +177,8 @@ bool RtcSession::Stop()
 		return true;
 	}
 
+	_pacer.Clear();
+
 	if(_rtp_rtcp != nullptr)
 	{
 		_rtp_rtcp->Stop();
@@ -187,7 +202,15 @@ bool RtcSession::Stop()
 	// TODO(Getroot): Doesn't need this?
 	//_ws_client->Close();
 
-	return Session::Stop();
+	auto result = Session::Stop();
+
+	// Unsubscribe from the renditions (Stop() is also called in the destructor, there is no subscription then)
+	if(_abr_enabled && IsSharedPtr())
+	{
+		_publisher->UpdateRenditionSubscriptions(GetSharedPtrAs<RtcSession>());
+	}
+
+	return result;
 }
 
 void RtcSession::SetSessionExpiredTime(uint64_t expired_time)
@@ -285,9 +308,67 @@ bool RtcSession::SendOutgoingData(const std::any &packet)
 		}
 	}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
-	return _rtp_rtcp->SendOutgoingData(copy_packet);
+	auto priority = (rtp_payload_type == _audio_payload_type) ? SendPriority::Immediate : SendPriority::Paced;
+
+	if(_abr_enabled)
+	{
+		// The packets of the renditions are received on the threads of their streams.
+		// They are rewritten and sent (or queued to the pacer) under the same lock,
+		// so the rewritten sequence numbers go out in order and RtpRtcp is not used by two threads at once.
+		std::lock_guard<std::mutex> lock(_abr_mutex);
+
+		// Only the packets of the current rendition are sent
+		session_packet = ProcessRendition(session_packet);
+		if(session_packet == nullptr)
+		{
+			return false;
+		}
+
+		return SendRtpPacket(session_packet, priority);
+	}
+
+	// The packet is shared by all sessions of the stream.
+	// SrtpTransport encrypts it in its own buffer, so it doesn't need to be copied here.
+	return SendRtpPacket(session_packet, priority);
+}
+
+bool RtcSession::SendRtpPacket(const std::shared_ptr<RtpPacket> &packet, SendPriority priority)
+{
+	if(priority == SendPriority::Immediate)
+	{
+		return _rtp_rtcp->SendOutgoingData(packet);
+	}
+
+	_pacer.Enqueue(packet, priority == SendPriority::Retransmission);
+
+	if(_pacer.Process())
+	{
+		_publisher->SchedulePacer(GetSharedPtrAs<RtcSession>());
+	}
+
+	return true;
+}
+
+void RtcSession::ProcessPacer()
+{
+	//It must not be called during start and stop.
+	std::shared_lock<std::shared_mutex> lock(_start_stop_lock);
+
+	if(GetState() != SessionState::Started)
+	{
+		_pacer.Clear();
+		return;
+	}
+
+	if(_pacer.Process())
+	{
+		_publisher->SchedulePacer(GetSharedPtrAs<RtcSession>());
+	}
+}
+
+uint64_t RtcSession::GetEstimatedBitrate() const
+{
+	return _bandwidth_estimator.GetEstimatedBitrate();
 }
 
 void RtcSession::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
@@ -299,7 +380,7 @@ void RtcSession::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
 
 	if(rtcp_info->GetPacketType() == RtcpPacketType::RR)
 	{
-		// Process
+		ProcessReceiverReport(rtcp_info);
 	}
 	else if(rtcp_info->GetPacketType() == RtcpPacketType::RTPFB)
 	{
@@ -309,6 +390,13 @@ void RtcSession::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
 			ProcessNACK(rtcp_info);
 		}
 	}
+	else if(rtcp_info->GetPacketType() == RtcpPacketType::PSFB)
+	{
+		if(rtcp_info->GetFmt() == static_cast<uint8_t>(PSFBFMT::AFB))
+		{
+			ProcessREMB(rtcp_info);
+		}
+	}
 
 	rtcp_info->DebugPrint();
 }
@@ -333,19 +421,312 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
+	// The viewer requests the sequence numbers of this session, which are rewritten from the current rendition
+	SequenceRewriter video_rewriter;
+	if(_abr_enabled)
+	{
+		std::lock_guard<std::mutex> lock(_abr_mutex);
+		stream = _current_rendition;
+		video_rewriter = _video_rewriter;
+	}
+
 	// Retransmission
 	for(size_t i=0; i<nack->GetLostIdCount(); i++)
 	{
 		auto seq_no = nack->GetLostId(i);
-		auto packet = stream->GetRtxRtpPacket(_video_payload_type, seq_no);
+
+		if(_abr_enabled && video_rewriter.IsSentBeforeSwitch(seq_no))
+		{
+			// The packet of the previous rendition
+			continue;
+		}
+
+		auto packet = stream->GetRtxRtpPacket(_video_payload_type, static_cast<uint16_t>(seq_no - video_rewriter.offset));
 		if(packet != nullptr)
 		{
 			logd("RTCP", "Send RTX packet : %u/%u", _video_payload_type, seq_no);
 			auto copy_packet = std::make_shared<RtpPacket>(*(std::dynamic_pointer_cast<RtpPacket>(packet)));
 			copy_packet->SetSequenceNumber(_rtx_sequence_number++);
-			return _rtp_rtcp->SendOutgoingData(copy_packet);
+
+			if(_abr_enabled)
+			{
+				// RTX SSRC and OSN of the rendition -> of this session
+				copy_packet->SetSsrc(_video_rtx_ssrc);
+				ByteWriter<uint16_t>::WriteBigEndian(&copy_packet->Header()[copy_packet->HeadersSize() - RTX_HEADER_SIZE], seq_no);
+			}
+
+			return SendRtpPacket(copy_packet, SendPriority::Retransmission);
+		}
+	}
+
+	return true;
+}
+
+bool RtcSession::ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info)
+{
+	auto receiver_report = std::dynamic_pointer_cast<ReceiverReport>(rtcp_info);
+	if(receiver_report == nullptr)
+	{
+		return false;
+	}
+
+	for(size_t i=0; i<receiver_report->GetReportBlockCount(); i++)
+	{
+		auto report_block = receiver_report->GetReportBlock(i);
+
+		// The video stream takes most of the bandwidth, so the loss of it is used to estimate
+		if((report_block != nullptr) && (report_block->GetSrcSsrc() == _video_ssrc))
+		{
+			_bandwidth_estimator.OnReceiverReport(report_block->GetFractionLost());
+			OnEstimatedBitrateUpdated();
 		}
 	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool RtcSession::ProcessREMB(const std::shared_ptr<RtcpInfo> &rtcp_info)
+{
+	auto remb = std::dynamic_pointer_cast<REMB>(rtcp_info);
+	if(remb == nullptr)
+	{
+		return false;
+	}
+
+	_bandwidth_estimator.OnRemb(remb->GetBitrate());
+	OnEstimatedBitrateUpdated();
+
+	return true;
+}
+
+void RtcSession::OnEstimatedBitrateUpdated()
+{
+	auto estimated_bitrate = _bandwidth_estimator.GetEstimatedBitrate();
+
+	_pacer.SetTargetBitrate(estimated_bitrate);
+
+	if(GetState() != SessionState::Started)
+	{
+		// The entry of the session is removed from the metrics when it is stopped
+		return;
+	}
+
+	auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(GetStream()));
+	if(stream_metrics != nullptr)
+	{
+		stream_metrics->SetEstimatedBitrate(GetId(), estimated_bitrate);
+	}
+
+	logtd("Estimated bitrate of session(%u) : %" PRIu64 " bps", GetId(), estimated_bitrate);
+
+	if(_abr_enabled)
+	{
+		SelectRendition(estimated_bitrate);
+	}
+}
+
+void RtcSession::SelectRendition(uint64_t estimated_bitrate)
+{
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	auto application = std::static_pointer_cast<RtcApplication>(GetApplication());
+	auto renditions = application->GetRenditions(stream);
+
+	// The highest rendition in the available bitrate, or the lowest one if there is no such rendition
+	uint64_t available_bitrate = estimated_bitrate * RTC_ABR_BITRATE_USAGE_PERCENT / 100;
+	std::shared_ptr<RtcStream> candidate;
+
+	for(const auto &rendition : renditions)
+	{
+		if((candidate == nullptr) || (static_cast<uint64_t>(rendition->GetVideoBitrate()) <= available_bitrate))
+		{
+			candidate = rendition;
+		}
+	}
+
+	if(candidate == nullptr)
+	{
+		// There is no rendition to switch to
+		candidate = stream;
+	}
+
+	std::lock_guard<std::mutex> lock(_abr_mutex);
+
+	bool is_current_available = std::find(renditions.begin(), renditions.end(), _current_rendition) != renditions.end();
+
+	if(is_current_available && (candidate != _current_rendition))
+	{
+		auto current_bitrate = static_cast<uint64_t>(_current_rendition->GetVideoBitrate());
+		auto candidate_bitrate = static_cast<uint64_t>(candidate->GetVideoBitrate());
+
+		if(candidate_bitrate < current_bitrate)
+		{
+			// Keeps the current rendition while the viewer can receive it
+			if(current_bitrate <= estimated_bitrate)
+			{
+				candidate = _current_rendition;
+			}
+		}
+		else if((ov::Clock::NowMSec() - _last_switch_time) < RTC_ABR_SWITCH_UP_HOLD_MS)
+		{
+			// Switches up only when the estimation is kept for a while
+			candidate = _current_rendition;
+		}
+	}
+
+	if(candidate == _current_rendition)
+	{
+		if(_pending_rendition != nullptr)
+		{
+			// Cancel the switching
+			_pending_rendition = nullptr;
+			_publisher->UpdateRenditionSubscriptions(GetSharedPtrAs<RtcSession>());
+		}
+
+		return;
+	}
+
+	if(candidate == _pending_rendition)
+	{
+		// Waiting for the key frame
+		return;
+	}
+
+	logtd("Session(%u) will switch from %s to %s (estimated bitrate : %" PRIu64 " bps)",
+		  GetId(), _current_rendition->GetName().CStr(), candidate->GetName().CStr(), estimated_bitrate);
+
+	_pending_rendition = candidate;
+	_publisher->UpdateRenditionSubscriptions(GetSharedPtrAs<RtcSession>());
+}
+
+std::shared_ptr<RtpPacket> RtcSession::ProcessRendition(const std::shared_ptr<RtpPacket> &packet)
+{
+	bool is_audio = (packet->PayloadType() == _audio_payload_type);
+
+	// Switches at the key frame of the pending rendition, so the viewer can decode it from the first packet
+	if((_pending_rendition != nullptr) && (is_audio == false) &&
+	   packet->IsKeyframeStart() && (packet->Ssrc() == _pending_rendition->GetVideoSsrc()))
+	{
+		logtd("Session(%u) switched from %s to %s", GetId(), _current_rendition->GetName().CStr(), _pending_rendition->GetName().CStr());
+
+		_current_rendition = _pending_rendition;
+		_pending_rendition = nullptr;
+		_last_switch_time = ov::Clock::NowMSec();
+
+		_video_rewriter.resync = true;
+		_video_rewriter.sent_count = 0;
+		_audio_rewriter.resync = true;
+		_audio_rewriter.sent_count = 0;
+
+		// Unsubscribe from the previous rendition
+		_publisher->UpdateRenditionSubscriptions(GetSharedPtrAs<RtcSession>());
+	}
+
+	if(is_audio)
+	{
+		if(packet->Ssrc() != _current_rendition->GetAudioSsrc())
+		{
+			return nullptr;
+		}
+
+		return RewritePacket(packet, _audio_ssrc, _audio_rewriter);
+	}
+
+	if(packet->Ssrc() != _current_rendition->GetVideoSsrc())
+	{
+		return nullptr;
+	}
+
+	return RewritePacket(packet, _video_ssrc, _video_rewriter);
+}
+
+std::shared_ptr<RtpPacket> RtcSession::RewritePacket(const std::shared_ptr<RtpPacket> &packet, uint32_t ssrc, SequenceRewriter &rewriter)
+{
+	if(rewriter.resync)
+	{
+		// Continues the sequence number sent to the viewer
+		rewriter.offset = static_cast<uint16_t>(rewriter.last_sequence_number + 1 - packet->SequenceNumber());
+		rewriter.resync = false;
+	}
+
+	uint16_t sequence_number = packet->SequenceNumber() + rewriter.offset;
+	std::shared_ptr<RtpPacket> rewritten_packet = packet;
+
+	if((rewriter.offset != 0) || (packet->Ssrc() != ssrc))
+	{
+		// The packet is shared by all sessions of the rendition
+		rewritten_packet = std::make_shared<RtpPacket>(*packet);
+		rewritten_packet->SetSsrc(ssrc);
+		rewritten_packet->SetSequenceNumber(sequence_number);
+
+		// RED + ULPFEC: SN base of the FEC header is also rewritten
+		if(packet->IsUlpfec())
+		{
+			auto sn_base = &rewritten_packet->Payload()[RED_HEADER_SIZE + 2];
+			uint16_t rewritten_sn_base = ByteReader<uint16_t>::ReadBigEndian(sn_base) + rewriter.offset;
+
+			if(rewriter.IsSentBeforeSwitch(rewritten_sn_base))
+			{
+				// Protects the packets which are not sent to the viewer
+				return nullptr;
+			}
+
+			ByteWriter<uint16_t>::WriteBigEndian(sn_base, rewritten_sn_base);
+		}
+	}
+
+	rewriter.last_sequence_number = sequence_number;
+	rewriter.sent_count = std::min<uint32_t>(rewriter.sent_count + 1, 0xFFFF);
+
+	return rewritten_packet;
+}
+
+void RtcSession::UpdateRenditionSubscriptions()
+{
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	std::vector<std::shared_ptr<RtcStream>> renditions;
+
+	{
+		std::lock_guard<std::mutex> lock(_abr_mutex);
+
+		if(GetState() == SessionState::Started)
+		{
+			// The packets of the stream of the session are always received
+			for(const auto &rendition : {_current_rendition, _pending_rendition})
+			{
+				if((rendition != nullptr) && (rendition != stream))
+				{
+					renditions.push_back(rendition);
+				}
+			}
+		}
+	}
+
+	for(auto it = _subscribed_renditions.begin(); it != _subscribed_renditions.end();)
+	{
+		if(std::find(renditions.begin(), renditions.end(), *it) == renditions.end())
+		{
+			(*it)->RemoveSubscriber(GetId());
+			it = _subscribed_renditions.erase(it);
+		}
+		else
+		{
+			it++;
+		}
+	}
+
+	for(const auto &rendition : renditions)
+	{
+		if(std::find(_subscribed_renditions.begin(), _subscribed_renditions.end(), rendition) != _subscribed_renditions.end())
+		{
+			continue;
+		}
+
+		if(rendition->AddSubscriber(GetSharedPtrAs<pub::Session>()) == false)
+		{
+			logtw("Session(%u) could not subscribe to %s", GetId(), rendition->GetName().CStr());
+			continue;
+		}
+
+		_subscribed_renditions.push_back(rendition);
+	}
+}
@@ -8,6 +8,8 @@
 #include "modules//dtls_srtp/dtls_ice_transport.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
 #include "modules/rtp_rtcp/rtp_rtcp_interface.h"
+#include "modules/rtp_rtcp/rtp_pacer.h"
+#include "modules/rtp_rtcp/bandwidth_estimator.h"
 #include "modules/dtls_srtp/dtls_transport.h"
 #include <unordered_set>
 
@@ -69,8 +71,66 @@ public:
 
 	void OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info);
 
+	// Sends the packets queued in the pacer (called by the publisher while packets remain)
+	void ProcessPacer();
+
+	// Estimated bandwidth to the viewer (bps)
+	uint64_t GetEstimatedBitrate() const;
+
+	// Subscribes to/unsubscribes from the renditions the session needs for ABR.
+	// Called on the message thread of the publisher, since it cannot be called while the streams are sending packets.
+	void UpdateRenditionSubscriptions();
+
 private:
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
+	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
+	bool ProcessREMB(const std::shared_ptr<RtcpInfo> &rtcp_info);
+	void OnEstimatedBitrateUpdated();
+
+	//--------------------------------------------------------------------
+	// ABR (Switching to another rendition of the same source)
+	//--------------------------------------------------------------------
+	// The RTP timestamps of the renditions are the same since they come from the same source,
+	// so only the SSRC and the sequence number are rewritten into the spaces of this session.
+	struct SequenceRewriter
+	{
+		uint16_t offset = 0;
+		uint16_t last_sequence_number = 0;
+		// Number of the packets sent since the last switch (up to 0xFFFF)
+		uint32_t sent_count = 0;
+		// Set when switched, to continue the sequence number at the next packet
+		bool resync = false;
+
+		// Whether the (rewritten) sequence number was sent before the last switch
+		bool IsSentBeforeSwitch(uint16_t sequence_number) const
+		{
+			if(sent_count >= 0x8000)
+			{
+				return false;
+			}
+
+			return static_cast<uint16_t>(last_sequence_number - sequence_number) >= sent_count;
+		}
+	};
+
+	// Selects the rendition to switch to by the estimated bitrate
+	void SelectRendition(uint64_t estimated_bitrate);
+	// Returns the packet to send to the viewer (nullptr if it must not be sent)
+	// Must be called while _abr_mutex is locked
+	std::shared_ptr<RtpPacket> ProcessRendition(const std::shared_ptr<RtpPacket> &packet);
+	std::shared_ptr<RtpPacket> RewritePacket(const std::shared_ptr<RtpPacket> &packet, uint32_t ssrc, SequenceRewriter &rewriter);
+
+	enum class SendPriority
+	{
+		// Audio packets are sent immediately
+		Immediate,
+		// Video packets are sent through the pacer
+		Paced,
+		// Retransmissions are sent through the pacer before the queued video packets
+		Retransmission
+	};
+
+	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet, SendPriority priority);
 
 	std::shared_ptr<WebRtcPublisher>	_publisher;
 
@@ -97,5 +157,20 @@ private:
 
 	uint64_t							_session_expired_time = 0;
 
+	BandwidthEstimator					_bandwidth_estimator;
+	RtpPacer							_pacer;
+
+	bool								_abr_enabled = false;
+	std::mutex							_abr_mutex;
+	// The stream of the session until switched
+	std::shared_ptr<RtcStream>			_current_rendition;
+	// The rendition to switch to at the next key frame
+	std::shared_ptr<RtcStream>			_pending_rendition;
+	uint64_t							_last_switch_time = 0;
+	SequenceRewriter					_video_rewriter;
+	SequenceRewriter					_audio_rewriter;
+	// Accessed only in UpdateRenditionSubscriptions()
+	std::vector<std::shared_ptr<RtcStream>>	_subscribed_renditions;
+
 	std::shared_mutex					_start_stop_lock;
 };
\ No newline at end of file
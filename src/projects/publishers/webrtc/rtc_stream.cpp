@@ -206,6 +206,9 @@ bool RtcStream::Start()
 
 				payload->SetRtpmap(payload_type_num++, codec, 90000);
 
+				// Receives the estimated bandwidth of the viewer for pacing
+				payload->EnableRtcpFb(PayloadAttr::RtcpFbType::GoogRemb, true);
+
 				if (_rtx_enabled == true)
 				{
 					payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
@@ -293,11 +296,15 @@ bool RtcStream::Start()
 		}
 	}
 
+	_video_ssrc = (video_media_desc != nullptr) ? video_media_desc->GetSsrc() : 0;
+	_audio_ssrc = (audio_media_desc != nullptr) ? audio_media_desc->GetSsrc() : 0;
+
 	if (video_media_desc && _ulpfec_enabled == true)
 	{
 		// RED & ULPFEC
 		auto red_payload = std::make_shared<PayloadAttr>();
 		red_payload->SetRtpmap(RED_PAYLOAD_TYPE, "red", 90000);
+		red_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::GoogRemb, true);
 		if (_rtx_enabled == true)
 		{
 			red_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
@@ -540,6 +547,31 @@ void RtcStream::AddPacketizer(cmn::MediaCodecId codec_id, uint32_t id, uint8_t p
 	_packetizers[id] = packetizer;
 }
 
+uint32_t RtcStream::GetVideoSsrc() const
+{
+	return _video_ssrc;
+}
+
+uint32_t RtcStream::GetAudioSsrc() const
+{
+	return _audio_ssrc;
+}
+
+int32_t RtcStream::GetVideoBitrate() const
+{
+	for (const auto &track_item : GetTracks())
+	{
+		const auto &track = track_item.second;
+
+		if (track->GetMediaType() == MediaType::Video)
+		{
+			return track->GetBitrate();
+		}
+	}
+
+	return 0;
+}
+
 std::shared_ptr<RtpPacketizer> RtcStream::GetPacketizer(uint32_t id)
 {
 	std::shared_lock<std::shared_mutex> lock(_packetizers_lock);
@@ -30,6 +30,12 @@ public:
 
 	std::shared_ptr<SessionDescription> GetSessionDescription();
 
+	// SSRCs in the offer SDP (0 if there is no such media)
+	uint32_t GetVideoSsrc() const;
+	uint32_t GetAudioSsrc() const;
+	// Configured bitrate of the video track (0 if unknown)
+	int32_t GetVideoBitrate() const;
+
 	void SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
 	void SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
 
@@ -66,6 +72,9 @@ private:
 
 	std::shared_ptr<mon::StreamMetrics>		_stream_metrics;
 
+	uint32_t _video_ssrc = 0;
+	uint32_t _audio_ssrc = 0;
+
 	bool _rtx_enabled = true;
 	bool _ulpfec_enabled = true;
 	uint32_t _worker_count = 0;
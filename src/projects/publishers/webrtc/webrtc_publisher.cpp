@@ -148,6 +148,37 @@ bool WebRtcPublisher::Start()
 
 	_timer.Start();
 
+	auto pacer_thread_count = std::clamp(std::thread::hardware_concurrency(), 1U, static_cast<unsigned int>(RTC_PACER_MAX_THREAD_COUNT));
+
+	for (unsigned int index = 0; index < pacer_thread_count; index++)
+	{
+		auto shard = std::make_unique<PacerShard>();
+		auto shard_ptr = shard.get();
+
+		shard->timer.Push(
+			[shard_ptr](void *parameter) -> ov::DelayQueueAction {
+				std::unordered_set<std::shared_ptr<RtcSession>> pacer_sessions;
+
+				{
+					std::lock_guard<std::mutex> lock_guard(shard_ptr->sessions_mutex);
+					pacer_sessions.swap(shard_ptr->sessions);
+				}
+
+				// The session schedules itself again if packets still remain
+				for (auto &session : pacer_sessions)
+				{
+					session->ProcessPacer();
+				}
+
+				return ov::DelayQueueAction::Repeat;
+			},
+			RTP_PACER_PROCESS_INTERVAL_MS);
+
+		shard->timer.Start();
+
+		_pacer_shards.push_back(std::move(shard));
+	}
+
 	return Publisher::Start();
 }
 
@@ -160,6 +191,14 @@ bool WebRtcPublisher::Stop()
 
 	_message_thread.Stop();
 
+	for (auto &shard : _pacer_shards)
+	{
+		shard->timer.Stop();
+
+		std::lock_guard<std::mutex> lock_guard(shard->sessions_mutex);
+		shard->sessions.clear();
+	}
+
 	return Publisher::Stop();
 }
 
@@ -174,19 +213,44 @@ bool WebRtcPublisher::DisconnectSession(const std::shared_ptr<RtcSession> &sessi
 	return true;
 }
 
+void WebRtcPublisher::SchedulePacer(const std::shared_ptr<RtcSession> &session)
+{
+	if (_pacer_shards.empty())
+	{
+		return;
+	}
+
+	auto &shard = _pacer_shards[session->GetId() % _pacer_shards.size()];
+
+	std::lock_guard<std::mutex> lock_guard(shard->sessions_mutex);
+	shard->sessions.insert(session);
+}
+
+void WebRtcPublisher::UpdateRenditionSubscriptions(const std::shared_ptr<RtcSession> &session)
+{
+	auto message = std::make_shared<ov::CommonMessage>();
+	message->_code = static_cast<uint32_t>(MessageCode::UPDATE_RENDITION_SUBSCRIPTIONS);
+	message->_message = std::make_any<std::shared_ptr<RtcSession>>(session);
+
+	_message_thread.PostMessage(message);
+}
+
 bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession> &session)
 {
 	auto stream = std::dynamic_pointer_cast<RtcStream>(session->GetStream());
 
 	stream->RemoveSession(session->GetId());
+
+	// The session does not update the estimated bitrate after it is stopped
+	session->Stop();
+
 	auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(stream));
 	if (stream_metrics != nullptr)
 	{
 		stream_metrics->OnSessionDisconnected(PublisherType::Webrtc);
+		stream_metrics->RemoveEstimatedBitrate(session->GetId());
 	}
 
-	session->Stop();
-
 	// Special purpose log
 	stat_log(STAT_LOG_WEBRTC_EDGE_SESSION, "%s,%s,%s,%s,,,%s,%s,%u",
 					ov::Clock::Now().CStr(),
@@ -254,6 +318,24 @@ void WebRtcPublisher::OnMessage(const std::shared_ptr<ov::CommonMessage> &messag
 			return;
 		}
 	}
+	else if(code == MessageCode::UPDATE_RENDITION_SUBSCRIPTIONS)
+	{
+		try 
+		{
+			auto session = std::any_cast<std::shared_ptr<RtcSession>>(message->_message);
+			if(session == nullptr)
+			{
+				return;
+			}
+
+			session->UpdateRenditionSubscriptions();
+		}
+		catch(const std::bad_any_cast& e) 
+		{
+			logtc("Wrong message!");
+			return;
+		}
+	}
 }
 
 std::shared_ptr<pub::Application> WebRtcPublisher::OnCreatePublisherApplication(const info::Application &application_info)
@@ -7,6 +7,7 @@
 #include "base/ovlibrary/delay_queue.h"
 #include "rtc_application.h"
 #include <orchestrator/orchestrator.h>
+#include <unordered_set>
 
 class WebRtcPublisher : public pub::Publisher,
                         public IcePortObserver,
@@ -22,6 +23,14 @@ public:
 	bool Stop() override;
 	bool DisconnectSession(const std::shared_ptr<RtcSession> &session);
 
+	// Called by the session when packets remain in its pacer.
+	// The pacer of the session is processed after RTP_PACER_PROCESS_INTERVAL_MS by the pacer thread of the session's shard.
+	void SchedulePacer(const std::shared_ptr<RtcSession> &session);
+
+	// Called by the session when the renditions it needs are changed (ABR).
+	// The subscriptions are updated in the message thread, since they cannot be changed while the streams are sending packets.
+	void UpdateRenditionSubscriptions(const std::shared_ptr<RtcSession> &session);
+
 	// MessageThread Implementation
 	void OnMessage(const std::shared_ptr<ov::CommonMessage> &message) override;
 
@@ -55,6 +64,7 @@ private:
 	enum class MessageCode : uint32_t
 	{
 		DISCONNECT_SESSION = 1,
+		UPDATE_RENDITION_SUBSCRIPTIONS,
 	};
 
 	enum class RequestStreamResult : int8_t
@@ -93,4 +103,14 @@ private:
 
 	// for special purpose log
 	ov::DelayQueue _timer;
+
+	// Sessions which have packets in their pacer.
+	// The sessions are sharded by the id, so SRTP and sending of the queued packets are spread over the threads.
+	struct PacerShard
+	{
+		std::mutex sessions_mutex;
+		std::unordered_set<std::shared_ptr<RtcSession>> sessions;
+		ov::DelayQueue timer;
+	};
+	std::vector<std::unique_ptr<PacerShard>> _pacer_shards;
 };
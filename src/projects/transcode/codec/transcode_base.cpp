@@ -7,3 +7,108 @@
 //
 //==============================================================================
 #include "transcode_base.h"
+
+#include "../transcode_private.h"
+
+std::shared_ptr<MediaFrame> TranscodeFrame::FromAVFrame(AVFrame *av_frame)
+{
+	auto descriptor = ::av_pix_fmt_desc_get(static_cast<AVPixelFormat>(av_frame->format));
+
+	if (descriptor == nullptr)
+	{
+		logte("Unknown pixel format: %d", av_frame->format);
+		return nullptr;
+	}
+
+	auto frame_holder = std::shared_ptr<AVFrame>(::av_frame_alloc(), [](AVFrame *frame) {
+		::av_frame_free(&frame);
+	});
+
+	if (frame_holder == nullptr)
+	{
+		logte("Could not allocate the video frame");
+		return nullptr;
+	}
+
+	::av_frame_move_ref(frame_holder.get(), av_frame);
+
+	auto frame = std::make_shared<MediaFrame>();
+
+	frame->SetMediaType(cmn::MediaType::Video);
+	frame->SetWidth(frame_holder->width);
+	frame->SetHeight(frame_holder->height);
+	frame->SetFormat(frame_holder->format);
+	frame->SetPts((frame_holder->pts == AV_NOPTS_VALUE) ? -1LL : frame_holder->pts);
+	frame->SetDuration(frame_holder->pkt_duration);
+
+	const uint8_t *planes[3];
+	int32_t plane_sizes[3];
+
+	for (int plane = 0; plane < 3; plane++)
+	{
+		// Chroma planes are subsampled vertically (e.g. YUV420P: height / 2, YUV444P: height)
+		int plane_height = (plane == 0) ? frame_holder->height : AV_CEIL_RSHIFT(frame_holder->height, descriptor->log2_chroma_h);
+
+		frame->SetStride(frame_holder->linesize[plane], plane);
+
+		planes[plane] = frame_holder->data[plane];
+		plane_sizes[plane] = frame_holder->linesize[plane] * plane_height;
+	}
+
+	frame->SetAVFrame(std::move(frame_holder), planes, plane_sizes, 3);
+
+	return frame;
+}
+
+bool TranscodeFrame::ToAVFrame(const std::shared_ptr<const MediaFrame> &frame, AVFrame *av_frame)
+{
+	const auto &frame_holder = frame->GetAVFrame();
+
+	if (frame_holder != nullptr)
+	{
+		// Refer to the buffers of the decoded/filtered frame
+		int ret = ::av_frame_ref(av_frame, frame_holder.get());
+
+		if (ret < 0)
+		{
+			logte("Could not refer to the video frame: %d", ret);
+			return false;
+		}
+
+		// The decoded frame carries the picture type of the source, so the encoder would follow the GOP of the source
+		av_frame->pict_type = AV_PICTURE_TYPE_NONE;
+		av_frame->key_frame = 0;
+	}
+	else
+	{
+		av_frame->format = frame->GetFormat();
+		av_frame->width = frame->GetWidth();
+		av_frame->height = frame->GetHeight();
+		av_frame->linesize[0] = frame->GetStride(0);
+		av_frame->linesize[1] = frame->GetStride(1);
+		av_frame->linesize[2] = frame->GetStride(2);
+
+		if (::av_frame_get_buffer(av_frame, 32) < 0)
+		{
+			logte("Could not allocate the video frame data");
+			return false;
+		}
+
+		if (::av_frame_make_writable(av_frame) < 0)
+		{
+			logte("Could not make sure the frame data is writable");
+			::av_frame_unref(av_frame);
+			return false;
+		}
+
+		::memcpy(av_frame->data[0], frame->GetBuffer(0), frame->GetBufferSize(0));
+		::memcpy(av_frame->data[1], frame->GetBuffer(1), frame->GetBufferSize(1));
+		::memcpy(av_frame->data[2], frame->GetBuffer(2), frame->GetBufferSize(2));
+	}
+
+	// PTS/duration may be changed after decoding
+	av_frame->pts = frame->GetPts();
+	av_frame->pkt_duration = frame->GetDuration();
+
+	return true;
+}
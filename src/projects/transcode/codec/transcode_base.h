@@ -48,7 +48,20 @@ enum class TranscodeResult : int32_t
 	FormatChanged = 1,
 };
 
-template<typename InputType, typename OutputType>
+// Passes video frames between decoders, filters and encoders without copying the planes
+class TranscodeFrame
+{
+public:
+	// Moves the reference of av_frame to a new MediaFrame (av_frame is unreferenced after calling this)
+	static std::shared_ptr<MediaFrame> FromAVFrame(AVFrame *av_frame);
+
+	// Fills av_frame (which must be unreferenced) with the planes of frame.
+	// If the frame was created by FromAVFrame(), av_frame refers to the same buffers, otherwise the planes are copied.
+	static bool ToAVFrame(const std::shared_ptr<const MediaFrame> &frame, AVFrame *av_frame);
+};
+
+// InputQueueType: The queue that feeds the codec (A bounded ring by default, which drops the input when it is full)
+template<typename InputType, typename OutputType, typename InputQueueType = ov::MpscQueue<std::shared_ptr<const InputType>>>
 class TranscodeBase
 {
 public:
@@ -105,7 +118,8 @@ protected:
 		}
 	}
 
-	ov::Queue<std::shared_ptr<const InputType>> _input_buffer;
-	ov::Queue<std::shared_ptr<OutputType>> _output_buffer;
+	// The input is fed by the stream (and re-queued by some encoders), the output is produced only by the codec thread
+	InputQueueType _input_buffer;
+	ov::SpscQueue<std::shared_ptr<OutputType>> _output_buffer;
 };
 
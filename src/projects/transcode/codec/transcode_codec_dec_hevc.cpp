@@ -144,37 +144,19 @@ void OvenCodecImplAvcodecDecHEVC::ThreadDecode()
 					}
 				}
 
-				auto decoded_frame = std::make_shared<MediaFrame>();
-
-				decoded_frame->SetMediaType(cmn::MediaType::Video);
-				decoded_frame->SetWidth(_frame->width);
-				decoded_frame->SetHeight(_frame->height);
-				decoded_frame->SetFormat(_frame->format);
-				decoded_frame->SetPts((_frame->pts == AV_NOPTS_VALUE) ? -1LL : _frame->pts);
-
 				// Calculate duration using framerate in timebase
 				int den = _input_context->GetTimeBase().GetDen();
 				int64_t duration = (den == 0) ? 0LL : (float)den / _input_context->GetFrameRate();
-				decoded_frame->SetDuration(duration);
+				_frame->pkt_duration = duration;
 
-				decoded_frame->SetStride(_frame->linesize[0], 0);
-				decoded_frame->SetStride(_frame->linesize[1], 1);
-				decoded_frame->SetStride(_frame->linesize[2], 2);
+				// The decoded planes are passed to filters without copying
+				auto decoded_frame = TranscodeFrame::FromAVFrame(_frame);
+				::av_frame_unref(_frame);
 
-				if (_frame->format == AV_PIX_FMT_YUV444P)
+				if (decoded_frame == nullptr)
 				{
-					decoded_frame->SetBuffer(_frame->data[0], decoded_frame->GetStride(0) * decoded_frame->GetHeight(), 0);	 // Y-Plane 4
-					decoded_frame->SetBuffer(_frame->data[1], decoded_frame->GetStride(1) * decoded_frame->GetHeight(), 1);	 // Cb Plane 4
-					decoded_frame->SetBuffer(_frame->data[2], decoded_frame->GetStride(2) * decoded_frame->GetHeight(), 2);	 // Cr Plane 4
+					continue;
 				}
-				else
-				{
-					decoded_frame->SetBuffer(_frame->data[0], decoded_frame->GetStride(0) * decoded_frame->GetHeight(), 0);		 // Y-Plane 4
-					decoded_frame->SetBuffer(_frame->data[1], decoded_frame->GetStride(1) * decoded_frame->GetHeight() / 2, 1);	 // Cb Plane 2
-					decoded_frame->SetBuffer(_frame->data[2], decoded_frame->GetStride(2) * decoded_frame->GetHeight() / 2, 2);	 // Cr Plane 2
-				}
-
-				::av_frame_unref(_frame);
 
 				TranscodeResult result = need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady;
 
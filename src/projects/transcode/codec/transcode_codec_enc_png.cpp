@@ -104,34 +104,13 @@ void OvenCodecImplAvcodecEncPng::ThreadEncode()
 		// Request frame encoding to codec
 		///////////////////////////////////////////////////
 
-		_frame->format = frame->GetFormat();
-		_frame->pts = frame->GetPts();
-		_frame->pkt_duration = frame->GetDuration();
-		_frame->width = frame->GetWidth();
-		_frame->height = frame->GetHeight();
-		_frame->linesize[0] = frame->GetStride(0);
-		_frame->linesize[1] = frame->GetStride(1);
-		_frame->linesize[2] = frame->GetStride(2);
-
-		if (::av_frame_get_buffer(_frame, 32) < 0)
+		// If the frame is decoded/rescaled by FFmpeg, the buffers are referenced instead of copying
+		if (TranscodeFrame::ToAVFrame(frame, _frame) == false)
 		{
-			logte("Could not allocate the video frame data");
 			// *result = TranscodeResult::DataError;
 			break;
 		}
 
-		if (::av_frame_make_writable(_frame) < 0)
-		{
-			logte("Could not make sure the frame data is writable");
-			// *result = TranscodeResult::DataError;
-			break;
-		}
-
-		// Convert to Frame->Format -> Context->Format
-		::memcpy(_frame->data[0], frame->GetBuffer(0), frame->GetBufferSize(0));
-		::memcpy(_frame->data[1], frame->GetBuffer(1), frame->GetBufferSize(1));
-		::memcpy(_frame->data[2], frame->GetBuffer(2), frame->GetBufferSize(2));
-
 		int ret = ::avcodec_send_frame(_context, _frame);
 
 		::av_frame_unref(_frame);
@@ -14,6 +14,8 @@
 #include "transcode_codec_dec_hevc.h"
 
 #define MAX_QUEUE_SIZE 120
+// If the input queue exceeds this, the decoder cannot keep up with the input, and the rest of the GOP is dropped
+#define MAX_INPUT_QUEUE_SIZE_TO_DROP 600
 
 TranscodeDecoder::TranscodeDecoder(info::Stream stream_info)
 	: _stream_info(stream_info)
@@ -151,6 +153,37 @@ bool TranscodeDecoder::Configure(std::shared_ptr<TranscodeContext> context)
 
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
+	if (packet->GetMediaType() != cmn::MediaType::Video)
+	{
+		// Audio frames are small and some providers don't mark the key flag on them
+		_input_buffer.Enqueue(std::move(packet));
+		return;
+	}
+
+	bool is_key_frame = (packet->GetFlag() == MediaPacketFlag::Key);
+	auto queue_size = _input_buffer.Size();
+
+	if (_drop_until_key_frame)
+	{
+		if ((is_key_frame == false) || (queue_size >= MAX_INPUT_QUEUE_SIZE_TO_DROP))
+		{
+			_dropped_packet_count++;
+			return;
+		}
+
+		logtw("[Track #%d] Resumed decoding from the key frame (%zu packets are dropped)", _track_id, _dropped_packet_count);
+		_drop_until_key_frame = false;
+	}
+	else if ((queue_size >= MAX_INPUT_QUEUE_SIZE_TO_DROP) && (is_key_frame == false))
+	{
+		// Drops the whole rest of the GOP, since the frames after a dropped packet cannot be decoded
+		logtw("[Track #%d] The decoder is overloaded (queue: %zu), dropping packets until the next key frame", _track_id, queue_size);
+
+		_drop_until_key_frame = true;
+		_dropped_packet_count = 1;
+		return;
+	}
+
 	_input_buffer.Enqueue(std::move(packet));
 }
 
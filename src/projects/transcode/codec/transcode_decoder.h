@@ -11,7 +11,9 @@
 #include "base/info/stream.h"
 #include "transcode_base.h"
 
-class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame>
+// Compressed packets cannot be dropped one by one (the following frames cannot be decoded until the next key frame),
+// so the input queue of the decoder is not bounded. See SendBuffer() for the overload.
+class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame, ov::Queue<std::shared_ptr<const MediaPacket>>>
 {
 public:
 	TranscodeDecoder(info::Stream stream_info);
@@ -61,4 +63,8 @@ protected:
 
 	bool _kill_flag = false;
 	std::thread _thread_work;
+
+	// Set when the input queue is overloaded, the packets are dropped until the next key frame
+	bool _drop_until_key_frame = false;
+	size_t _dropped_packet_count = 0;
 };
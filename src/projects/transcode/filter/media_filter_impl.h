@@ -40,7 +40,7 @@ public:
 
 	virtual bool Configure(const std::shared_ptr<MediaTrack> &input_media_track, const std::shared_ptr<TranscodeContext> &input_context, const std::shared_ptr<TranscodeContext> &output_context) = 0;
 
-	virtual int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) = 0;
+	virtual int32_t SendBuffer(std::shared_ptr<const MediaFrame> buffer) = 0;
 	virtual std::shared_ptr<MediaFrame> RecvBuffer(TranscodeResult *result) = 0;
 
 	static AVRational TimebaseToAVRational(const cmn::Timebase &timebase)
@@ -72,8 +72,9 @@ public:
 	}
 
 protected:
-	ov::Queue<std::shared_ptr<MediaFrame>> _input_buffer;
-	ov::Queue<std::shared_ptr<MediaFrame>> _output_buffer;
+	// A filter is fed only by the thread of its decoder
+	ov::SpscQueue<std::shared_ptr<const MediaFrame>> _input_buffer;
+	ov::SpscQueue<std::shared_ptr<MediaFrame>> _output_buffer;
 
 	AVFrame *_frame = nullptr;
 	AVFilterContext *_buffersink_ctx = nullptr;
@@ -332,7 +332,7 @@ void MediaFilterResampler::ThreadFilter()
 	}
 }
 
-int32_t MediaFilterResampler::SendBuffer(std::shared_ptr<MediaFrame> buffer)
+int32_t MediaFilterResampler::SendBuffer(std::shared_ptr<const MediaFrame> buffer)
 {
 	_input_buffer.Enqueue(std::move(buffer));
 
@@ -23,7 +23,7 @@ public:
 
 	bool Configure(const std::shared_ptr<MediaTrack> &input_media_track, const std::shared_ptr<TranscodeContext> &input_context, const std::shared_ptr<TranscodeContext> &output_context) override;
 
-	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) override;
+	int32_t SendBuffer(std::shared_ptr<const MediaFrame> buffer) override;
 	std::shared_ptr<MediaFrame> RecvBuffer(TranscodeResult *result) override;
 
 	void ThreadFilter();
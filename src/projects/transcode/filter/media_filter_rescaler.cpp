@@ -103,21 +103,8 @@ bool MediaFilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_med
 		return false;
 	}
 
-	if (output_context->GetCodecId() == cmn::MediaCodecId::Jpeg)
-	{
-		enum AVPixelFormat pix_fmts[] = {AV_PIX_FMT_YUVJ420P, AV_PIX_FMT_NONE};
-		ret = av_opt_set_int_list(_buffersink_ctx, "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
-	}
-	if (output_context->GetCodecId() == cmn::MediaCodecId::Png)
-	{
-		enum AVPixelFormat pix_fmts[] = {AV_PIX_FMT_RGBA, AV_PIX_FMT_NONE};
-		ret = av_opt_set_int_list(_buffersink_ctx, "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
-	}
-	else
-	{
-		enum AVPixelFormat pix_fmts[] = {AV_PIX_FMT_YUV420P, AV_PIX_FMT_NONE};
-		ret = av_opt_set_int_list(_buffersink_ctx, "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
-	}
+	enum AVPixelFormat pix_fmts[] = {static_cast<AVPixelFormat>(GetOutputPixelFormat(output_context->GetCodecId())), AV_PIX_FMT_NONE};
+	ret = av_opt_set_int_list(_buffersink_ctx, "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
 	if (ret < 0)
 	{
 		logte("Could not set output pixel format for rescaling: %d", ret);
@@ -180,7 +167,22 @@ bool MediaFilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_med
 	return true;
 }
 
-int32_t MediaFilterRescaler::SendBuffer(std::shared_ptr<MediaFrame> buffer)
+int32_t MediaFilterRescaler::GetOutputPixelFormat(cmn::MediaCodecId codec_id)
+{
+	switch (codec_id)
+	{
+		case cmn::MediaCodecId::Jpeg:
+			return AV_PIX_FMT_YUVJ420P;
+
+		case cmn::MediaCodecId::Png:
+			return AV_PIX_FMT_RGBA;
+
+		default:
+			return AV_PIX_FMT_YUV420P;
+	}
+}
+
+int32_t MediaFilterRescaler::SendBuffer(std::shared_ptr<const MediaFrame> buffer)
 {
 	_input_buffer.Enqueue(std::move(buffer));
 
@@ -216,36 +218,14 @@ void MediaFilterRescaler::ThreadFilter()
 		// logte("Filter Queue : %d / %d", _input_buffer.Size(), _output_buffer.Size());
 		// logtp("Dequeued data for rescaling: %lld (%.0f)\n%s", frame->GetPts(), frame->GetPts() * _output_context->GetTimeBase().GetExpr() * 1000.0f, ov::Dump(frame->GetBuffer(0), frame->GetBufferSize(0), 32).CStr());
 
-		_frame->format = frame->GetFormat();
-		_frame->width = frame->GetWidth();
-		_frame->height = frame->GetHeight();
-		_frame->pts = frame->GetPts();
-		_frame->pkt_duration = frame->GetDuration();
-
-		_frame->linesize[0] = frame->GetStride(0);
-		_frame->linesize[1] = frame->GetStride(1);
-		_frame->linesize[2] = frame->GetStride(2);
-
-		int ret = ::av_frame_get_buffer(_frame, 32);
-		if (ret < 0)
-		{
-			logte("Could not allocate the video frame data\n");
-			break;
-		}
-
-		ret = ::av_frame_make_writable(_frame);
-		if (ret < 0)
+		// If the frame is decoded by FFmpeg, the buffers are referenced instead of copying
+		if (TranscodeFrame::ToAVFrame(frame, _frame) == false)
 		{
-			logte("Could not make writable frame. error(%d)", ret);
+			logte("Could not prepare the video frame for rescaling");
 			break;
 		}
 
-		// Copy data of frame to _frame
-		::memcpy(_frame->data[0], frame->GetBuffer(0), frame->GetBufferSize(0));
-		::memcpy(_frame->data[1], frame->GetBuffer(1), frame->GetBufferSize(1));
-		::memcpy(_frame->data[2], frame->GetBuffer(2), frame->GetBufferSize(2));
-
-		ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, _frame, AV_BUFFERSRC_FLAG_KEEP_REF);
+		int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, _frame, AV_BUFFERSRC_FLAG_KEEP_REF);
 		::av_frame_unref(_frame);
 		if (ret < 0)
 		{
@@ -274,26 +254,15 @@ void MediaFilterRescaler::ThreadFilter()
 			}
 			else
 			{
-				auto output_frame = std::make_shared<MediaFrame>();
-
-				output_frame->SetFormat(_frame->format);
-				output_frame->SetWidth(_frame->width);
-				output_frame->SetHeight(_frame->height);
-				output_frame->SetPts((_frame->pts == AV_NOPTS_VALUE) ? -1LL : _frame->pts);
-				output_frame->SetDuration(_frame->pkt_duration);
-
-				output_frame->SetStride(_frame->linesize[0], 0);
-				output_frame->SetStride(_frame->linesize[1], 1);
-				output_frame->SetStride(_frame->linesize[2], 2);
-
-				output_frame->SetBuffer(_frame->data[0], output_frame->GetStride(0) * output_frame->GetHeight(), 0);	  // Y-Plane
-				output_frame->SetBuffer(_frame->data[1], output_frame->GetStride(1) * output_frame->GetHeight() / 2, 1);  // Cb Plane
-				output_frame->SetBuffer(_frame->data[2], output_frame->GetStride(2) * output_frame->GetHeight() / 2, 2);  // Cr Plane
-
-				//logtp("Rescaled data: %lld (%.0f)\n%s", output_frame->GetPts(), output_frame->GetPts() * _output_context->GetTimeBase().GetExpr() * 1000.0f, ov::Dump(_frame->data[0], _frame->linesize[0], 32).CStr());
-
+				// The rescaled planes are passed to encoders without copying
+				auto output_frame = TranscodeFrame::FromAVFrame(_frame);
 				::av_frame_unref(_frame);
 
+				if (output_frame == nullptr)
+				{
+					continue;
+				}
+
 				_output_buffer.Enqueue(std::move(output_frame));
 			}
 		}
@@ -23,13 +23,16 @@ public:
 
 	bool Configure(const std::shared_ptr<MediaTrack> &input_media_track, const std::shared_ptr<TranscodeContext> &input_context, const std::shared_ptr<TranscodeContext> &output_context) override;
 
-	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) override;
+	int32_t SendBuffer(std::shared_ptr<const MediaFrame> buffer) override;
 	std::shared_ptr<MediaFrame> RecvBuffer(TranscodeResult * result) override;
 
 	void ThreadFilter();
 
 	void Stop();
 
+	// Pixel format of the frames produced for the encoder of codec_id (AVPixelFormat)
+	static int32_t GetOutputPixelFormat(cmn::MediaCodecId codec_id);
+
 protected:
 
 };
@@ -49,7 +49,7 @@ bool TranscodeFilter::Configure(std::shared_ptr<MediaTrack> input_media_track, s
 	return true;
 }
 
-int32_t TranscodeFilter::SendBuffer(std::shared_ptr<MediaFrame> buffer)
+int32_t TranscodeFilter::SendBuffer(std::shared_ptr<const MediaFrame> buffer)
 {
 	return _impl->SendBuffer(std::move(buffer));
 }
@@ -77,4 +77,9 @@ cmn::Timebase TranscodeFilter::GetInputTimebase() const
 cmn::Timebase TranscodeFilter::GetOutputTimebase() const
 {
 	return _impl->GetOutputTimebase();
-}
\ No newline at end of file
+}
+
+int32_t TranscodeFilter::GetVideoPixelFormat(cmn::MediaCodecId codec_id)
+{
+	return MediaFilterRescaler::GetOutputPixelFormat(codec_id);
+}
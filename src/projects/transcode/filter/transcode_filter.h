@@ -27,7 +27,7 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> input_media_track, std::shared_ptr<TranscodeContext> input_context, std::shared_ptr<TranscodeContext> output_context);
 
-	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer);
+	int32_t SendBuffer(std::shared_ptr<const MediaFrame> buffer);
 	std::shared_ptr<MediaFrame> RecvBuffer(TranscodeResult *result);
 
 	uint32_t GetInputBufferSize();
@@ -36,6 +36,9 @@ public:
 	cmn::Timebase GetInputTimebase() const;
 	cmn::Timebase GetOutputTimebase() const;
 
+	// Pixel format of the rescaled frames for the encoder of codec_id
+	static int32_t GetVideoPixelFormat(cmn::MediaCodecId codec_id);
+
 private:
 	MediaFilterImpl *_impl;
 };
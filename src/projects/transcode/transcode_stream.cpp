@@ -10,6 +10,9 @@
 #include "transcode_stream.h"
 
 #include <config/config_manager.h>
+#include <monitoring/monitoring.h>
+
+#include <algorithm>
 
 #include "transcode_application.h"
 #include "transcode_private.h"
@@ -49,7 +52,9 @@ TranscodeStream::~TranscodeStream()
 	_stage_input_to_output.clear();
 	_stage_decoder_to_filter.clear();
 	_stage_filter_to_encoder.clear();
+	_stage_filter_to_filter.clear();
 	_stage_encoder_to_output.clear();
+	_cascade_area_ratio.clear();
 
 	_output_streams.clear();
 }
@@ -100,6 +105,8 @@ bool TranscodeStream::Start()
 
 	_kill_flag = false;
 
+	_stream_metrics = StreamMetrics(*_input_stream);
+
 	// Notify to create a new stream on the media router.
 	NotifyCreateStreams();
 
@@ -142,7 +149,9 @@ bool TranscodeStream::Stop()
 	// Notify to delete the stream created on the MediaRouter
 	NotifyDeleteStreams();
 
-	logti("[%s/%s(%u)] Transcoder stream has been stopped.", _application_info.GetName().CStr(), _input_stream->GetName().CStr(), _input_stream->GetId());
+	logti("[%s/%s(%u)] Transcoder stream has been stopped. Saved memory bandwidth : (%s) Shared frames, (%s) Cascaded scaling",
+		  _application_info.GetName().CStr(), _input_stream->GetName().CStr(), _input_stream->GetId(),
+		  ov::Converter::BytesToString(_shared_frame_bytes).CStr(), ov::Converter::BytesToString(_cascaded_frame_bytes).CStr());
 
 	return true;
 }
@@ -517,6 +526,10 @@ int32_t TranscodeStream::CreateStageMapping()
 	// InputTrack = ID of Input Track
 	// OutputTracks = ID of Output Tracks
 
+	// [FILTER_IDENTIFIER, FILTER_ID]
+	// Outputs that need the same frames from a decoder share a filter
+	std::map<ov::String, MediaTrackId> filter_ids;
+
 	ov::String temp_debug_msg = "\r\nTranscode Pipeline \n";
 	temp_debug_msg.AppendFormat(" - app(%s/%d), stream(%s/%d)\n", _application_info.GetName().CStr(), _application_info.GetId(), _input_stream->GetName().CStr(), _input_stream->GetId());
 
@@ -526,6 +539,7 @@ int32_t TranscodeStream::CreateStageMapping()
 		auto &flow_context = iter.second;
 		auto encode_profile_name = key_pair.first;
 		auto encode_media_type = key_pair.second;
+		auto filter_id = flow_context->_map_id;
 
 		for (auto &iter_output_tracks : flow_context->_output_tracks)
 		{
@@ -534,7 +548,6 @@ int32_t TranscodeStream::CreateStageMapping()
 
 			auto input_id = flow_context->_input_track->GetId();
 			auto decoder_id = flow_context->_input_track->GetId();
-			auto filter_id = flow_context->_map_id;
 			auto encoder_id = flow_context->_map_id;
 			auto output_id = track_info->GetId();
 
@@ -547,33 +560,23 @@ int32_t TranscodeStream::CreateStageMapping()
 				// Map of InputTrack -> Decoder
 				_stage_input_to_decoder[input_id] = decoder_id;
 
+				auto filter_id_item = filter_ids.emplace(GetIdentifierForFilter(decoder_id, track_info), flow_context->_map_id);
+				filter_id = filter_id_item.first->second;
+
 				// Map of Decoder -> Filters
-				if (_stage_decoder_to_filter.find(decoder_id) == _stage_decoder_to_filter.end())
+				auto &decoder_filter_ids = _stage_decoder_to_filter[decoder_id];
+				if (std::find(decoder_filter_ids.begin(), decoder_filter_ids.end(), filter_id) == decoder_filter_ids.end())
 				{
-					_stage_decoder_to_filter[decoder_id].push_back(filter_id);
+					decoder_filter_ids.push_back(filter_id);
 				}
-				else
-				{
-					auto filter_ids = _stage_decoder_to_filter[decoder_id];
-					bool found = false;
 
-					for (auto it_filter_id : filter_ids)
-					{
-						if (it_filter_id == filter_id)
-						{
-							found = true;
-						}
-					}
-
-					if (found == false)
-					{
-						_stage_decoder_to_filter[decoder_id].push_back(filter_id);
-					}
+				// Map of Filter -> Encoders
+				auto &encoder_ids = _stage_filter_to_encoder[filter_id];
+				if (std::find(encoder_ids.begin(), encoder_ids.end(), encoder_id) == encoder_ids.end())
+				{
+					encoder_ids.push_back(encoder_id);
 				}
 
-				// Map of Filter -> Encoder
-				_stage_filter_to_encoder[filter_id] = encoder_id;
-
 				// Map of Encoder -> OutputTrack
 				_stage_encoder_to_output[encoder_id].push_back(make_pair(stream, output_id));
 			}
@@ -595,7 +598,7 @@ int32_t TranscodeStream::CreateStageMapping()
 									(encode_media_type == cmn::MediaType::Video) ? "Video" : "Audio",
 									flow_context->_input_track->GetId(),
 									flow_context->_input_track->GetId(),
-									flow_context->_map_id,
+									filter_id,
 									flow_context->_map_id,
 									temp_str.CStr());
 
@@ -606,6 +609,31 @@ int32_t TranscodeStream::CreateStageMapping()
 	return created_stage_map;
 }
 
+ov::String TranscodeStream::GetIdentifierForFilter(MediaTrackId decoder_id, const std::shared_ptr<MediaTrack> &output_track)
+{
+	switch (output_track->GetMediaType())
+	{
+		case cmn::MediaType::Video:
+			return ov::String::FormatString("V-%d-%d-%dx%d-%.02f",
+											decoder_id,
+											TranscodeFilter::GetVideoPixelFormat(output_track->GetCodecId()),
+											output_track->GetWidth(),
+											output_track->GetHeight(),
+											output_track->GetFrameRate());
+
+		case cmn::MediaType::Audio:
+			// The sample format of the resampled frames depends on the codec
+			return ov::String::FormatString("A-%d-%d-%d-%d",
+											decoder_id,
+											static_cast<int32_t>(output_track->GetCodecId()),
+											output_track->GetSampleRate(),
+											static_cast<int32_t>(output_track->GetChannel().GetLayout()));
+
+		default:
+			return ov::String::FormatString("%d-%u", decoder_id, output_track->GetId());
+	}
+}
+
 ov::String TranscodeStream::GetIdentifiedForVideoProfile(const cfg::vhost::app::oprf::VideoProfile &profile)
 {
 	if (profile.IsBypass() == true)
@@ -1089,7 +1117,7 @@ void TranscodeStream::OnDecodedPacket(TranscodeResult result, int32_t decoder_id
 	}
 }
 
-TranscodeResult TranscodeStream::FilterFrame(int32_t track_id, std::shared_ptr<MediaFrame> decoded_frame)
+TranscodeResult TranscodeStream::FilterFrame(int32_t track_id, std::shared_ptr<const MediaFrame> decoded_frame)
 {
 	auto filter_item = _filters.find(track_id);
 	if (filter_item == _filters.end())
@@ -1127,7 +1155,37 @@ TranscodeResult TranscodeStream::FilterFrame(int32_t track_id, std::shared_ptr<M
 					  filtered_frame->GetBufferSize());
 
 				int32_t filter_id = filtered_frame->GetTrackId();
-				EncodeFrame(filter_id, std::move(filtered_frame));
+				std::shared_ptr<const MediaFrame> shared_frame = std::move(filtered_frame);
+				size_t consumer_count = 0;
+
+				// All encoders which need the same frames refer to the filtered frame
+				auto encoder_item = _stage_filter_to_encoder.find(filter_id);
+				if (encoder_item != _stage_filter_to_encoder.end())
+				{
+					for (auto &encoder_id : encoder_item->second)
+					{
+						EncodeFrame(encoder_id, shared_frame);
+						consumer_count++;
+					}
+				}
+
+				// Cascade scaling: the smaller renditions are rescaled from this frame
+				auto child_item = _stage_filter_to_filter.find(filter_id);
+				if (child_item != _stage_filter_to_filter.end())
+				{
+					for (auto &child_filter_id : child_item->second)
+					{
+						IncreaseCascadedFrameBytes(static_cast<uint64_t>(shared_frame->GetTotalBufferSize() * (_cascade_area_ratio[child_filter_id] - 1.0)));
+
+						FilterFrame(child_filter_id, shared_frame);
+						consumer_count++;
+					}
+				}
+
+				if (consumer_count > 1)
+				{
+					IncreaseSharedFrameBytes(shared_frame->GetTotalBufferSize() * (consumer_count - 1));
+				}
 			}
 			break;
 
@@ -1137,10 +1195,8 @@ TranscodeResult TranscodeStream::FilterFrame(int32_t track_id, std::shared_ptr<M
 	}
 }
 
-TranscodeResult TranscodeStream::EncodeFrame(int32_t filter_id, std::shared_ptr<const MediaFrame> frame)
+TranscodeResult TranscodeStream::EncodeFrame(int32_t encoder_id, std::shared_ptr<const MediaFrame> frame)
 {
-	auto encoder_id = _stage_filter_to_encoder[filter_id];
-
 	auto encoder_item = _encoders.find(encoder_id);
 	if (encoder_item == _encoders.end())
 	{
@@ -1271,24 +1327,125 @@ void TranscodeStream::CreateFilter(MediaFrame *buffer)
 	}
 	auto filter_id_list = filter_item->second;
 
+	// The filters are re-created, so the previous cascade is no longer valid
 	for (auto &filter_id : filter_id_list)
 	{
-		auto encoder_id = _stage_filter_to_encoder[filter_id];
+		_stage_filter_to_filter.erase(filter_id);
+		_cascade_area_ratio.erase(filter_id);
+	}
 
-		if (_encoders.find(encoder_id) == _encoders.end())
+	// All encoders of a filter need the same frames, so the filter is configured with the context of the first encoder
+	auto get_output_context = [this](MediaTrackId filter_id) -> std::shared_ptr<TranscodeContext> {
+		auto encoder_item = _stage_filter_to_encoder.find(filter_id);
+		if ((encoder_item == _stage_filter_to_encoder.end()) || encoder_item->second.empty())
 		{
-			logte("%d track encoder is not allocated", encoder_id);
+			return nullptr;
+		}
+
+		auto encoder = _encoders.find(encoder_item->second[0]);
+		if (encoder == _encoders.end())
+		{
+			return nullptr;
+		}
+
+		return encoder->second->GetContext();
+	};
+
+	auto get_area = [](const std::shared_ptr<TranscodeContext> &context) -> int64_t {
+		return (context == nullptr) ? 0LL : static_cast<int64_t>(context->GetVideoWidth()) * context->GetVideoHeight();
+	};
+
+	bool cascade_scaling = (input_track->GetMediaType() == cmn::MediaType::Video) &&
+						   _application_info.GetConfig().GetOutputProfiles().IsCascadeScalingEnabled();
+
+	if (cascade_scaling)
+	{
+		// Create the larger filters first, so that the smaller ones can be fed from them
+		std::stable_sort(filter_id_list.begin(), filter_id_list.end(), [&](MediaTrackId a, MediaTrackId b) {
+			return get_area(get_output_context(a)) > get_area(get_output_context(b));
+		});
+	}
+
+	// Filters created so far (candidates of the parent filter for cascade scaling)
+	std::vector<std::pair<MediaTrackId, std::shared_ptr<TranscodeContext>>> created_filters;
+
+	for (auto &filter_id : filter_id_list)
+	{
+		auto output_transcode_context = get_output_context(filter_id);
+
+		if (output_transcode_context == nullptr)
+		{
+			logte("%d track encoder is not allocated", filter_id);
 			continue;
 		}
 
-		auto output_transcode_context = _encoders[encoder_id]->GetContext();
+		auto filter_input_track = input_track;
+		auto filter_input_context = input_transcode_context;
+
+		MediaTrackId parent_filter_id = -1;
+		std::shared_ptr<TranscodeContext> parent_context = nullptr;
+
+		if (cascade_scaling)
+		{
+			// Find the smallest filter that produces a larger picture of the same pixel format, without dropping frames needed by this filter
+			for (auto &[candidate_id, candidate_context] : created_filters)
+			{
+				if ((TranscodeFilter::GetVideoPixelFormat(candidate_context->GetCodecId()) != TranscodeFilter::GetVideoPixelFormat(output_transcode_context->GetCodecId())) ||
+					(candidate_context->GetVideoWidth() < output_transcode_context->GetVideoWidth()) ||
+					(candidate_context->GetVideoHeight() < output_transcode_context->GetVideoHeight()) ||
+					(get_area(candidate_context) <= get_area(output_transcode_context)) ||
+					(candidate_context->GetFrameRate() < output_transcode_context->GetFrameRate()))
+				{
+					continue;
+				}
+
+				if ((parent_context == nullptr) || (get_area(candidate_context) < get_area(parent_context)))
+				{
+					parent_filter_id = candidate_id;
+					parent_context = candidate_context;
+				}
+			}
+
+			if (parent_context != nullptr)
+			{
+				// The input of this filter is the output of the parent filter
+				filter_input_track = std::make_shared<MediaTrack>(*input_track);
+				filter_input_track->SetWidth(parent_context->GetVideoWidth());
+				filter_input_track->SetHeight(parent_context->GetVideoHeight());
+				filter_input_track->SetFormat(TranscodeFilter::GetVideoPixelFormat(parent_context->GetCodecId()));
+				filter_input_track->SetTimeBase(parent_context->GetTimeBase());
+
+				filter_input_context = std::make_shared<TranscodeContext>(
+					false,
+					input_transcode_context->GetCodecId(),
+					input_transcode_context->GetBitrate(),
+					parent_context->GetVideoWidth(),
+					parent_context->GetVideoHeight(),
+					parent_context->GetFrameRate());
+				filter_input_context->SetTimeBase(parent_context->GetTimeBase());
+			}
+		}
 
 		auto transcode_filter = std::make_shared<TranscodeFilter>();
 
-		bool ret = transcode_filter->Configure(input_track, input_transcode_context, output_transcode_context);
+		bool ret = transcode_filter->Configure(filter_input_track, filter_input_context, output_transcode_context);
 		if (ret == true)
 		{
 			_filters[filter_id] = transcode_filter;
+
+			if (parent_context != nullptr)
+			{
+				_stage_filter_to_filter[parent_filter_id].push_back(filter_id);
+				_cascade_area_ratio[filter_id] = static_cast<double>(input_track->GetWidth()) * input_track->GetHeight() / get_area(parent_context);
+
+				logtd("Filter[%d] is cascaded from Filter[%d]: %dx%d -> %ux%u -> %ux%u",
+					  filter_id, parent_filter_id,
+					  input_track->GetWidth(), input_track->GetHeight(),
+					  parent_context->GetVideoWidth(), parent_context->GetVideoHeight(),
+					  output_transcode_context->GetVideoWidth(), output_transcode_context->GetVideoHeight());
+			}
+
+			created_filters.emplace_back(filter_id, output_transcode_context);
 		}
 		else
 		{
@@ -1298,7 +1455,7 @@ void TranscodeStream::CreateFilter(MediaFrame *buffer)
 	}
 }
 
-void TranscodeStream::SpreadToFilters(std::shared_ptr<MediaFrame> frame)
+void TranscodeStream::SpreadToFilters(std::shared_ptr<const MediaFrame> frame)
 {
 	// Get decode id
 	int32_t decoder_id = frame->GetTrackId();
@@ -1311,16 +1468,44 @@ void TranscodeStream::SpreadToFilters(std::shared_ptr<MediaFrame> frame)
 		return;
 	}
 
+	size_t filter_count = 0;
+
+	// The decoded frame is immutable, so all filters refer to the same frame instead of a copy
 	for (auto &filter_id : filter_item->second)
 	{
-		auto frame_clone = frame->CloneFrame();
-		if (frame_clone == nullptr)
+		if (_cascade_area_ratio.find(filter_id) != _cascade_area_ratio.end())
 		{
-			logte("FilterTask -> Unknown Frame");
+			// This filter is fed with the output of the parent filter
 			continue;
 		}
 
-		FilterFrame(filter_id, std::move(frame_clone));
+		FilterFrame(filter_id, frame);
+		filter_count++;
+	}
+
+	if (filter_count > 1)
+	{
+		IncreaseSharedFrameBytes(frame->GetTotalBufferSize() * (filter_count - 1));
+	}
+}
+
+void TranscodeStream::IncreaseSharedFrameBytes(uint64_t bytes)
+{
+	_shared_frame_bytes += bytes;
+
+	if (_stream_metrics != nullptr)
+	{
+		_stream_metrics->IncreaseTranscoderSharedFrameBytes(bytes);
+	}
+}
+
+void TranscodeStream::IncreaseCascadedFrameBytes(uint64_t bytes)
+{
+	_cascaded_frame_bytes += bytes;
+
+	if (_stream_metrics != nullptr)
+	{
+		_stream_metrics->IncreaseTranscoderCascadedFrameBytes(bytes);
 	}
 }
 
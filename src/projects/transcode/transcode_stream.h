@@ -10,6 +10,7 @@
 
 #include <base/info/application.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <queue>
@@ -27,6 +28,11 @@ typedef int32_t MediaTrackId;
 
 class TranscodeApplication;
 
+namespace mon
+{
+	class StreamMetrics;
+}
+
 class TranscodeTrackMapContext
 {
 public:
@@ -85,8 +91,16 @@ private:
 	// [DECODER_ID, FILTER_ID(trasncode_id)]
 	std::map<MediaTrackId, std::vector<MediaTrackId>> _stage_decoder_to_filter;
 
-	// [FILTER_ID(trasncode_id), ENCODER_ID(trasncode_id)]
-	std::map<MediaTrackId, MediaTrackId> _stage_filter_to_encoder;
+	// [FILTER_ID(trasncode_id), ENCODER_IDs(trasncode_id)]
+	// Encoders that need the same resolution/framerate/format share one filter
+	std::map<MediaTrackId, std::vector<MediaTrackId>> _stage_filter_to_encoder;
+
+	// [FILTER_ID(trasncode_id), FILTER_IDs(trasncode_id)]
+	// When cascade scaling is enabled, the child filters are fed with the output of the parent filter instead of the decoded frame
+	std::map<MediaTrackId, std::vector<MediaTrackId>> _stage_filter_to_filter;
+
+	// [FILTER_ID(trasncode_id), (Decoded frame area / Parent filter output area)]
+	std::map<MediaTrackId, double> _cascade_area_ratio;
 
 	// [ENCODER_ID(trasncode_id), OUTPUT_TRACKS]
 	std::map<MediaTrackId, std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>> _stage_encoder_to_output;
@@ -103,6 +117,16 @@ private:
 	// ENCODER_ID, ENCODER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeEncoder>> _encoders;
 
+	// Bytes of the frames passed to multiple filters/encoders by reference instead of being copied/rescaled again
+	std::atomic<uint64_t> _shared_frame_bytes{0};
+	// Bytes the cascaded filters did not have to read from the decoded frames
+	std::atomic<uint64_t> _cascaded_frame_bytes{0};
+	// The saved bytes are also reported to the metrics of the input stream
+	std::shared_ptr<mon::StreamMetrics> _stream_metrics;
+
+	void IncreaseSharedFrameBytes(uint64_t bytes);
+	void IncreaseCascadedFrameBytes(uint64_t bytes);
+
 	// last generated output track id.
 	uint8_t _last_track_index = 0;
 
@@ -123,6 +147,7 @@ private:
 	int32_t CreateOutputStreamDynamic();
 
 	int32_t CreateStageMapping();
+	ov::String GetIdentifierForFilter(MediaTrackId decoder_id, const std::shared_ptr<MediaTrack> &output_track);
 
 	int32_t CreateDecoders();
 	bool CreateDecoder(int32_t input_track_id, int32_t decoder_track_id, std::shared_ptr<TranscodeContext> input_context);
@@ -145,11 +170,12 @@ private:
 	void OnDecodedPacket(TranscodeResult result, int32_t decoder_id);
 
 	// Step 2: Filter (resample/rescale the decoded frame)
-	void SpreadToFilters(std::shared_ptr<MediaFrame> frame);
-	TranscodeResult FilterFrame(int32_t track_id, std::shared_ptr<MediaFrame> frame);
+	//  - The decoded frames are immutable, so the same frame is shared by all filters
+	void SpreadToFilters(std::shared_ptr<const MediaFrame> frame);
+	TranscodeResult FilterFrame(int32_t track_id, std::shared_ptr<const MediaFrame> frame);
 
 	// Step 3: Encode (Encode the filtered frame to packets)
-	TranscodeResult EncodeFrame(int32_t track_id, std::shared_ptr<const MediaFrame> frame);
+	TranscodeResult EncodeFrame(int32_t encoder_id, std::shared_ptr<const MediaFrame> frame);
 	TranscodeResult OnEncodedPacket(int32_t encoder_id);
 
 